@@ -0,0 +1,141 @@
+#include "animation.h"
+#include <algorithm>
+#include "config.h"
+#include "grid_layout.h"
+
+// Easing curves sampled at 65 points over t = 0..1, values 0..255
+static const uint8_t EASE_IN_LUT[65] = {
+  0, 0, 0, 1, 1, 2, 2, 3, 4, 5, 6, 8, 9, 11, 12, 14, 16, 18, 20, 22, 25, 27, 30, 33, 36, 39, 42, 45, 49, 52, 56, 60,
+  64, 68, 72, 76, 81, 85, 90, 95, 100, 105, 110, 115, 121, 126, 132, 138, 143, 149, 156, 162, 168, 175, 182, 188,
+  195, 202, 209, 217, 224, 232, 239, 247, 255
+};
+static const uint8_t EASE_OUT_LUT[65] = {
+  0, 8, 16, 23, 31, 38, 46, 53, 60, 67, 73, 80, 87, 93, 99, 106, 112, 117, 123, 129, 134, 140, 145, 150, 155, 160,
+  165, 170, 174, 179, 183, 187, 191, 195, 199, 203, 206, 210, 213, 216, 219, 222, 225, 228, 230, 233, 235, 237, 239,
+  241, 243, 244, 246, 247, 249, 250, 251, 252, 253, 253, 254, 254, 255, 255, 255
+};
+static const uint8_t EASE_IN_OUT_LUT[65] = {
+  0, 0, 1, 2, 3, 4, 6, 8, 11, 14, 17, 20, 24, 27, 31, 35, 40, 44, 49, 54, 59, 64, 70, 75, 81, 86, 92, 98, 104, 110,
+  116, 122, 128, 133, 139, 145, 151, 157, 163, 169, 174, 180, 185, 191, 196, 201, 206, 211, 215, 220, 224, 228, 231,
+  235, 238, 241, 244, 247, 249, 251, 252, 253, 254, 255, 255
+};
+
+uint8_t easeLevel(uint8_t from, uint8_t to, uint32_t elapsed, uint32_t span, Easing ease) {
+  if (span == 0 || elapsed >= span) return to;
+  // Position in Q16 (65536 = end of the segment)
+  const uint32_t pos = (elapsed << 16) / span;
+  uint32_t eased; // 0..255
+  if (ease == Easing::LINEAR) {
+    eased = pos >> 8;
+  } else {
+    const uint8_t* lut = ease == Easing::EASE_IN ? EASE_IN_LUT
+                       : ease == Easing::EASE_OUT ? EASE_OUT_LUT
+                       : EASE_IN_OUT_LUT;
+    const uint32_t idx = pos >> 10;    // 0..63
+    const uint32_t frac = pos & 1023;  // Q10 between samples
+    const int32_t a = lut[idx];
+    const int32_t b = lut[idx + 1];
+    eased = (uint32_t)(a + (((b - a) * (int32_t)frac) >> 10));
+  }
+  return (uint8_t)((int32_t)from + (((int32_t)to - (int32_t)from) * (int32_t)eased) / 255);
+}
+
+void Timeline::clear() {
+  tracks.clear();
+  duration = 0;
+}
+
+void Timeline::addTrack(const std::vector<uint16_t>& leds, std::initializer_list<Keyframe> keys) {
+  if (leds.empty() || keys.size() == 0) return;
+  Track track;
+  track.leds = leds;
+  track.keyCount = 0;
+  for (const Keyframe& k : keys) {
+    if (track.keyCount >= MAX_KEYS) break;
+    track.keys[track.keyCount++] = k;
+  }
+  duration = std::max<uint32_t>(duration, track.keys[track.keyCount - 1].atMs);
+  tracks.push_back(track);
+}
+
+void Timeline::render(uint32_t tMs, uint8_t* levels, uint16_t count) const {
+  std::fill(levels, levels + count, 0);
+  for (const Track& track : tracks) {
+    // Find the segment that contains t
+    uint8_t level = track.keys[track.keyCount - 1].level;
+    if (tMs < track.keys[0].atMs) {
+      level = track.keys[0].level;
+    } else {
+      for (uint8_t k = 1; k < track.keyCount; ++k) {
+        const Keyframe& a = track.keys[k - 1];
+        const Keyframe& b = track.keys[k];
+        if (tMs < b.atMs) {
+          level = easeLevel(a.level, b.level, tMs - a.atMs, b.atMs - a.atMs, b.ease);
+          break;
+        }
+      }
+    }
+    if (level == 0) continue;
+    for (uint16_t led : track.leds) {
+      if (led < count && levels[led] < level) levels[led] = level;
+    }
+  }
+}
+
+void buildWordFadeIn(Timeline& tl, const std::vector<std::vector<uint16_t>>& words, uint16_t stepMs, uint16_t fadeMs) {
+  tl.clear();
+  for (size_t i = 0; i < words.size(); ++i) {
+    const uint16_t start = (uint16_t)(i * stepMs);
+    tl.addTrack(words[i], { { 0, 0, Easing::LINEAR },
+                            { start, 0, Easing::LINEAR },
+                            { (uint16_t)(start + fadeMs), 255, Easing::EASE_OUT } });
+  }
+}
+
+// Splits two LED sets into old-only, new-only and shared
+static void diffLeds(const std::vector<uint16_t>& from, const std::vector<uint16_t>& to,
+                     std::vector<uint16_t>& out, std::vector<uint16_t>& in, std::vector<uint16_t>& both) {
+  for (uint16_t led : from) {
+    if (std::find(to.begin(), to.end(), led) != to.end()) both.push_back(led);
+    else out.push_back(led);
+  }
+  for (uint16_t led : to) {
+    if (std::find(from.begin(), from.end(), led) == from.end()) in.push_back(led);
+  }
+}
+
+void buildCrossfade(Timeline& tl, const std::vector<uint16_t>& from, const std::vector<uint16_t>& to, uint16_t durationMs) {
+  tl.clear();
+  std::vector<uint16_t> out, in, both;
+  diffLeds(from, to, out, in, both);
+  tl.addTrack(out, { { 0, 255, Easing::LINEAR }, { durationMs, 0, Easing::EASE_IN_OUT } });
+  tl.addTrack(in, { { 0, 0, Easing::LINEAR }, { durationMs, 255, Easing::EASE_IN_OUT } });
+  tl.addTrack(both, { { 0, 255, Easing::LINEAR }, { durationMs, 255, Easing::LINEAR } });
+}
+
+void buildWipe(Timeline& tl, const std::vector<uint16_t>& from, const std::vector<uint16_t>& to, uint16_t durationMs) {
+  tl.clear();
+  std::vector<uint16_t> out, in, both;
+  diffLeds(from, to, out, in, both);
+
+  // Grid column per LED; LEDs outside the grid switch with the last column
+  uint8_t column[NUM_LEDS];
+  std::fill(column, column + NUM_LEDS, (uint8_t)(GRID_WIDTH - 1));
+  for (int cell = 0; cell < GRID_WIDTH * GRID_HEIGHT; ++cell) {
+    int16_t led = ACTIVE_CELL_LEDS[cell];
+    if (led >= 0 && led < NUM_LEDS) column[led] = (uint8_t)(cell % GRID_WIDTH);
+  }
+
+  const uint16_t fade = durationMs / 4;
+  for (int c = 0; c < GRID_WIDTH; ++c) {
+    const uint16_t start = (uint16_t)((uint32_t)c * (durationMs - fade) / (GRID_WIDTH - 1));
+    std::vector<uint16_t> colOut, colIn;
+    for (uint16_t led : out) if (column[led] == c) colOut.push_back(led);
+    for (uint16_t led : in) if (column[led] == c) colIn.push_back(led);
+    tl.addTrack(colOut, { { 0, 255, Easing::LINEAR }, { start, 255, Easing::LINEAR },
+                          { (uint16_t)(start + fade), 0, Easing::EASE_IN } });
+    tl.addTrack(colIn, { { 0, 0, Easing::LINEAR }, { start, 0, Easing::LINEAR },
+                         { (uint16_t)(start + fade), 255, Easing::EASE_OUT } });
+  }
+  tl.addTrack(both, { { 0, 255, Easing::LINEAR }, { durationMs, 255, Easing::LINEAR } });
+}
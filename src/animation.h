@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+#include <initializer_list>
+#include <vector>
+
+// Keyframe animation on per-LED levels (0 = off, 255 = full colour).
+// Interpolation is integer fixed point with precomputed easing tables, so a
+// frame for all LEDs costs a few table lookups per track.
+
+enum class Easing : uint8_t {
+  LINEAR = 0,
+  EASE_IN,
+  EASE_OUT,
+  EASE_IN_OUT,
+};
+
+struct Keyframe {
+  uint16_t atMs;   // from the start of the timeline
+  uint8_t level;
+  Easing ease;     // curve used to arrive at this keyframe
+};
+
+// Level between two keyframe values after `elapsed` of `span` ms
+uint8_t easeLevel(uint8_t from, uint8_t to, uint32_t elapsed, uint32_t span, Easing ease);
+
+class Timeline {
+public:
+  static const uint8_t MAX_KEYS = 4;
+
+  void clear();
+  bool empty() const { return tracks.empty(); }
+  uint32_t durationMs() const { return duration; }
+
+  // All `leds` follow the same keyframes (sorted by time, at most MAX_KEYS)
+  void addTrack(const std::vector<uint16_t>& leds, std::initializer_list<Keyframe> keys);
+
+  // Fills levels[count] for time t; where tracks overlap the brightest wins.
+  // After the last keyframe every track holds its final level.
+  void render(uint32_t tMs, uint8_t* levels, uint16_t count) const;
+
+private:
+  struct Track {
+    std::vector<uint16_t> leds;
+    Keyframe keys[MAX_KEYS];
+    uint8_t keyCount;
+  };
+  std::vector<Track> tracks;
+  uint32_t duration = 0;
+};
+
+// Phrase transitions. `from` is what is lit now, `to` the new phrase.
+// Words fade in one after another, starting stepMs apart
+void buildWordFadeIn(Timeline& tl, const std::vector<std::vector<uint16_t>>& words, uint16_t stepMs, uint16_t fadeMs);
+// Old-only LEDs fade out while new-only LEDs fade in; shared LEDs stay lit
+void buildCrossfade(Timeline& tl, const std::vector<uint16_t>& from, const std::vector<uint16_t>& to, uint16_t durationMs);
+// Left-to-right sweep over the grid columns, each column crossfading briefly
+void buildWipe(Timeline& tl, const std::vector<uint16_t>& from, const std::vector<uint16_t>& to, uint16_t durationMs);
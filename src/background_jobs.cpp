@@ -0,0 +1,145 @@
+#include "background_jobs.h"
+#include "log.h"
+
+struct JobSlot {
+  JobStatus status = {};
+  JobFn fn;
+};
+
+static JobSlot slots[JOB_SLOTS];
+static uint32_t lastId = 0;
+static SemaphoreHandle_t jobLock = nullptr;
+static TaskHandle_t worker = nullptr;
+
+static bool unfinished(const JobStatus& s) {
+  return s.id != 0 && (s.state == JOB_QUEUED || s.state == JOB_RUNNING);
+}
+
+// Oldest queued job, under jobLock
+static JobSlot* nextQueued() {
+  JobSlot* next = nullptr;
+  for (auto& s : slots) {
+    if (s.status.id != 0 && s.status.state == JOB_QUEUED && (!next || s.status.id < next->status.id)) next = &s;
+  }
+  return next;
+}
+
+static void jobTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    for (;;) {
+      xSemaphoreTake(jobLock, portMAX_DELAY);
+      JobSlot* slot = nextQueued();
+      if (!slot) {
+        xSemaphoreGive(jobLock);
+        break;
+      }
+      slot->status.state = JOB_RUNNING;
+      const uint32_t id = slot->status.id;
+      JobFn fn = slot->fn;
+      slot->fn = nullptr;
+      xSemaphoreGive(jobLock);
+
+      String message;
+      const bool ok = fn(message);
+
+      xSemaphoreTake(jobLock, portMAX_DELAY);
+      if (slot->status.id == id) {
+        slot->status.state = ok ? JOB_DONE : JOB_FAILED;
+        slot->status.message = message;
+        slot->status.finishedMs = millis();
+        if (slot->status.finishedMs == 0) slot->status.finishedMs = 1;
+      }
+      xSemaphoreGive(jobLock);
+    }
+  }
+}
+
+void jobsBegin() {
+  if (jobLock) return;
+  jobLock = xSemaphoreCreateMutex();
+  // Network core, below the WiFi stack: jobs are mostly waiting on sockets
+  if (xTaskCreatePinnedToCore(jobTask, "jobs", JOB_TASK_STACK, nullptr, 1, &worker, 0) != pdPASS) {
+    logError("❌ Background job task start failed");
+  }
+}
+
+uint32_t jobStart(const char* name, JobFn fn) {
+  if (!jobLock || !worker) return 0;
+  xSemaphoreTake(jobLock, portMAX_DELAY);
+  // Reuse the oldest finished slot
+  JobSlot* slot = nullptr;
+  for (auto& s : slots) {
+    if (unfinished(s.status)) continue;
+    if (!slot || s.status.id < slot->status.id) slot = &s;
+  }
+  uint32_t id = 0;
+  if (slot) {
+    id = ++lastId;
+    slot->status = JobStatus();
+    slot->status.id = id;
+    slot->status.name = name;
+    slot->status.state = JOB_QUEUED;
+    slot->status.startedMs = millis();
+    slot->fn = fn;
+  }
+  xSemaphoreGive(jobLock);
+  if (id) {
+    logInfof("🧵 Job %lu (%s) queued", (unsigned long)id, name);
+    xTaskNotifyGive(worker);
+  }
+  return id;
+}
+
+uint32_t jobActive(const char* name) {
+  if (!jobLock) return 0;
+  uint32_t id = 0;
+  xSemaphoreTake(jobLock, portMAX_DELAY);
+  for (const auto& s : slots) {
+    if (unfinished(s.status) && s.status.name == name) id = s.status.id;
+  }
+  xSemaphoreGive(jobLock);
+  return id;
+}
+
+bool jobGet(uint32_t id, JobStatus& out) {
+  if (!jobLock || id == 0) return false;
+  bool found = false;
+  xSemaphoreTake(jobLock, portMAX_DELAY);
+  for (const auto& s : slots) {
+    if (s.status.id == id) {
+      out = s.status;
+      found = true;
+    }
+  }
+  xSemaphoreGive(jobLock);
+  return found;
+}
+
+size_t jobList(JobStatus* out, size_t max) {
+  if (!jobLock) return 0;
+  size_t n = 0;
+  xSemaphoreTake(jobLock, portMAX_DELAY);
+  for (const auto& s : slots) {
+    if (s.status.id == 0 || n >= max) continue;
+    // Insertion sort, newest first
+    size_t i = n++;
+    while (i > 0 && out[i - 1].id < s.status.id) {
+      out[i] = out[i - 1];
+      i--;
+    }
+    out[i] = s.status;
+  }
+  xSemaphoreGive(jobLock);
+  return n;
+}
+
+const char* jobStateName(JobState state) {
+  switch (state) {
+    case JOB_QUEUED:  return "queued";
+    case JOB_RUNNING: return "running";
+    case JOB_DONE:    return "done";
+    case JOB_FAILED:  return "failed";
+  }
+  return "unknown";
+}
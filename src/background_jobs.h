@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+#include <functional>
+
+// Slow work (HTTPS update checks, broker probes) runs on a worker task
+// instead of inside a web handler or loop(), so requests, rendering and MQTT
+// keep going meanwhile. Jobs run one at a time in the order they were
+// started; the UI follows them through /api/jobs.
+//
+// Long responses do not block loop() either: /log/stream and /log/download
+// and UI pages overridden on flash hand their connection to a pump fed from
+// loop() (log_stream.h, file_stream.h).
+
+#define JOB_SLOTS 6           // queued, running and recently finished jobs
+#define JOB_TASK_STACK 10240  // TLS handshakes need the room
+
+enum JobState : uint8_t { JOB_QUEUED, JOB_RUNNING, JOB_DONE, JOB_FAILED };
+
+struct JobStatus {
+  uint32_t id;
+  String name;
+  JobState state;
+  String message;
+  uint32_t startedMs;   // when it was queued
+  uint32_t finishedMs;  // 0 while queued or running
+};
+
+// Returns success; `message` becomes the job's result text
+typedef std::function<bool(String& message)> JobFn;
+
+// Starts the worker task
+void jobsBegin();
+// Queues a job and returns its id; 0 when every slot holds an unfinished job
+uint32_t jobStart(const char* name, JobFn fn);
+// Id of a queued or running job with this name, 0 if none
+uint32_t jobActive(const char* name);
+bool jobGet(uint32_t id, JobStatus& out);
+// Most recent first; returns the number written
+size_t jobList(JobStatus* out, size_t max);
+const char* jobStateName(JobState state);
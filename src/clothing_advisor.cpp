@@ -4,6 +4,8 @@
 #include <math.h>
 #include <time.h>
 
+#include "virtual_clock.h"
+
 namespace {
 const char* kModeNow = "now";
 const char* kModeToday = "today";
@@ -23,7 +25,7 @@ time_t roundUpToNextHour(time_t ts) {
 }
 
 void collectNowWindow(const WeatherData& data, WindowResult& result) {
-  time_t now = time(nullptr);
+  time_t now = clockNow();
   time_t start = roundUpToNextHour(now);
   for (size_t i = 0; i < data.hourlyCount && result.count < 3; ++i) {
     time_t ts = data.hourlyTimestamps[i];
@@ -54,7 +56,7 @@ void collectRangeWindow(const WeatherData& data, time_t start, time_t end, Windo
 }
 
 void collectTodayWindow(const WeatherData& data, WindowResult& result) {
-  time_t now = time(nullptr);
+  time_t now = clockNow();
   struct tm localNow;
   localtime_r(&now, &localNow);
 
@@ -4,13 +4,32 @@
 #include "grid_layout.h"
 #include "display_settings.h"
 #include "time_sync.h"
+#include "animation.h"
+#include "virtual_clock.h"
 
+// Upper bound for a single sleep; every wake re-derives the next deadline
+static const unsigned long MAX_SLEEP_MS = 60000UL;
+static const unsigned long WORD_STEP_MS = 500UL;
+static const unsigned long NO_TIME_CYCLE_MS = 5000UL;
+static const unsigned long NO_TIME_ON_MS = 500UL;
+// Keyframe transitions run at a steady ~60 fps
+static const unsigned long ANIMATION_FRAME_MS = 16UL;
+static const uint16_t WORD_FADE_MS = 400;
+static const uint16_t TRANSITION_MS = 1200;
 
+static unsigned long g_nextWakeAt = 0;
+static bool g_refreshRequested = true;
+static uint32_t g_wakeups = 0;
+static uint32_t g_wakeupsLastMinute = 0;
+static unsigned long g_wakeWindowStart = 0;
 
 static bool g_forceAnim = false;
 static struct tm g_forcedTime = {};
 static unsigned long g_noTimeIndicatorStart = 0;
 static std::vector<uint16_t> g_noTimeIndicatorLeds;
+static std::vector<uint16_t> g_shownLeds; // last steady-state frame, start of crossfades/wipes
+static Timeline g_timeline;
+static uint8_t g_levels[NUM_LEDS];
 static bool g_loggedInitialTimeFailure = false;
 
 static void ensureNoTimeIndicatorLeds() {
@@ -21,18 +40,20 @@ static void ensureNoTimeIndicatorLeds() {
   }
 }
 
-static void showNoTimeIndicator(unsigned long nowMs) {
+// Shows the blink state for nowMs and returns the time until the next edge
+static unsigned long showNoTimeIndicator(unsigned long nowMs) {
   ensureNoTimeIndicatorLeds();
   if (g_noTimeIndicatorStart == 0) {
     g_noTimeIndicatorStart = nowMs;
   }
   const unsigned long elapsed = nowMs - g_noTimeIndicatorStart;
-  const unsigned long phase = elapsed % 5000UL; // 5 second cycle
-  if (phase < 500UL) {
+  const unsigned long phase = elapsed % NO_TIME_CYCLE_MS; // 5 second cycle
+  if (phase < NO_TIME_ON_MS) {
     showLeds(g_noTimeIndicatorLeds);
-  } else {
-    showLeds({});
+    return NO_TIME_ON_MS - phase;
   }
+  showLeds({});
+  return NO_TIME_CYCLE_MS - phase;
 }
 
 static void resetNoTimeIndicator() {
@@ -40,6 +61,32 @@ static void resetNoTimeIndicator() {
   g_noTimeIndicatorLeds.clear();
 }
 
+// Builds the keyframe transition for the active style; false for the legacy word append
+static bool buildTransition(const std::vector<std::vector<uint16_t>>& segments) {
+  std::vector<uint16_t> target;
+  for (const auto& seg : segments) target.insert(target.end(), seg.begin(), seg.end());
+  switch (displaySettings.getAnimationStyle()) {
+    case AnimationStyle::FADE:
+      buildWordFadeIn(g_timeline, segments, WORD_STEP_MS, WORD_FADE_MS);
+      return true;
+    case AnimationStyle::CROSSFADE:
+      buildCrossfade(g_timeline, g_shownLeds, target, TRANSITION_MS);
+      return true;
+    case AnimationStyle::WIPE:
+      buildWipe(g_timeline, g_shownLeds, target, TRANSITION_MS);
+      return true;
+    case AnimationStyle::WORDS:
+    default:
+      g_timeline.clear();
+      return false;
+  }
+}
+
+static void scheduleWake(unsigned long nowMs, unsigned long delayMs) {
+  if (delayMs > MAX_SLEEP_MS) delayMs = MAX_SLEEP_MS;
+  g_nextWakeAt = nowMs + delayMs;
+}
+
 void clothingDisplaySetup() {
   // ledState.begin() is initialized in main
   initLeds();
@@ -48,46 +95,44 @@ void clothingDisplaySetup() {
 
 void clothingDisplayLoop() {
   static bool animating = false;
+  static bool keyframed = false; // animating via g_timeline instead of word append
+  static unsigned long animStart = 0;
   static unsigned long lastStepAt = 0;
   static int animStep = 0;
   static int lastRounded = -1;
   static std::vector<std::vector<uint16_t>> segments;
   static std::vector<uint16_t> cumulative;
   static unsigned long hetIsVisibleUntil = 0; // millis timestamp when HET+IS should turn off
-  // Cache time to avoid calling getLocalTime() every 50ms
+  // Last known (virtual) time, kept when a later clockLocalTime() fails
   static struct tm cachedTime = {};
   static bool haveTime = false;
-  static unsigned long lastTimeFetchMs = 0;
+
+  unsigned long nowMs = millis();
 
   if (!clockEnabled) {
     animating = false;
     showLeds({});
+    g_shownLeds.clear();
     resetNoTimeIndicator();
+    scheduleWake(nowMs, MAX_SLEEP_MS); // toggling the clock requests a refresh
     return;
   }
 
-  // Refresh cached time at most once per second
-  unsigned long nowMs = millis();
-  if (!haveTime || (nowMs - lastTimeFetchMs) >= 1000UL) {
-    struct tm t = {};
-    if (getLocalTime(&t)) {
-      cachedTime = t;
-      haveTime = true;
-      lastTimeFetchMs = nowMs;
-      g_initialTimeSyncSucceeded = true;
-      g_loggedInitialTimeFailure = false;
-      resetNoTimeIndicator();
-    } else if (!haveTime) {
-      if (!g_loggedInitialTimeFailure) {
-        logWarn("❗ Unable to fetch time; showing no-time indicator");
-        g_loggedInitialTimeFailure = true;
-      }
-      showNoTimeIndicator(nowMs);
-      return;
+  struct tm t = {};
+  if (clockLocalTime(&t)) {
+    cachedTime = t;
+    haveTime = true;
+    g_initialTimeSyncSucceeded = true;
+    g_loggedInitialTimeFailure = false;
+    resetNoTimeIndicator();
+  } else if (!haveTime) {
+    if (!g_loggedInitialTimeFailure) {
+      logWarn("❗ Unable to fetch time; showing no-time indicator");
+      g_loggedInitialTimeFailure = true;
     }
-  }
-  if (!haveTime) {
-    showNoTimeIndicator(nowMs);
+    // Retry the time at least every second while blinking
+    unsigned long edge = showNoTimeIndicator(nowMs);
+    scheduleWake(nowMs, edge < 1000UL ? edge : 1000UL);
     return;
   }
   struct tm timeinfo = cachedTime;
@@ -96,9 +141,7 @@ void clothingDisplayLoop() {
   static int lastLoggedMinute = -1;
   if (timeinfo.tm_min != lastLoggedMinute) {
     lastLoggedMinute = timeinfo.tm_min;
-    char buf[20];
-    snprintf(buf, sizeof(buf), "🔄 %02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
-    logDebug(String(buf));
+    logDebugf("🔄 %02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
   }
 
   // Determine current rounded bucket and extra minutes
@@ -124,15 +167,17 @@ void clothingDisplayLoop() {
       segments = get_word_segments_for_time(&animTime);
       // Respect setting: if duration==0, skip HET/IS entirely (both animation and steady state)
       uint16_t hisSec = displaySettings.getHetIsDurationSec();
-      if (hisSec == 0 && segments.size() >= 2) {
-        segments.erase(segments.begin(), segments.begin() + 2); // drop HET and IS
+      if (hisSec == 0 && segments.size() >= ACTIVE_PHRASE_PREFIX_WORDS) {
+        segments.erase(segments.begin(), segments.begin() + ACTIVE_PHRASE_PREFIX_WORDS); // drop HET and IS
       }
       cumulative.clear();
       animStep = 0;
-      lastStepAt = millis();
+      lastStepAt = nowMs;
+      animStart = nowMs;
+      keyframed = buildTransition(segments);
       animating = true;
       hetIsVisibleUntil = 0; // reset; will be set when animation completes
-  logDebug("🎞️ Start animation to new text");
+  logDebugf("🎞️ Start animation to new text");
       g_forceAnim = false;
     } else {
       // No animation: immediately consider the animation 'completed' for timer purposes
@@ -143,28 +188,41 @@ void clothingDisplayLoop() {
       } else if (hisSec == 0) {
         hetIsVisibleUntil = 1; // hidden immediately
       } else {
-        hetIsVisibleUntil = millis() + (unsigned long)hisSec * 1000UL;
+        hetIsVisibleUntil = nowMs + clockRealMs((unsigned long)hisSec * 1000UL);
       }
       g_forceAnim = false;
     }
   }
 
-  // During animation: add next word every 500ms
-  if (animating) {
-    unsigned long now = millis();
-    if (animStep == 0 || now - lastStepAt >= 500) {
+  if (animating && keyframed) {
+    // Keyframed transition: render the timeline at a steady frame rate
+    const unsigned long elapsed = nowMs - animStart;
+    g_timeline.render(elapsed, g_levels, NUM_LEDS);
+    showLedLevels(g_levels);
+    if (elapsed < g_timeline.durationMs()) {
+      scheduleWake(nowMs, ANIMATION_FRAME_MS);
+      return;
+    }
+    animStep = (int)segments.size();
+  } else if (animating) {
+    // Word append: add next word every 500ms
+    if (animStep == 0 || nowMs - lastStepAt >= WORD_STEP_MS) {
       if (animStep < (int)segments.size()) {
         // Append this segment
         const auto &seg = segments[animStep];
         cumulative.insert(cumulative.end(), seg.begin(), seg.end());
         animStep++;
-        lastStepAt = now;
+        lastStepAt = nowMs;
       }
     }
     // Show accumulated words (no extra minutes yet at a 5-min boundary)
     showLeds(cumulative);
+  }
+
+  if (animating) {
     if (animStep >= (int)segments.size()) {
       animating = false;
+      keyframed = false;
       // Start timer for hiding HET+IS now that full text is shown
       uint16_t hisSec = displaySettings.getHetIsDurationSec();
       if (hisSec >= 360) {
@@ -172,10 +230,16 @@ void clothingDisplayLoop() {
       } else if (hisSec == 0) {
         hetIsVisibleUntil = 1; // already expired -> hide immediately
       } else {
-        hetIsVisibleUntil = millis() + (unsigned long)hisSec * 1000UL;
+        hetIsVisibleUntil = nowMs + clockRealMs((unsigned long)hisSec * 1000UL);
+      }
+      if (hisSec >= 360 || hisSec == 0) {
+        logDebugf("Animation completed; segments=%u, HET IS duration=%s", (unsigned)segments.size(), hisSec == 0 ? "off" : "always");
+      } else {
+        logDebugf("Animation completed; segments=%u, HET IS duration=%us", (unsigned)segments.size(), (unsigned)hisSec);
       }
-  logDebug(String("Animation completed; segments=") + segments.size() + String(", HET IS duration=") + (hisSec>=360?"always": (hisSec==0?"off":String(hisSec)+"s")));
     }
+    // Next word at the step deadline; once complete, switch to the steady state right away
+    scheduleWake(nowMs, animating ? WORD_STEP_MS - (nowMs - lastStepAt) : 0);
     return;
   }
 
@@ -188,17 +252,17 @@ void clothingDisplayLoop() {
   bool hideHetIs = false;
   if (hisSec == 0) hideHetIs = true;              // never show
   else if (hisSec < 360) {
-    hideHetIs = (hetIsVisibleUntil != 0) && (millis() >= hetIsVisibleUntil);
+    hideHetIs = (hetIsVisibleUntil != 0) && (nowMs >= hetIsVisibleUntil);
   } // hisSec>=360 => always show
 
   if (hideHetIs && !lastHetIsHidden) {
-  logDebug("'HET IS' hidden after configured duration");
+  logDebugf("'HET IS' hidden after configured duration");
   }
   lastHetIsHidden = hideHetIs;
 
   for (size_t si = 0; si < baseSegs.size(); ++si) {
-    // baseSegs[0] == HET, baseSegs[1] == IS per mapper design
-    if (hideHetIs && (si == 0 || si == 1)) continue;
+    // The first ACTIVE_PHRASE_PREFIX_WORDS segments are HET IS (or IT IS)
+    if (hideHetIs && si < ACTIVE_PHRASE_PREFIX_WORDS) continue;
     const auto &seg = baseSegs[si];
     indices.insert(indices.end(), seg.begin(), seg.end());
   }
@@ -206,10 +270,42 @@ void clothingDisplayLoop() {
     indices.push_back(EXTRA_MINUTE_LEDS[i]);
   }
   showLeds(indices);
+  g_shownLeds = indices;
+
+  // Nothing changes until the next minute, unless HET IS still has to go
+  unsigned long sleepMs = clockMsUntilNextMinute();
+  if (hisSec > 0 && hisSec < 360 && !hideHetIs && hetIsVisibleUntil > nowMs) {
+    unsigned long untilHide = hetIsVisibleUntil - nowMs;
+    if (untilHide < sleepMs) sleepMs = untilHide;
+  }
+  scheduleWake(nowMs, sleepMs);
+}
+
+bool clothingDisplayDue(unsigned long nowMs) {
+  if (nowMs - g_wakeWindowStart >= 60000UL) {
+    g_wakeupsLastMinute = g_wakeups;
+    g_wakeups = 0;
+    g_wakeWindowStart = nowMs;
+    logDebugf("⏰ Display wakeups last minute: %lu, LED frames shown/skipped: %lu/%lu",
+              (unsigned long)g_wakeupsLastMinute, (unsigned long)ledFramesShown(), (unsigned long)ledFramesSkipped());
+  }
+  if (!g_refreshRequested && (long)(nowMs - g_nextWakeAt) < 0) return false;
+  g_refreshRequested = false;
+  g_wakeups++;
+  return true;
+}
+
+void clothingDisplayRequestRefresh() {
+  g_refreshRequested = true;
+}
+
+uint32_t clothingDisplayWakeupsLastMinute() {
+  return g_wakeupsLastMinute;
 }
 
 void clothingDisplayForceAnimationForTime(struct tm* timeinfo) {
   if (!timeinfo) return;
   g_forcedTime = *timeinfo;
   g_forceAnim = true;
+  clothingDisplayRequestRefresh();
 }
@@ -13,6 +13,15 @@ extern bool clockEnabled;
 void clothingDisplaySetup();
 void clothingDisplayLoop();
 
+// Deadline scheduling: clothingDisplayLoop() records when the display next
+// changes (animation step, HET IS hide, minute boundary, no-time blink) and
+// clothingDisplayDue() reports whether that moment, or a requested refresh,
+// has arrived.
+bool clothingDisplayDue(unsigned long nowMs);
+// Redraw on the next loop, e.g. after colour, brightness or setting changes
+void clothingDisplayRequestRefresh();
+uint32_t clothingDisplayWakeupsLastMinute();
+
 // Force the word-by-word animation to render a specific time
 void clothingDisplayForceAnimationForTime(struct tm* timeinfo);
 
@@ -4,7 +4,9 @@
 #include "log.h"
 
 // Legacy display logic (ex-Wordclock) to be replaced by the clothing advisor loop
-// Called periodically from the main loop while the refactor is in progress.
+// Called from every main loop pass; only does work once the display's next
+// deadline has passed or a refresh was requested.
 inline void runClothingDisplayLoop() {
+    if (!clothingDisplayDue(millis())) return;
     clothingDisplayLoop();
 }
@@ -1,6 +1,26 @@
 // Log buffer and default log level
 #define DEFAULT_LOG_LEVEL LOG_LEVEL_INFO
-#define LOG_BUFFER_SIZE 150
+// Log history arena (bytes) and longest stored line
+#define LOG_ARENA_SIZE 10240
+#define LOG_RECORD_MAX 480
+// log*f() calls store a format ID and packed arguments instead of text
+// (log_binary.h); set to 0 to store formatted text
+#ifndef LOG_BINARY
+#define LOG_BINARY 1
+#endif
+// Also print binary records to Serial (formats every line on the device)
+#ifndef LOG_SERIAL_ECHO
+#define LOG_SERIAL_ECHO 1
+#endif
+// Longest %s argument kept in a binary record
+#define LOG_ARG_STRING_MAX 64
+// Log files on flash (log_file.h): LOG_FILE_COUNT files of at most
+// LOG_FILE_MAX_BYTES, written in batches of LOG_FILE_CHUNK bytes (a multiple
+// of the 256-byte flash page) or after LOG_FILE_FLUSH_MS
+#define LOG_FILE_COUNT 4
+#define LOG_FILE_MAX_BYTES 32768
+#define LOG_FILE_CHUNK 2048
+#define LOG_FILE_FLUSH_MS 60000
 #pragma once
 
 #define FIRMWARE_VERSION "0.9"
@@ -10,6 +30,42 @@
 #define DATA_PIN 4
 #define DEFAULT_BRIGHTNESS 5
 
+// LED output backend, chosen at build time (e.g. build_flags = -DLED_BACKEND=LED_BACKEND_RMT)
+// NEOPIXEL: Adafruit_NeoPixel::show(), blocks for the whole transfer
+// RMT: non-blocking RMT output with double-buffered frames (led_rmt.cpp)
+// VIRTUAL: records frames in memory (virtual_led_sink.h), default for host builds
+#define LED_BACKEND_NEOPIXEL 0
+#define LED_BACKEND_RMT 1
+#define LED_BACKEND_VIRTUAL 2
+#ifndef LED_BACKEND
+#ifdef ARDUINO
+#define LED_BACKEND LED_BACKEND_NEOPIXEL
+#else
+#define LED_BACKEND LED_BACKEND_VIRTUAL
+#endif
+#endif
+
+// Output gamma, and temporal dithering at or below this brightness (0 = off).
+// Dithering needs a sink whose show() does not block (LedSink::minFrameUs(),
+// e.g. LED_BACKEND_RMT): the render task then refreshes the strip once per
+// sink frame time, rounded up to whole ticks. A fraction that would toggle
+// its LED slower than LED_DITHER_MIN_HZ at that rate is truncated or rounded
+// up instead; the blocking NeoPixel sink always truncates.
+// The current limiter recovers in steps every LED_LIMIT_FRAME_MS.
+#define LED_OUTPUT_GAMMA 2.2f
+#define LED_DITHER_MAX_BRIGHTNESS 48
+#define LED_DITHER_MIN_HZ 60
+#define LED_LIMIT_FRAME_MS 10
+
+// Current estimate per channel at full duty and per idle LED (SK6812 RGBW),
+// and the default supply budget the output is limited to (0 = unlimited)
+#define LED_MA_RED 12
+#define LED_MA_GREEN 12
+#define LED_MA_BLUE 12
+#define LED_MA_WHITE 20
+#define LED_MA_IDLE 1
+#define LED_POWER_BUDGET_DEFAULT_MA 2000
+
 #define CLOCK_NAME "Can I Wear Shorts"
 #define AP_NAME "CanIWearShorts_AP"
 #define OTA_HOSTNAME "can-i-wear-shorts"
@@ -38,4 +94,3 @@
 
 constexpr unsigned long SWEEP_STEP_MS = 20;
 constexpr unsigned long IP_STEP_MS = 1000;
-constexpr uint16_t IP_ZERO_O_LED_INDEX = 56;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "led_state.h"
+#include "palette_settings.h"
+#include "night_dimming.h"
 #include "display_settings.h"
 #include "log.h"
 
@@ -9,6 +11,8 @@
 // Ensures the clock starts up with correct color and brightness.
 inline void initDisplay() {
     ledState.begin();
+    paletteSettings.begin();
+    nightDimSettings.begin();
     displaySettings.begin();
     const GridVariantInfo* info = getGridVariantInfo(displaySettings.getGridVariant());
     if (info) {
@@ -5,6 +5,15 @@
 
 constexpr GridVariant FIRMWARE_DEFAULT_GRID_VARIANT = GridVariant::NL_V4;
 
+// How a new phrase appears when word animation is on
+enum class AnimationStyle : uint8_t {
+  WORDS = 0,   // append one word every 500 ms (original behaviour)
+  FADE,        // words fade in one after another
+  CROSSFADE,   // old phrase fades out while the new one fades in
+  WIPE,        // left-to-right column sweep
+};
+constexpr uint8_t ANIMATION_STYLE_COUNT = 4;
+
 class DisplaySettings {
 public:
   void begin() {
@@ -13,7 +22,10 @@ public:
     if (hetIsDurationSec > 360) hetIsDurationSec = 360;
     sellMode = prefs.getBool("sell_on", false);
     animateWords = prefs.getBool("anim_on", false); // default OFF unless enabled via UI
+    uint8_t style = prefs.getUChar("anim_style", 0);
+    animationStyle = style < ANIMATION_STYLE_COUNT ? static_cast<AnimationStyle>(style) : AnimationStyle::WORDS;
     autoUpdate = prefs.getBool("auto_upd", true);
+    fastBoot = prefs.getBool("fast_boot", true);
     const uint8_t defaultVariantId = gridVariantToId(FIRMWARE_DEFAULT_GRID_VARIANT);
     const bool hasGridKey = prefs.isKey("grid_id");
     uint8_t storedVariant = prefs.getUChar("grid_id", defaultVariantId);
@@ -36,7 +48,9 @@ public:
   uint16_t getHetIsDurationSec() const { return hetIsDurationSec; }
   bool isSellMode() const { return sellMode; }
   bool getAnimateWords() const { return animateWords; }
+  AnimationStyle getAnimationStyle() const { return animationStyle; }
   bool getAutoUpdate() const { return autoUpdate; }
+  bool getFastBoot() const { return fastBoot; }
   GridVariant getGridVariant() const { return gridVariant; }
   uint8_t getGridVariantId() const { return gridVariantToId(gridVariant); }
 
@@ -61,6 +75,14 @@ public:
     prefs.end();
   }
 
+  void setAnimationStyle(AnimationStyle style) {
+    if (static_cast<uint8_t>(style) >= ANIMATION_STYLE_COUNT) return;
+    animationStyle = style;
+    prefs.begin("display", false);
+    prefs.putUChar("anim_style", static_cast<uint8_t>(animationStyle));
+    prefs.end();
+  }
+
   void setAutoUpdate(bool on) {
     autoUpdate = on;
     prefs.begin("display", false);
@@ -68,6 +90,14 @@ public:
     prefs.end();
   }
 
+  // Fast boot plays the short startup sequence (parallel sweep)
+  void setFastBoot(bool on) {
+    fastBoot = on;
+    prefs.begin("display", false);
+    prefs.putBool("fast_boot", fastBoot);
+    prefs.end();
+  }
+
   void setGridVariant(GridVariant variant) {
     if (!setActiveGridVariant(variant)) {
       return;
@@ -91,7 +121,9 @@ private:
   uint16_t hetIsDurationSec = 360; // default ALWAYS
   bool sellMode = false;
   bool animateWords = false; // default OFF
+  AnimationStyle animationStyle = AnimationStyle::WORDS;
   bool autoUpdate = true;    // default ON to keep current behavior
+  bool fastBoot = true;
   GridVariant gridVariant = FIRMWARE_DEFAULT_GRID_VARIANT;
   Preferences prefs;
 };
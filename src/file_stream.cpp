@@ -0,0 +1,122 @@
+#include "file_stream.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <Arduino.h>
+#include <errno.h>
+#include <lwip/sockets.h>
+
+static const size_t CHUNK = 1024;
+
+struct FileDownload {
+  bool active = false;
+  WiFiClient client;
+  File files[FILE_STREAM_MAX_FILES];
+  size_t sizes[FILE_STREAM_MAX_FILES];
+  uint8_t count = 0;
+  uint8_t current = 0;
+  size_t sent = 0;  // of the current file
+  FileStreamDone done = nullptr;
+  uint32_t lastSendMs = 0;
+  char pending[CHUNK];
+  size_t pendingLen = 0;
+  size_t pendingOff = 0;
+};
+
+static FileDownload downloads[FILE_STREAM_MAX_CLIENTS];
+
+static void finish(FileDownload& d) {
+  d.client.stop();
+  for (uint8_t i = 0; i < d.count; i++) d.files[i].close();
+  d.active = false;
+  d.pendingLen = d.pendingOff = 0;
+  if (d.done) d.done();
+}
+
+// Sends as much pending data as the socket takes without waiting
+static bool flushPending(FileDownload& d) {
+  while (d.pendingOff < d.pendingLen) {
+    const int n = send(d.client.fd(), d.pending + d.pendingOff, d.pendingLen - d.pendingOff, MSG_DONTWAIT);
+    if (n > 0) {
+      d.pendingOff += (size_t)n;
+      d.lastSendMs = millis();
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return false;
+    finish(d);  // closed or reset by the browser
+    return false;
+  }
+  d.pendingLen = d.pendingOff = 0;
+  return true;
+}
+
+// Reads the next chunk into the (empty) pending buffer; false at the end
+static bool fillPending(FileDownload& d) {
+  while (d.current < d.count) {
+    const size_t left = d.sizes[d.current] - d.sent;
+    const int n = left > 0 ? d.files[d.current].read((uint8_t*)d.pending, left < CHUNK ? left : CHUNK) : 0;
+    if (n > 0) {
+      d.sent += (size_t)n;
+      d.pendingLen = (size_t)n;
+      return true;
+    }
+    if (left > 0) {
+      // A file that came up short would leave the response short of its
+      // Content-Length; closing tells the browser it is incomplete
+      d.current = d.count;
+      return false;
+    }
+    d.current++;
+    d.sent = 0;
+  }
+  return false;
+}
+
+bool fileStreamAttach(WiFiClient& client, const String& head, File* files, uint8_t count, FileStreamDone done) {
+  FileDownload* slot = nullptr;
+  for (auto& d : downloads) {
+    if (!d.active && !slot) slot = &d;
+  }
+  if (!slot || count > FILE_STREAM_MAX_FILES) return false;
+
+  size_t total = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    slot->files[i] = files[i];
+    slot->sizes[i] = files[i].size();
+    total += slot->sizes[i];
+  }
+  // Headers written directly: the response outlives the handler
+  client.print(head + "Content-Length: " + total + "\r\nConnection: close\r\n\r\n");
+  slot->client = client;  // shares the socket; WebServer releasing its copy does not close it
+  slot->active = true;
+  slot->count = count;
+  slot->current = 0;
+  slot->sent = 0;
+  slot->done = done;
+  slot->pendingLen = slot->pendingOff = 0;
+  slot->lastSendMs = millis();
+  return true;
+}
+
+void fileStreamLoop() {
+  for (auto& d : downloads) {
+    if (!d.active) continue;
+    if (d.pendingLen > 0 && !flushPending(d)) {
+      if (d.active && millis() - d.lastSendMs >= FILE_STREAM_STALL_MS) finish(d);
+      continue;
+    }
+    if (!fillPending(d)) {
+      finish(d);
+      continue;
+    }
+    flushPending(d);
+  }
+}
+
+uint8_t fileStreamClients() {
+  uint8_t n = 0;
+  for (auto& d : downloads) n += d.active ? 1 : 0;
+  return n;
+}
+
+#endif
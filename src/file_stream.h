@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// Long file responses (log downloads, UI pages overridden on flash) sent
+// from loop() a chunk per pass instead of inside the request handler, so
+// the web server, MQTT and the display keep running while a slow client
+// downloads. Writes are non-blocking; a client that takes nothing for
+// FILE_STREAM_STALL_MS is dropped.
+
+#define FILE_STREAM_MAX_CLIENTS 2
+#define FILE_STREAM_MAX_FILES 4
+#define FILE_STREAM_STALL_MS 10000
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <WiFiClient.h>
+#include <FS.h>
+
+// Called once the response is sent or dropped (e.g. to release a lock)
+typedef void (*FileStreamDone)();
+
+// Takes over the request's connection: writes `head` (status line and
+// headers, each ending in \r\n) with a Content-Length for all files, then
+// the files in order, each up to the size it had here. Takes the open
+// files; `done` runs when the response ends. False when every slot is
+// taken, in which case nothing was sent and the caller keeps the files.
+bool fileStreamAttach(WiFiClient& client, const String& head, File* files, uint8_t count, FileStreamDone done);
+// Feeds the downloads; call every loop pass
+void fileStreamLoop();
+uint8_t fileStreamClients();
+#endif
@@ -0,0 +1,19 @@
+#include "fs_compat.h"
+#include <Arduino.h>
+
+static SemaphoreHandle_t fsMutex = nullptr;
+
+void fsLockBegin() {
+  if (fsMutex) return;
+  fsMutex = xSemaphoreCreateRecursiveMutex();
+}
+
+void fsLock() {
+  if (!fsMutex) return;
+  xSemaphoreTakeRecursive(fsMutex, portMAX_DELAY);
+}
+
+void fsUnlock() {
+  if (!fsMutex) return;
+  xSemaphoreGiveRecursive(fsMutex);
+}
@@ -7,3 +7,21 @@
 
 #define FS_IMPL SPIFFS
 
+// SPIFFS locks each call, not a sequence of them. Background jobs replace
+// UI files (remove + rename) while loop() serves them; both hold this lock
+// so a page is never opened or streamed halfway through a replace. A page
+// streamed over several loop passes (file_stream.h) keeps one hold until it
+// is sent; the lock is recursive, so loop() can still take it meanwhile.
+// fsLockBegin() runs in setup() before the jobs task starts
+void fsLockBegin();
+void fsLock();
+void fsUnlock();
+
+// Holds fsLock() for the enclosing scope
+class FsLock {
+public:
+  FsLock() { fsLock(); }
+  ~FsLock() { fsUnlock(); }
+  FsLock(const FsLock&) = delete;
+  FsLock& operator=(const FsLock&) = delete;
+};
@@ -1,6 +1,5 @@
 #include "grid_layout.h"
 
-#include <Arduino.h>
 #include <string.h>
 
 #include "grid_variants/en_v1.h"
@@ -25,6 +24,11 @@ struct GridVariantData {
   size_t wordCount;
   const uint16_t* minuteLeds;
   size_t minuteCount;
+  const int16_t* cellLeds;
+  const uint8_t* phraseProgram;
+  const uint8_t* phraseEntry;
+  uint8_t phrasePrefixWords;
+  const uint8_t* hourWords;
 };
 
 // Helper to compute array length at compile time
@@ -32,11 +36,11 @@ template <typename T, size_t N>
 constexpr size_t countof(const T (&)[N]) { return N; }
 
 static const GridVariantData GRID_VARIANTS[] = {
-  { GridVariant::NL_V1, "NL_V1", "Nederlands V1", "nl", "v1", LED_COUNT_GRID_NL_V1, LED_COUNT_EXTRA_NL_V1, LED_COUNT_TOTAL_NL_V1, LETTER_GRID_NL_V1, WORDS_NL_V1, WORDS_NL_V1_COUNT, EXTRA_MINUTES_NL_V1, EXTRA_MINUTES_NL_V1_COUNT },
-  { GridVariant::NL_V2, "NL_V2", "Nederlands V2", "nl", "v2", LED_COUNT_GRID_NL_V2, LED_COUNT_EXTRA_NL_V2, LED_COUNT_TOTAL_NL_V2, LETTER_GRID_NL_V2, WORDS_NL_V2, WORDS_NL_V2_COUNT, EXTRA_MINUTES_NL_V2, EXTRA_MINUTES_NL_V2_COUNT },
-  { GridVariant::NL_V3, "NL_V3", "Nederlands V3", "nl", "v3", LED_COUNT_GRID_NL_V3, LED_COUNT_EXTRA_NL_V3, LED_COUNT_TOTAL_NL_V3, LETTER_GRID_NL_V3, WORDS_NL_V3, WORDS_NL_V3_COUNT, EXTRA_MINUTES_NL_V3, EXTRA_MINUTES_NL_V3_COUNT },
-  { GridVariant::NL_V4, "NL_V4", "Nederlands V4", "nl", "v4", LED_COUNT_GRID_NL_V4, LED_COUNT_EXTRA_NL_V4, LED_COUNT_TOTAL_NL_V4, LETTER_GRID_NL_V4, WORDS_NL_V4, WORDS_NL_V4_COUNT, EXTRA_MINUTES_NL_V4, EXTRA_MINUTES_NL_V4_COUNT },
-  { GridVariant::EN_V1, "EN_V1", "English V1", "en", "v1", LED_COUNT_GRID_EN_V1, LED_COUNT_EXTRA_EN_V1, LED_COUNT_TOTAL_EN_V1, LETTER_GRID_EN_V1, WORDS_EN_V1, WORDS_EN_V1_COUNT, EXTRA_MINUTES_EN_V1, EXTRA_MINUTES_EN_V1_COUNT }
+  { GridVariant::NL_V1, "NL_V1", "Nederlands V1", "nl", "v1", LED_COUNT_GRID_NL_V1, LED_COUNT_EXTRA_NL_V1, LED_COUNT_TOTAL_NL_V1, LETTER_GRID_NL_V1, WORDS_NL_V1, WORDS_NL_V1_COUNT, EXTRA_MINUTES_NL_V1, EXTRA_MINUTES_NL_V1_COUNT, CELL_LEDS_NL_V1, PHRASE_PROGRAM_NL_V1, PHRASE_ENTRY_NL_V1, PHRASE_PREFIX_WORDS_NL_V1, HOUR_WORDS_NL_V1 },
+  { GridVariant::NL_V2, "NL_V2", "Nederlands V2", "nl", "v2", LED_COUNT_GRID_NL_V2, LED_COUNT_EXTRA_NL_V2, LED_COUNT_TOTAL_NL_V2, LETTER_GRID_NL_V2, WORDS_NL_V2, WORDS_NL_V2_COUNT, EXTRA_MINUTES_NL_V2, EXTRA_MINUTES_NL_V2_COUNT, CELL_LEDS_NL_V2, PHRASE_PROGRAM_NL_V2, PHRASE_ENTRY_NL_V2, PHRASE_PREFIX_WORDS_NL_V2, HOUR_WORDS_NL_V2 },
+  { GridVariant::NL_V3, "NL_V3", "Nederlands V3", "nl", "v3", LED_COUNT_GRID_NL_V3, LED_COUNT_EXTRA_NL_V3, LED_COUNT_TOTAL_NL_V3, LETTER_GRID_NL_V3, WORDS_NL_V3, WORDS_NL_V3_COUNT, EXTRA_MINUTES_NL_V3, EXTRA_MINUTES_NL_V3_COUNT, CELL_LEDS_NL_V3, PHRASE_PROGRAM_NL_V3, PHRASE_ENTRY_NL_V3, PHRASE_PREFIX_WORDS_NL_V3, HOUR_WORDS_NL_V3 },
+  { GridVariant::NL_V4, "NL_V4", "Nederlands V4", "nl", "v4", LED_COUNT_GRID_NL_V4, LED_COUNT_EXTRA_NL_V4, LED_COUNT_TOTAL_NL_V4, LETTER_GRID_NL_V4, WORDS_NL_V4, WORDS_NL_V4_COUNT, EXTRA_MINUTES_NL_V4, EXTRA_MINUTES_NL_V4_COUNT, CELL_LEDS_NL_V4, PHRASE_PROGRAM_NL_V4, PHRASE_ENTRY_NL_V4, PHRASE_PREFIX_WORDS_NL_V4, HOUR_WORDS_NL_V4 },
+  { GridVariant::EN_V1, "EN_V1", "English V1", "en", "v1", LED_COUNT_GRID_EN_V1, LED_COUNT_EXTRA_EN_V1, LED_COUNT_TOTAL_EN_V1, LETTER_GRID_EN_V1, WORDS_EN_V1, WORDS_EN_V1_COUNT, EXTRA_MINUTES_EN_V1, EXTRA_MINUTES_EN_V1_COUNT, CELL_LEDS_EN_V1, PHRASE_PROGRAM_EN_V1, PHRASE_ENTRY_EN_V1, PHRASE_PREFIX_WORDS_EN_V1, HOUR_WORDS_EN_V1 }
 };
 
 static const GridVariantData* activeVariant = &GRID_VARIANTS[0];
@@ -48,6 +52,11 @@ void applyActiveVariant(const GridVariantData* data) {
   ACTIVE_WORD_COUNT = data->wordCount;
   EXTRA_MINUTE_LEDS = data->minuteLeds;
   EXTRA_MINUTE_LED_COUNT = data->minuteCount;
+  ACTIVE_CELL_LEDS = data->cellLeds;
+  ACTIVE_PHRASE_PROGRAM = data->phraseProgram;
+  ACTIVE_PHRASE_ENTRY = data->phraseEntry;
+  ACTIVE_PHRASE_PREFIX_WORDS = data->phrasePrefixWords;
+  ACTIVE_HOUR_WORDS = data->hourWords;
 }
 
 const GridVariantData* findVariant(GridVariant variant) {
@@ -77,6 +86,11 @@ const WordPosition* ACTIVE_WORDS = WORDS_NL_V1;
 size_t ACTIVE_WORD_COUNT = WORDS_NL_V1_COUNT;
 const uint16_t* EXTRA_MINUTE_LEDS = EXTRA_MINUTES_NL_V1;
 size_t EXTRA_MINUTE_LED_COUNT = EXTRA_MINUTES_NL_V1_COUNT;
+const int16_t* ACTIVE_CELL_LEDS = CELL_LEDS_NL_V1;
+const uint8_t* ACTIVE_PHRASE_PROGRAM = PHRASE_PROGRAM_NL_V1;
+const uint8_t* ACTIVE_PHRASE_ENTRY = PHRASE_ENTRY_NL_V1;
+uint8_t ACTIVE_PHRASE_PREFIX_WORDS = PHRASE_PREFIX_WORDS_NL_V1;
+const uint8_t* ACTIVE_HOUR_WORDS = HOUR_WORDS_NL_V1;
 
 GridVariant getActiveGridVariant() {
   return activeVariant->variant;
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "wordposition.h"
 
 // Dimensions of the letter grid
@@ -29,6 +30,11 @@ extern const WordPosition* ACTIVE_WORDS;
 extern size_t ACTIVE_WORD_COUNT;
 extern const uint16_t* EXTRA_MINUTE_LEDS;
 extern size_t EXTRA_MINUTE_LED_COUNT;
+extern const int16_t* ACTIVE_CELL_LEDS;        // LED per cell, GRID_WIDTH * GRID_HEIGHT, -1 = not wired
+extern const uint8_t* ACTIVE_PHRASE_PROGRAM;   // see wordposition.h
+extern const uint8_t* ACTIVE_PHRASE_ENTRY;     // program offset per 5-minute bucket
+extern uint8_t ACTIVE_PHRASE_PREFIX_WORDS;     // leading words like "HET IS"
+extern const uint8_t* ACTIVE_HOUR_WORDS;       // 12 word indices, twelve first
 
 // Variant management helpers
 GridVariant getActiveGridVariant();
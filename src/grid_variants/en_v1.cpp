@@ -1,54 +1,85 @@
+// Generated by tools/grid_compiler.py from layouts/en_v1.layout. Do not edit by hand.
 #include "grid_variants/en_v1.h"
 
-// Placeholder: EN_V1 currently reuses the NL_V1 grid until a dedicated layout is supplied.
-const uint16_t LED_COUNT_GRID_EN_V1 = 146;
-const uint16_t LED_COUNT_EXTRA_EN_V1 = 15;
+const uint16_t LED_COUNT_GRID_EN_V1 = 147;
+const uint16_t LED_COUNT_EXTRA_EN_V1 = 14;
 const uint16_t LED_COUNT_TOTAL_EN_V1 = LED_COUNT_GRID_EN_V1 + LED_COUNT_EXTRA_EN_V1;
 
 const char* const LETTER_GRID_EN_V1[] = {
-  "HETBISWYBRC",
-  "RTIENMMUHLC",
-  "VIJFCWKWART",
-  "OVERXTTXLVB",
-  "QKEVOORTFIG",
-  "DRIEKBZEVEN",
-  "VTTIENELNRC",
-  "TWAALFSFRSF",
-  "EENEGENACHT",
-  "XEVIJFJXUUR",
+  "ITLISASAMPM",
+  "ACQUARTERDC",
+  "TWENTYFIVEX",
+  "HALFSTENFTO",
+  "PASTERUNINE",
+  "ONESIXTHREE",
+  "FOURFIVETWO",
+  "EIGHTELEVEN",
+  "SEVENTWELVE",
+  "TENSEOCLOCK",
   "..-.-.-.-.."
 };
 
-const uint16_t EXTRA_MINUTES_EN_V1[] = {
-  static_cast<uint16_t>(LED_COUNT_GRID_EN_V1 + 7),
-  static_cast<uint16_t>(LED_COUNT_GRID_EN_V1 + 9),
-  static_cast<uint16_t>(LED_COUNT_GRID_EN_V1 + 11),
-  static_cast<uint16_t>(LED_COUNT_GRID_EN_V1 + 13)
+const uint16_t EXTRA_MINUTES_EN_V1[] = { 153, 155, 157, 159 };
+
+// LED index per grid cell, row by row (-1 = not wired)
+const int16_t CELL_LEDS_EN_V1[] = {
+    1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,
+   26,  25,  24,  23,  22,  21,  20,  19,  18,  17,  16,
+   31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+   56,  55,  54,  53,  52,  51,  50,  49,  48,  47,  46,
+   61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+   86,  85,  84,  83,  82,  81,  80,  79,  78,  77,  76,
+   91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+  116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106,
+  121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  146, 145, 144, 143, 142, 141, 140, 139, 138, 137, 136,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,  -1
 };
 
 const WordPosition WORDS_EN_V1[] = {
-  { "HET",         { 1, 2, 3 } },
-  { "IS",          { 5, 6 } },
-  { "VIJF_M",      { 31, 32, 33, 34 } },
-  { "TIEN_M",      { 25, 24, 23, 22 } },
-  { "OVER",        { 56, 55, 54, 53 } },
-  { "VOOR",        { 64, 65, 66, 67 } },
-  { "KWART",       { 37, 38, 39, 40, 41 } },
-  { "HALF",        { 18, 39, 48, 69 } },
-  { "UUR",         { 138, 137, 136 } },
-  { "EEN",         { 121, 122, 123 } },
-  { "TWEE",        { 92, 115, 122, 145 } },
-  { "DRIE",        { 86, 85, 84, 83 } },
-  { "VIER",        { 47, 70, 77, 100 } },
-  { "VIJF",        { 144, 143, 142, 141 } },
-  { "ZES",         { 80, 97, 110 } },
-  { "ZEVEN",       { 80, 79, 78, 77, 76 } },
-  { "ACHT",        { 128, 129, 130, 131 } },
-  { "NEGEN",       { 123, 124, 125, 126, 127 } },
-  { "TIEN",        { 93, 94, 95, 96 } },
-  { "ELF",         { 79, 98, 109 } },
-  { "TWAALF",      { 116, 115, 114, 113, 112, 111 } }
+  { "IT",          { 1, 2 } },
+  { "IS",          { 4, 5 } },
+  { "FIVE_M",      { 37, 38, 39, 40 } },
+  { "TEN_M",       { 51, 50, 49 } },
+  { "QUARTER",     { 24, 23, 22, 21, 20, 19, 18 } },
+  { "TWENTY",      { 31, 32, 33, 34, 35, 36 } },
+  { "HALF",        { 56, 55, 54, 53 } },
+  { "PAST",        { 61, 62, 63, 64 } },
+  { "TO",          { 47, 46 } },
+  { "OCLOCK",      { 141, 140, 139, 138, 137, 136 } },
+  { "ONE",         { 86, 85, 84 } },
+  { "TWO",         { 99, 100, 101 } },
+  { "THREE",       { 80, 79, 78, 77, 76 } },
+  { "FOUR",        { 91, 92, 93, 94 } },
+  { "FIVE",        { 95, 96, 97, 98 } },
+  { "SIX",         { 83, 82, 81 } },
+  { "SEVEN",       { 121, 122, 123, 124, 125 } },
+  { "EIGHT",       { 116, 115, 114, 113, 112 } },
+  { "NINE",        { 68, 69, 70, 71 } },
+  { "TEN",         { 146, 145, 144 } },
+  { "ELEVEN",      { 111, 110, 109, 108, 107, 106 } },
+  { "TWELVE",      { 126, 127, 128, 129, 130, 131 } }
+};
+
+// Phrase program compiled from layouts/lang/en.grammar
+const uint8_t PHRASE_PROGRAM_EN_V1[] = {
+  0, 1, PHRASE_OP_HOUR | 0, 9, PHRASE_OP_END,  // :00 IT IS {H} OCLOCK
+  0, 1, 2, 7, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :05 IT IS FIVE_M PAST {H}
+  0, 1, 3, 7, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :10 IT IS TEN_M PAST {H}
+  0, 1, 4, 7, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :15 IT IS QUARTER PAST {H}
+  0, 1, 5, 7, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :20 IT IS TWENTY PAST {H}
+  0, 1, 5, 2, 7, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :25 IT IS TWENTY FIVE_M PAST {H}
+  0, 1, 6, 7, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :30 IT IS HALF PAST {H}
+  0, 1, 5, 2, 8, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :35 IT IS TWENTY FIVE_M TO {H}
+  0, 1, 5, 8, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :40 IT IS TWENTY TO {H}
+  0, 1, 4, 8, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :45 IT IS QUARTER TO {H}
+  0, 1, 3, 8, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :50 IT IS TEN_M TO {H}
+  0, 1, 2, 8, PHRASE_OP_HOUR | 1, PHRASE_OP_END   // :55 IT IS FIVE_M TO {H}
 };
 
+const uint8_t PHRASE_ENTRY_EN_V1[PHRASE_BUCKET_COUNT] = { 0, 5, 11, 17, 23, 29, 36, 42, 49, 55, 61, 67 };
+const uint8_t PHRASE_PREFIX_WORDS_EN_V1 = 2;
+const uint8_t HOUR_WORDS_EN_V1[12] = { 21, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+
 const size_t WORDS_EN_V1_COUNT = sizeof(WORDS_EN_V1) / sizeof(WORDS_EN_V1[0]);
 const size_t EXTRA_MINUTES_EN_V1_COUNT = sizeof(EXTRA_MINUTES_EN_V1) / sizeof(EXTRA_MINUTES_EN_V1[0]);
@@ -1,3 +1,4 @@
+// Generated by tools/grid_compiler.py from layouts/en_v1.layout. Do not edit by hand.
 #pragma once
 
 #include <stddef.h>
@@ -14,3 +15,8 @@ extern const WordPosition WORDS_EN_V1[];
 extern const size_t WORDS_EN_V1_COUNT;
 extern const uint16_t EXTRA_MINUTES_EN_V1[];
 extern const size_t EXTRA_MINUTES_EN_V1_COUNT;
+extern const int16_t CELL_LEDS_EN_V1[];
+extern const uint8_t PHRASE_PROGRAM_EN_V1[];
+extern const uint8_t PHRASE_ENTRY_EN_V1[PHRASE_BUCKET_COUNT];
+extern const uint8_t PHRASE_PREFIX_WORDS_EN_V1;
+extern const uint8_t HOUR_WORDS_EN_V1[12];
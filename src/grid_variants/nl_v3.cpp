@@ -1,10 +1,8 @@
+// Generated by tools/grid_compiler.py from layouts/nl_v3.layout. Do not edit by hand.
 #include "grid_variants/nl_v3.h"
 
-// v3 is new lay-out in spiegelbeeld t.o.v. v1, elke bocht met 4 leds, behalve 1 (misproductie ;-))
-
-// Placeholder: NL_V3 currently reuses the NL_V1 grid until a dedicated layout is supplied.
-const uint16_t LED_COUNT_GRID_NL_V3 = 144;
-const uint16_t LED_COUNT_EXTRA_NL_V3 = 13;
+const uint16_t LED_COUNT_GRID_NL_V3 = 145;
+const uint16_t LED_COUNT_EXTRA_NL_V3 = 15;
 const uint16_t LED_COUNT_TOTAL_NL_V3 = LED_COUNT_GRID_NL_V3 + LED_COUNT_EXTRA_NL_V3;
 
 const char* const LETTER_GRID_NL_V3[] = {
@@ -21,11 +19,21 @@ const char* const LETTER_GRID_NL_V3[] = {
   "..-.-.-.-.."
 };
 
-const uint16_t EXTRA_MINUTES_NL_V3[] = {
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V3 + 13),
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V3 + 11),
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V3 + 9),
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V3 + 7)
+const uint16_t EXTRA_MINUTES_NL_V3[] = { 157, 155, 153, 151 };
+
+// LED index per grid cell, row by row (-1 = not wired)
+const int16_t CELL_LEDS_NL_V3[] = {
+   10,   9,   8,   7,   6,   5,   4,   3,   2,   1,   0,
+   15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,
+   40,  39,  38,  37,  36,  35,  34,  33,  32,  31,  30,
+   45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,
+   69,  68,  67,  66,  65,  64,  63,  62,  61,  60,  59,
+   74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,
+   99,  98,  97,  96,  95,  94,  93,  92,  91,  90,  89,
+  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+  129, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119,
+  134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+  159, 158, 157, 156, 155, 154, 153, 152, 151, 150, 149
 };
 
 const WordPosition WORDS_NL_V3[] = {
@@ -52,5 +60,25 @@ const WordPosition WORDS_NL_V3[] = {
   { "TWAALF",      { 104, 105, 106, 107, 108, 109 } }
 };
 
+// Phrase program compiled from layouts/lang/nl.grammar
+const uint8_t PHRASE_PROGRAM_NL_V3[] = {
+  0, 1, PHRASE_OP_HOUR | 0, 8, PHRASE_OP_END,  // :00 HET IS {H} UUR
+  0, 1, 2, 4, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :05 HET IS VIJF_M OVER {H}
+  0, 1, 3, 4, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :10 HET IS TIEN_M OVER {H}
+  0, 1, 6, 4, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :15 HET IS KWART OVER {H}
+  0, 1, 3, 5, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :20 HET IS TIEN_M VOOR HALF {H}
+  0, 1, 2, 5, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :25 HET IS VIJF_M VOOR HALF {H}
+  0, 1, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :30 HET IS HALF {H}
+  0, 1, 2, 4, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :35 HET IS VIJF_M OVER HALF {H}
+  0, 1, 3, 4, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :40 HET IS TIEN_M OVER HALF {H}
+  0, 1, 6, 5, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :45 HET IS KWART VOOR {H}
+  0, 1, 3, 5, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :50 HET IS TIEN_M VOOR {H}
+  0, 1, 2, 5, PHRASE_OP_HOUR | 1, PHRASE_OP_END   // :55 HET IS VIJF_M VOOR {H}
+};
+
+const uint8_t PHRASE_ENTRY_NL_V3[PHRASE_BUCKET_COUNT] = { 0, 5, 11, 17, 23, 30, 37, 42, 49, 56, 62, 68 };
+const uint8_t PHRASE_PREFIX_WORDS_NL_V3 = 2;
+const uint8_t HOUR_WORDS_NL_V3[12] = { 20, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+
 const size_t WORDS_NL_V3_COUNT = sizeof(WORDS_NL_V3) / sizeof(WORDS_NL_V3[0]);
 const size_t EXTRA_MINUTES_NL_V3_COUNT = sizeof(EXTRA_MINUTES_NL_V3) / sizeof(EXTRA_MINUTES_NL_V3[0]);
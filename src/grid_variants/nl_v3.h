@@ -1,3 +1,4 @@
+// Generated by tools/grid_compiler.py from layouts/nl_v3.layout. Do not edit by hand.
 #pragma once
 
 #include <stddef.h>
@@ -14,3 +15,8 @@ extern const WordPosition WORDS_NL_V3[];
 extern const size_t WORDS_NL_V3_COUNT;
 extern const uint16_t EXTRA_MINUTES_NL_V3[];
 extern const size_t EXTRA_MINUTES_NL_V3_COUNT;
+extern const int16_t CELL_LEDS_NL_V3[];
+extern const uint8_t PHRASE_PROGRAM_NL_V3[];
+extern const uint8_t PHRASE_ENTRY_NL_V3[PHRASE_BUCKET_COUNT];
+extern const uint8_t PHRASE_PREFIX_WORDS_NL_V3;
+extern const uint8_t HOUR_WORDS_NL_V3[12];
@@ -1,8 +1,8 @@
+// Generated by tools/grid_compiler.py from layouts/nl_v4.layout. Do not edit by hand.
 #include "grid_variants/nl_v4.h"
 
-// Placeholder: NL_V4 currently reuses the NL_V1 grid until a dedicated layout is supplied.
-const uint16_t LED_COUNT_GRID_NL_V4 = 146;
-const uint16_t LED_COUNT_EXTRA_NL_V4 = 15;
+const uint16_t LED_COUNT_GRID_NL_V4 = 147;
+const uint16_t LED_COUNT_EXTRA_NL_V4 = 14;
 const uint16_t LED_COUNT_TOTAL_NL_V4 = LED_COUNT_GRID_NL_V4 + LED_COUNT_EXTRA_NL_V4;
 
 const char* const LETTER_GRID_NL_V4[] = {
@@ -19,11 +19,21 @@ const char* const LETTER_GRID_NL_V4[] = {
   "..-.-.-.-.."
 };
 
-const uint16_t EXTRA_MINUTES_NL_V4[] = {
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V4 + 7),
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V4 + 9),
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V4 + 11),
-  static_cast<uint16_t>(LED_COUNT_GRID_NL_V4 + 13)
+const uint16_t EXTRA_MINUTES_NL_V4[] = { 153, 155, 157, 159 };
+
+// LED index per grid cell, row by row (-1 = not wired)
+const int16_t CELL_LEDS_NL_V4[] = {
+    1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,
+   26,  25,  24,  23,  22,  21,  20,  19,  18,  17,  16,
+   31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+   56,  55,  54,  53,  52,  51,  50,  49,  48,  47,  46,
+   61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+   86,  85,  84,  83,  82,  81,  80,  79,  78,  77,  76,
+   91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+  116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106,
+  121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+  146, 145, 144, 143, 142, 141, 140, 139, 138, 137, 136,
+  151, 152, 153, 154, 155, 156, 157, 158, 159, 160,  -1
 };
 
 const WordPosition WORDS_NL_V4[] = {
@@ -50,5 +60,25 @@ const WordPosition WORDS_NL_V4[] = {
   { "TWAALF",      { 116, 115, 114, 113, 112, 111 } }
 };
 
+// Phrase program compiled from layouts/lang/nl.grammar
+const uint8_t PHRASE_PROGRAM_NL_V4[] = {
+  0, 1, PHRASE_OP_HOUR | 0, 8, PHRASE_OP_END,  // :00 HET IS {H} UUR
+  0, 1, 2, 4, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :05 HET IS VIJF_M OVER {H}
+  0, 1, 3, 4, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :10 HET IS TIEN_M OVER {H}
+  0, 1, 6, 4, PHRASE_OP_HOUR | 0, PHRASE_OP_END,  // :15 HET IS KWART OVER {H}
+  0, 1, 3, 5, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :20 HET IS TIEN_M VOOR HALF {H}
+  0, 1, 2, 5, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :25 HET IS VIJF_M VOOR HALF {H}
+  0, 1, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :30 HET IS HALF {H}
+  0, 1, 2, 4, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :35 HET IS VIJF_M OVER HALF {H}
+  0, 1, 3, 4, 7, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :40 HET IS TIEN_M OVER HALF {H}
+  0, 1, 6, 5, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :45 HET IS KWART VOOR {H}
+  0, 1, 3, 5, PHRASE_OP_HOUR | 1, PHRASE_OP_END,  // :50 HET IS TIEN_M VOOR {H}
+  0, 1, 2, 5, PHRASE_OP_HOUR | 1, PHRASE_OP_END   // :55 HET IS VIJF_M VOOR {H}
+};
+
+const uint8_t PHRASE_ENTRY_NL_V4[PHRASE_BUCKET_COUNT] = { 0, 5, 11, 17, 23, 30, 37, 42, 49, 56, 62, 68 };
+const uint8_t PHRASE_PREFIX_WORDS_NL_V4 = 2;
+const uint8_t HOUR_WORDS_NL_V4[12] = { 20, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+
 const size_t WORDS_NL_V4_COUNT = sizeof(WORDS_NL_V4) / sizeof(WORDS_NL_V4[0]);
 const size_t EXTRA_MINUTES_NL_V4_COUNT = sizeof(EXTRA_MINUTES_NL_V4) / sizeof(EXTRA_MINUTES_NL_V4[0]);
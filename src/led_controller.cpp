@@ -2,29 +2,387 @@
 #include "config.h"
 #include "log.h"
 #include "led_state.h"
+#include "palette_settings.h"
+#include "night_dimming.h"
+#include "spsc_ring.h"
+#include <math.h>
+#include <string.h>
 
+// All showLeds() callers (display loop, startup sequence, web and MQTT
+// handlers) run on the Arduino loop task. On the ESP32 they only enqueue
+// commands; a render task pinned to core 1 owns the sink and does the
+// diffing and output, so strip timing no longer depends on network work.
+#if defined(ARDUINO_ARCH_ESP32)
+#define LED_RENDER_TASK 1
+#else
+#define LED_RENDER_TASK 0
+#endif
 
-// Instance of the NeoPixel strip
-static Adafruit_NeoPixel strip(NUM_LEDS, DATA_PIN, NEO_GRBW + NEO_KHZ800);
+#if LED_RENDER_TASK
+static const BaseType_t RENDER_TASK_CORE = 1;
+static const UBaseType_t RENDER_TASK_PRIORITY = 2; // above loopTask (1)
+static const uint32_t RENDER_TASK_STACK = 3072;
+static const TickType_t QUEUE_FULL_WAIT_TICKS = pdMS_TO_TICKS(50);
+static TaskHandle_t renderTask = nullptr;
+#endif
+
+struct LedCommand {
+  enum Type : uint8_t { FRAME, SET_PALETTE, SET_BRIGHTNESS, SET_BUDGET };
+  Type type;
+  uint8_t slot;             // SET_PALETTE
+  uint8_t brightness;       // SET_BRIGHTNESS
+  uint16_t budgetMa;        // SET_BUDGET
+  uint32_t color;           // SET_PALETTE
+  uint8_t levels[NUM_LEDS]; // FRAME: 0 = off, 255 = full colour
+  uint8_t palette[NUM_LEDS]; // FRAME: palette slot per LED
+};
+
+static SpscRing<LedCommand, 8> commands;
+
+// Current output; the hardware strip unless replaced with setLedSink()
+static LedSink* sink = nullptr;
+
+// Renderer state, owned by the render task once it runs
+static uint32_t palette[PALETTE_SIZE];
+static uint8_t brightness = 0;
+static uint16_t outputLut[256];     // gamma + brightness per channel value, 8.8 fixed point
+static int lutBrightness = -1;      // brightness outputLut was built for
+static uint8_t ditherAcc[NUM_LEDS][4]; // carried fractions per LED channel
+static bool ditherActive = false;   // last output had fractions left to dither
+#if LED_RENDER_TASK
+static const uint32_t TICK_US = portTICK_PERIOD_MS * 1000UL;
+#else
+static const uint32_t TICK_US = 1000;
+#endif
+
+// Current limiter: the output LUT result is scaled by limitQ8/256. It drops
+// at once when a frame would exceed the budget and recovers in steps.
+static const uint8_t CHANNEL_MA[4] = { LED_MA_BLUE, LED_MA_GREEN, LED_MA_RED, LED_MA_WHITE }; // packed byte order
+static const uint16_t LIMIT_RELEASE_STEP = 8; // per refresh, Q8
+static uint16_t budgetMa = 0;
+static uint16_t limitQ8 = 256;
+static uint16_t limitTargetQ8 = 256;
+static volatile uint16_t estimatedMa = 0;
+static volatile uint16_t requestedMa = 0;
+static volatile uint16_t peakMa = 0;
+static volatile uint32_t throttleEvents = 0;
+static uint8_t frameLevels[NUM_LEDS];
+static uint8_t framePalette[NUM_LEDS];
+static uint32_t frame[NUM_LEDS];     // RGBW framebuffer before the output LUT
+static uint32_t lastFrame[NUM_LEDS];
+static uint32_t outFrame[NUM_LEDS];  // what the sink receives
+static uint8_t lastBrightness = 0;
+static uint16_t lastLimitQ8 = 256;  // limit lastFrame was shown with
+static bool haveLastFrame = false;
+static volatile uint32_t framesShown = 0;
+static volatile uint32_t framesSkipped = 0;
+
+// Producer-side copy of the settings last sent, so only changes are queued
+static uint32_t submittedPalette[PALETTE_SIZE];
+static uint8_t submittedBrightness = 0;
+static uint16_t submittedBudget = 0;
+static bool submittedSettings = false;
+
+static LedSink& activeSink() {
+  if (!sink) sink = &hardwareLedSink();
+  return *sink;
+}
+
+// Same packing as Adafruit_NeoPixel::Color(r, g, b, w)
+static inline uint32_t packColor(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+  return ((uint32_t)w << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+static void applyCommand(const LedCommand& cmd) {
+  switch (cmd.type) {
+    case LedCommand::FRAME:
+      memcpy(frameLevels, cmd.levels, sizeof(frameLevels));
+      memcpy(framePalette, cmd.palette, sizeof(framePalette));
+      break;
+    case LedCommand::SET_PALETTE:
+      if (cmd.slot < PALETTE_SIZE) palette[cmd.slot] = cmd.color;
+      break;
+    case LedCommand::SET_BRIGHTNESS:
+      brightness = cmd.brightness;
+      break;
+    case LedCommand::SET_BUDGET:
+      budgetMa = cmd.budgetMa;
+      break;
+  }
+}
+
+// Rebuilt only when the brightness changes, not per frame. Keeping 8
+// fractional bits lets temporal dithering recover the steps that an 8-bit
+// result would round away at night brightness.
+static void buildOutputLut() {
+  for (int v = 0; v < 256; ++v) {
+    outputLut[v] = (uint16_t)(powf(v / 255.0f, LED_OUTPUT_GAMMA) * brightness * 256.0f + 0.5f);
+  }
+  lutBrightness = brightness;
+}
+
+// Estimates the frame's current from the LUT output and updates the limiter
+static void updateCurrentLimit() {
+  uint32_t channelSum[4] = { 0, 0, 0, 0 }; // 8.8 fixed point duty per channel
+  for (uint16_t i = 0; i < NUM_LEDS; ++i) {
+    const uint32_t c = frame[i];
+    if (!c) continue;
+    for (uint8_t ch = 0; ch < 4; ++ch) {
+      channelSum[ch] += outputLut[(c >> (ch * 8)) & 0xFF];
+    }
+  }
+  const uint32_t idleMa = (uint32_t)LED_MA_IDLE * NUM_LEDS;
+  uint32_t driveMa = 0;
+  for (uint8_t ch = 0; ch < 4; ++ch) {
+    driveMa += channelSum[ch] * CHANNEL_MA[ch] / (255UL * 256UL);
+  }
+
+  limitTargetQ8 = 256;
+  if (budgetMa > idleMa && idleMa + driveMa > budgetMa) {
+    limitTargetQ8 = (uint16_t)((budgetMa - idleMa) * 256UL / driveMa);
+  }
+  if (limitTargetQ8 < limitQ8) {
+    if (limitQ8 == 256) throttleEvents++;
+    limitQ8 = limitTargetQ8;
+  } else if (limitTargetQ8 > limitQ8) {
+    limitQ8 = (uint16_t)min<uint32_t>(limitTargetQ8, (uint32_t)limitQ8 + LIMIT_RELEASE_STEP);
+  }
+
+  requestedMa = (uint16_t)min<uint32_t>(idleMa + driveMa, 65535);
+  estimatedMa = (uint16_t)min<uint32_t>(idleMa + driveMa * limitQ8 / 256, 65535);
+  if (estimatedMa > peakMa) peakMa = estimatedMa;
+}
+
+// Refresh interval while dithering: the sink's frame time in whole ticks,
+// 0 when its show() blocks until the frame is sent
+static uint32_t ditherPeriodUs() {
+  const uint32_t frameUs = activeSink().minFrameUs();
+  if (frameUs == 0) return 0;
+  return (frameUs + TICK_US - 1) / TICK_US * TICK_US;
+}
+
+// Gamma/brightness for the whole frame into outFrame; with dithering each
+// channel carries its fraction into the next refresh (first-order sigma-delta)
+static void buildOutput() {
+  // A fraction f toggles its LED at about min(f, 1 - f) / period; fractions
+  // that would blink slower than LED_DITHER_MIN_HZ are not dithered
+  const uint32_t periodUs = ditherPeriodUs();
+  const uint32_t minFraction =
+      periodUs ? (uint32_t)((256ULL * LED_DITHER_MIN_HZ * periodUs + 999999) / 1000000) : 256;
+  const bool dither = LED_DITHER_MAX_BRIGHTNESS > 0 && brightness <= LED_DITHER_MAX_BRIGHTNESS &&
+                      minFraction < 128;
+  bool fractions = false;
+  for (uint16_t i = 0; i < NUM_LEDS; ++i) {
+    const uint32_t c = frame[i];
+    if (!c) {
+      outFrame[i] = 0;
+      continue;
+    }
+    uint32_t out = 0;
+    for (uint8_t ch = 0; ch < 4; ++ch) {
+      uint16_t v = outputLut[(c >> (ch * 8)) & 0xFF];
+      if (limitQ8 < 256) v = (uint16_t)(((uint32_t)v * limitQ8) >> 8);
+      uint32_t level = v >> 8;
+      const uint8_t fraction = v & 0xFF;
+      if (dither && fraction >= minFraction) {
+        if (fraction > 256 - minFraction) {
+          level++;
+        } else {
+          const uint16_t acc = (uint16_t)ditherAcc[i][ch] + fraction;
+          if (acc >= 256) level++;
+          ditherAcc[i][ch] = (uint8_t)acc;
+          fractions = true;
+        }
+      }
+      out |= level << (ch * 8);
+    }
+    outFrame[i] = out;
+  }
+  ditherActive = fractions;
+}
+
+// Scales every channel of a packed colour by level/256 (255 keeps it unchanged)
+static inline uint32_t scaleColor(uint32_t c, uint8_t level) {
+  if (level == 255) return c;
+  const uint32_t scale = (uint32_t)level + 1;
+  return ((((c >> 24) & 0xFF) * scale >> 8) << 24) |
+         ((((c >> 16) & 0xFF) * scale >> 8) << 16) |
+         ((((c >> 8) & 0xFF) * scale >> 8) << 8) |
+         (((c & 0xFF) * scale) >> 8);
+}
+
+// Resolves palette slots into the framebuffer and pushes it unless it matches the last frame
+static void renderFrame() {
+  for (uint16_t i = 0; i < NUM_LEDS; ++i) {
+    const uint8_t level = frameLevels[i];
+    frame[i] = level ? scaleColor(palette[framePalette[i] % PALETTE_SIZE], level) : 0;
+  }
+
+  // The limit is settled before the skip test, so a new budget or brightness
+  // reaches the strip even when the frame itself did not change
+  if (lutBrightness != brightness) buildOutputLut();
+  updateCurrentLimit();
+
+  // A dithered or recovering frame changes on every refresh, so it is never skipped
+  if (!ditherActive && limitQ8 == limitTargetQ8 && limitQ8 == lastLimitQ8 && haveLastFrame &&
+      brightness == lastBrightness && memcmp(frame, lastFrame, sizeof(frame)) == 0) {
+    framesSkipped++;
+    return;
+  }
+
+  buildOutput();
+  activeSink().show(outFrame, NUM_LEDS);
+
+  memcpy(lastFrame, frame, sizeof(frame));
+  lastBrightness = brightness;
+  lastLimitQ8 = limitQ8;
+  haveLastFrame = true;
+  framesShown++;
+}
+
+#if LED_RENDER_TASK
+static void renderTaskMain(void*) {
+  for (;;) {
+    // Sleep until a command arrives, or until the next dither/limiter refresh
+    const bool refresh = ditherActive || limitQ8 != limitTargetQ8;
+    const TickType_t wait = ditherActive ? (TickType_t)(ditherPeriodUs() / TICK_US)
+                          : refresh     ? pdMS_TO_TICKS(LED_LIMIT_FRAME_MS)
+                                        : portMAX_DELAY;
+    ulTaskNotifyTake(pdTRUE, wait);
+    // Apply everything queued since the last wake, then render once
+    LedCommand cmd;
+    bool changed = false;
+    while (commands.pop(cmd)) {
+      applyCommand(cmd);
+      changed = true;
+    }
+    if (changed || refresh) renderFrame();
+  }
+}
+#endif
+
+// False when the render task stalled and the command was dropped
+static bool submit(const LedCommand& cmd) {
+#if LED_RENDER_TASK
+  if (renderTask) {
+    TickType_t waited = 0;
+    while (!commands.push(cmd)) {
+      if (waited >= QUEUE_FULL_WAIT_TICKS) return false;
+      xTaskNotifyGive(renderTask);
+      vTaskDelay(1);
+      waited++;
+    }
+    xTaskNotifyGive(renderTask);
+    return true;
+  }
+#endif
+  applyCommand(cmd);
+  if (cmd.type == LedCommand::FRAME) renderFrame();
+  return true;
+}
 
 void initLeds() {
-    strip.begin();
-    strip.setBrightness(ledState.getBrightness());
-    strip.clear();
-    strip.show();
+    activeSink().begin();
+    memset(outFrame, 0, sizeof(outFrame));
+    activeSink().show(outFrame, NUM_LEDS);
+    haveLastFrame = false;
+#if LED_RENDER_TASK
+    if (!renderTask) {
+      xTaskCreatePinnedToCore(renderTaskMain, "render", RENDER_TASK_STACK, nullptr,
+                              RENDER_TASK_PRIORITY, &renderTask, RENDER_TASK_CORE);
+      logInfo(renderTask ? "🖌️ LED render task started on core 1" : "❌ LED render task start failed");
+    }
+#endif
+}
+
+void setLedSink(LedSink* newSink) {
+  sink = newSink;
+  haveLastFrame = false;
+}
+
+// Queues palette/brightness changes ahead of the next frame. The cached
+// copies only change once a command is queued, so after a drop the rest is
+// left for the next frame and the dropped setting is sent again.
+static void submitSettings() {
+  // Slot 0 is the clock colour (LedState), the rest come from PaletteSettings
+  uint8_t r, g, b, w;
+  ledState.getRGBW(r, g, b, w);
+  const uint8_t newBrightness = nightDimBrightness(ledState.getBrightness());
+
+  LedCommand cmd;
+  for (uint8_t slot = 0; slot < PALETTE_SIZE; ++slot) {
+    const uint32_t c = slot == PALETTE_TEXT ? packColor(r, g, b, w) : paletteSettings.getColor(slot);
+    if (!submittedSettings || c != submittedPalette[slot]) {
+      cmd.type = LedCommand::SET_PALETTE;
+      cmd.slot = slot;
+      cmd.color = c;
+      if (!submit(cmd)) return;
+      submittedPalette[slot] = c;
+    }
+  }
+  if (!submittedSettings || newBrightness != submittedBrightness) {
+    cmd.type = LedCommand::SET_BRIGHTNESS;
+    cmd.brightness = newBrightness;
+    if (!submit(cmd)) return;
+    submittedBrightness = newBrightness;
+  }
+  const uint16_t newBudget = ledState.getPowerBudgetMa();
+  if (!submittedSettings || newBudget != submittedBudget) {
+    cmd.type = LedCommand::SET_BUDGET;
+    cmd.budgetMa = newBudget;
+    if (!submit(cmd)) return;
+    submittedBudget = newBudget;
+  }
+  submittedSettings = true;
+}
+
+void showLedFrame(const uint8_t* levels, const uint8_t* paletteSlots) {
+  submitSettings();
+  LedCommand cmd;
+  cmd.type = LedCommand::FRAME;
+  memcpy(cmd.levels, levels, sizeof(cmd.levels));
+  if (paletteSlots) {
+    memcpy(cmd.palette, paletteSlots, sizeof(cmd.palette));
+  } else {
+    memset(cmd.palette, PALETTE_TEXT, sizeof(cmd.palette));
+  }
+  submit(cmd);
 }
 
 void showLeds(const std::vector<uint16_t> &ledIndices) {
-  strip.clear();
+  uint8_t levels[NUM_LEDS];
+  memset(levels, 0, sizeof(levels));
   for (uint16_t idx : ledIndices) {
-    if (idx < strip.numPixels()) {
-      // Use the calculated RGB and W
-      uint8_t r, g, b, w;
-      ledState.getRGBW(r, g, b, w);
-      strip.setPixelColor(idx, strip.Color(r, g, b, w));
+    if (idx < NUM_LEDS) {
+      levels[idx] = 255;
     }
   }
-  strip.setBrightness(ledState.getBrightness());
-  strip.show();
+  showLedFrame(levels, nullptr);
 }
 
+void showLedLevels(const uint8_t* levels) {
+  showLedFrame(levels, nullptr);
+}
+
+bool ledOutputBusy() {
+  return !commands.empty() || activeSink().busy();
+}
+
+LedPowerStats ledPowerStats() {
+  LedPowerStats stats;
+  stats.estimatedMa = estimatedMa;
+  stats.requestedMa = requestedMa;
+  stats.peakMa = peakMa;
+  stats.budgetMa = submittedBudget;
+  stats.limited = limitQ8 < 256;
+  stats.throttleEvents = throttleEvents;
+  return stats;
+}
+
+uint32_t ledFramesShown() {
+  return framesShown;
+}
+
+uint32_t ledFramesSkipped() {
+  return framesSkipped;
+}
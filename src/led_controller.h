@@ -1,11 +1,40 @@
 #ifndef LED_CONTROLLER_H
 #define LED_CONTROLLER_H
 
-#include <Adafruit_NeoPixel.h>
+#include <stdint.h>
 #include <vector>
+#include "led_sink.h"
 
 // Export the function prototypes:
+// initLeds() also starts the render task that owns the strip on the ESP32;
+// showLeds() then only queues the frame and returns.
 void initLeds();
 void showLeds(const std::vector<uint16_t> &ledIndices);
+// Per-LED intensity (NUM_LEDS entries, 0..255) of the current colour, for animations
+void showLedLevels(const uint8_t* levels);
+// Per-LED intensity plus palette slot (palette_settings.h); nullptr slots = text colour
+void showLedFrame(const uint8_t* levels, const uint8_t* paletteSlots);
+
+// Route frames to another sink (e.g. VirtualLedSink); nullptr restores the strip.
+// Call before initLeds() on the device, the render task uses the sink afterwards.
+void setLedSink(LedSink* sink);
+
+// True while frames are queued or still being sent
+bool ledOutputBusy();
+
+// Output current estimate and limiter state (render task values, read-only)
+struct LedPowerStats {
+  uint16_t estimatedMa;   // last frame, after limiting
+  uint16_t requestedMa;   // last frame, before limiting
+  uint16_t peakMa;        // highest estimate since boot
+  uint16_t budgetMa;      // 0 = unlimited
+  bool limited;
+  uint32_t throttleEvents; // times the limiter engaged
+};
+LedPowerStats ledPowerStats();
+
+// Frame counters: frames pushed to the strip vs. identical frames skipped
+uint32_t ledFramesShown();
+uint32_t ledFramesSkipped();
 
 #endif // LED_CONTROLLER_H
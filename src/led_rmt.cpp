@@ -0,0 +1,107 @@
+#include "config.h"
+
+#if LED_BACKEND == LED_BACKEND_RMT
+
+#include "led_rmt.h"
+#include "log.h"
+#include <driver/rmt.h>
+#include <esp_timer.h>
+
+static const rmt_channel_t RMT_CHANNEL = RMT_CHANNEL_0;
+
+// 80 MHz APB / 2 = 25 ns per tick; SK6812 bit timings
+static const uint32_t T0H_TICKS = 12; // 0.3 us
+static const uint32_t T0L_TICKS = 36; // 0.9 us
+static const uint32_t T1H_TICKS = 24; // 0.6 us
+static const uint32_t T1L_TICKS = 24; // 0.6 us
+static const int64_t RESET_US = 80;
+
+static uint8_t* buffers[2] = { nullptr, nullptr };
+static uint8_t backIndex = 0;
+static size_t frameBytes = 0;
+static volatile bool busy = false;
+static volatile int64_t lastDoneUs = 0;
+
+// Converts frame bytes to RMT items on the fly inside the RMT interrupt, so
+// only the compact byte frame has to stay alive during the transfer.
+static void IRAM_ATTR translate(const void* src, rmt_item32_t* dest, size_t srcSize,
+                                size_t wantedNum, size_t* translatedSize, size_t* itemNum) {
+  if (src == nullptr || dest == nullptr) {
+    *translatedSize = 0;
+    *itemNum = 0;
+    return;
+  }
+  rmt_item32_t bit0, bit1;
+  bit0.duration0 = T0H_TICKS; bit0.level0 = 1; bit0.duration1 = T0L_TICKS; bit0.level1 = 0;
+  bit1.duration0 = T1H_TICKS; bit1.level0 = 1; bit1.duration1 = T1L_TICKS; bit1.level1 = 0;
+
+  const uint8_t* psrc = static_cast<const uint8_t*>(src);
+  size_t size = 0;
+  size_t num = 0;
+  while (size < srcSize && num + 8 <= wantedNum) {
+    for (int i = 7; i >= 0; --i) {
+      dest->val = (*psrc & (1 << i)) ? bit1.val : bit0.val;
+      dest++;
+    }
+    num += 8;
+    size++;
+    psrc++;
+  }
+  *translatedSize = size;
+  *itemNum = num;
+}
+
+static void IRAM_ATTR onTxEnd(rmt_channel_t channel, void*) {
+  if (channel != RMT_CHANNEL) return;
+  lastDoneUs = esp_timer_get_time();
+  busy = false;
+}
+
+bool ledRmtBegin(uint8_t pin, uint16_t numLeds) {
+  frameBytes = (size_t)numLeds * LED_RMT_BYTES_PER_LED;
+  for (int i = 0; i < 2; ++i) {
+    buffers[i] = static_cast<uint8_t*>(calloc(frameBytes, 1));
+    if (!buffers[i]) {
+      logError("❌ RMT LED buffer allocation failed");
+      return false;
+    }
+  }
+
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX(static_cast<gpio_num_t>(pin), RMT_CHANNEL);
+  config.clk_div = 2;
+  if (rmt_config(&config) != ESP_OK ||
+      rmt_driver_install(RMT_CHANNEL, 0, 0) != ESP_OK ||
+      rmt_translator_init(RMT_CHANNEL, translate) != ESP_OK) {
+    logError("❌ RMT LED driver init failed");
+    return false;
+  }
+  rmt_register_tx_end_callback(onTxEnd, nullptr);
+  logInfo("💡 LED output via RMT (non-blocking, double-buffered)");
+  return true;
+}
+
+uint8_t* ledRmtBackBuffer() {
+  return buffers[backIndex];
+}
+
+void ledRmtSubmit() {
+  if (!buffers[backIndex]) return;
+  // The front buffer is read by the interrupt until the transfer ends
+  if (busy) {
+    rmt_wait_tx_done(RMT_CHANNEL, pdMS_TO_TICKS(20));
+  }
+  // Keep the line low long enough for the strip to latch the previous frame
+  int64_t sinceDone = esp_timer_get_time() - lastDoneUs;
+  if (sinceDone < RESET_US) {
+    delayMicroseconds(RESET_US - sinceDone);
+  }
+  busy = true;
+  rmt_write_sample(RMT_CHANNEL, buffers[backIndex], frameBytes, false);
+  backIndex ^= 1;
+}
+
+bool ledRmtBusy() {
+  return busy;
+}
+
+#endif // LED_BACKEND == LED_BACKEND_RMT
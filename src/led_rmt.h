@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Non-blocking SK6812 RGBW output through the ESP32 RMT peripheral.
+// Frames are double-buffered: the caller fills the back buffer while the
+// front buffer is still being clocked out, then submits it. Only built when
+// LED_BACKEND == LED_BACKEND_RMT (see config.h).
+
+// Bytes per LED in wire order (G, R, B, W)
+static const size_t LED_RMT_BYTES_PER_LED = 4;
+
+bool ledRmtBegin(uint8_t pin, uint16_t numLeds);
+
+// Buffer for the next frame; numLeds * LED_RMT_BYTES_PER_LED bytes
+uint8_t* ledRmtBackBuffer();
+
+// Starts sending the back buffer and swaps buffers. Waits only when the
+// previous frame is still on the wire.
+void ledRmtSubmit();
+
+// True while a frame is being transmitted (cleared by the RMT tx-end callback)
+bool ledRmtBusy();
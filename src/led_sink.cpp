@@ -0,0 +1,87 @@
+#include "led_sink.h"
+#include "config.h"
+
+#if LED_BACKEND == LED_BACKEND_RMT
+
+#include "led_rmt.h"
+
+// Non-blocking RMT output (led_rmt.cpp)
+class RmtLedSink : public LedSink {
+public:
+  void begin() override {
+    ledRmtBegin(DATA_PIN, NUM_LEDS);
+  }
+
+  // Writes the frame in wire order (G, R, B, W)
+  void show(const uint32_t* pixels, uint16_t count) override {
+    uint8_t* out = ledRmtBackBuffer();
+    if (!out) return;
+    for (uint16_t i = 0; i < NUM_LEDS; ++i) {
+      const uint32_t c = i < count ? pixels[i] : 0;
+      *out++ = (uint8_t)(c >> 8);
+      *out++ = (uint8_t)(c >> 16);
+      *out++ = (uint8_t)c;
+      *out++ = (uint8_t)(c >> 24);
+    }
+    ledRmtSubmit();
+  }
+
+  bool busy() const override { return ledRmtBusy(); }
+
+  // 1.25 µs per bit, 32 bits per LED, plus the 80 µs latch
+  uint32_t minFrameUs() const override { return NUM_LEDS * 40UL + 80; }
+};
+
+LedSink& hardwareLedSink() {
+  static RmtLedSink sink;
+  return sink;
+}
+
+#elif LED_BACKEND == LED_BACKEND_VIRTUAL
+
+#include "virtual_led_sink.h"
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+LedSink& hardwareLedSink() {
+#ifdef ARDUINO
+  static VirtualLedSink sink(32, [] { return (uint32_t)millis(); });
+#else
+  static VirtualLedSink sink;
+#endif
+  return sink;
+}
+
+#else
+
+#include <Adafruit_NeoPixel.h>
+
+// Blocking Adafruit_NeoPixel output. setBrightness() is never called: it
+// rescales the pixel buffer lossily, brightness is applied by the output LUT.
+class NeoPixelLedSink : public LedSink {
+public:
+  NeoPixelLedSink() : strip(NUM_LEDS, DATA_PIN, NEO_GRBW + NEO_KHZ800) {}
+
+  void begin() override {
+    strip.begin();
+  }
+
+  void show(const uint32_t* pixels, uint16_t count) override {
+    strip.clear();
+    for (uint16_t i = 0; i < count && i < strip.numPixels(); ++i) {
+      if (pixels[i]) strip.setPixelColor(i, pixels[i]);
+    }
+    strip.show();
+  }
+
+private:
+  Adafruit_NeoPixel strip;
+};
+
+LedSink& hardwareLedSink() {
+  static NeoPixelLedSink sink;
+  return sink;
+}
+
+#endif
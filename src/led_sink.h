@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+// Output stage behind showLeds(). A frame is `count` colours packed like
+// Adafruit_NeoPixel::Color() (0xWWRRGGBB), already gamma corrected and
+// brightness scaled; sinks send them as-is.
+class LedSink {
+public:
+  virtual ~LedSink() {}
+  virtual void begin() = 0;
+  virtual void show(const uint32_t* pixels, uint16_t count) = 0;
+  // True while the previous frame is still being transmitted
+  virtual bool busy() const { return false; }
+  // Shortest frame interval in microseconds that show() takes without
+  // waiting for the wire; 0 when show() blocks until the frame is sent
+  virtual uint32_t minFrameUs() const { return 0; }
+};
+
+// Strip backend selected at build time by LED_BACKEND (config.h)
+LedSink& hardwareLedSink();
@@ -3,6 +3,7 @@
 #define LED_STATE_H
 
 #include <Preferences.h>
+#include "config.h"
 
 class LedState {
 public:
@@ -13,6 +14,7 @@ public:
     blue  = prefs.getUChar("b", 0);
     white = prefs.getUChar("w", 255);
     brightness = prefs.getUChar("br", 64);
+    powerBudgetMa = prefs.getUShort("budget", LED_POWER_BUDGET_DEFAULT_MA);
     prefs.end();
   }
 
@@ -38,6 +40,16 @@ public:
 
   uint8_t getBrightness() const { return brightness; }
 
+  // Supply budget for the strip in mA; 0 disables current limiting
+  void setPowerBudgetMa(uint16_t ma) {
+    powerBudgetMa = ma;
+    prefs.begin("led", false);
+    prefs.putUShort("budget", powerBudgetMa);
+    prefs.end();
+  }
+
+  uint16_t getPowerBudgetMa() const { return powerBudgetMa; }
+
   void getRGBW(uint8_t &r, uint8_t &g, uint8_t &b, uint8_t &w) const {
     r = red; g = green; b = blue; w = white;
   }
@@ -45,6 +57,7 @@ public:
 private:
   uint8_t red = 0, green = 0, blue = 0, white = 255;
   uint8_t brightness = 64;
+  uint16_t powerBudgetMa = LED_POWER_BUDGET_DEFAULT_MA;
   Preferences prefs;
 };
 
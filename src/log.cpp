@@ -2,64 +2,91 @@
 #include <Preferences.h>
 #include <time.h>
 #include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
 
 LogLevel LOG_LEVEL = DEFAULT_LOG_LEVEL;
 
-String logBuffer[LOG_BUFFER_SIZE];
-int logIndex = 0;
+// Consider time unsynced if before 2022-01-01
+static const time_t TIME_VALID_AFTER = 1640995200;
 
-static inline const char* levelToTag(int level) {
-  switch (level) {
-    case LOG_LEVEL_DEBUG: return "DEBUG";
-    case LOG_LEVEL_INFO:  return "INFO";
-    case LOG_LEVEL_WARN:  return "WARN";
-    case LOG_LEVEL_ERROR: return "ERROR";
-    default:              return "INFO";
-  }
+// Raw time for a new record: epoch seconds once synced, uptime before
+static LogEntry newEntry(int level) {
+  const time_t now = time(nullptr);
+  const unsigned long ms = millis();
+  LogEntry entry = {};
+  entry.synced = now >= TIME_VALID_AFTER;
+  entry.seconds = entry.synced ? (uint32_t)now : (uint32_t)(ms / 1000UL);
+  entry.millis = (uint16_t)(ms % 1000UL);
+  entry.level = (uint8_t)level;
+  return entry;
 }
 
-static String makeLogPrefix(int level) {
-  // Prefer localtime_r with TZ applied; fall back to uptime if RTC not set yet
-  time_t now = time(nullptr);
-  // Consider time unsynced if before 2022-01-01
-  if (now < 1640995200) {
-    unsigned long nowMs = millis();
-    char out[64];
-    snprintf(out, sizeof(out), "[uptime %lu.%03lus][%s] ", nowMs/1000UL, nowMs%1000UL, levelToTag(level));
-    return String(out);
-  }
+static void writeLog(const char* msg, size_t len, bool newline, int level) {
+  // Filter: only log messages at or above current threshold
+  if (level < LOG_LEVEL) return;
 
-  struct tm lt = {};
-  localtime_r(&now, &lt);
-  char datebuf[32];
-  char tzbuf[8];
-  strftime(datebuf, sizeof(datebuf), "%Y-%m-%d %H:%M:%S", &lt);
-  strftime(tzbuf, sizeof(tzbuf), "%Z", &lt);
-  unsigned long ms = millis() % 1000UL;
-  char out[80];
-  // Format: [YYYY-MM-DD HH:MM:SS.mmm TZ][LEVEL]
-  snprintf(out, sizeof(out), "[%s.%03lu %s][%s] ", datebuf, ms, tzbuf, levelToTag(level));
-  return String(out);
+  LogEntry entry = newEntry(level);
+  char prefix[80];
+  logFormatPrefix(entry, prefix, sizeof(prefix));
+  Serial.print(prefix);
+  Serial.write((const uint8_t*)msg, len);
+  if (newline) Serial.print("\n");
+
+  // Store in the log arena; lines are kept without their trailing newline
+  if (!newline && len > 0 && msg[len - 1] == '\n') len--;
+  logRingAppend(entry, msg, len);
 }
 
-void log(String msg, int level) {
-  // Filter: only log messages at or above current threshold
-  if (level < LOG_LEVEL) return;
+void log(const String& msg, int level) {
+  writeLog(msg.c_str(), msg.length(), false, level);
+}
 
-  // if (telnetClient && telnetClient.connected()) {
-  //   telnetClient.print(msg);
-  // }
+void log(const char* msg, int level) {
+  writeLog(msg, msg ? strlen(msg) : 0, false, level);
+}
 
-  String line = makeLogPrefix(level) + msg;
-  Serial.print(line);
+void logln(const String& msg, int level) {
+  writeLog(msg.c_str(), msg.length(), true, level);
+}
 
-  // Store in ring buffer any message that passes the filter
-  logBuffer[logIndex] = line;
-  logIndex = (logIndex + 1) % LOG_BUFFER_SIZE;
+void logln(const char* msg, int level) {
+  writeLog(msg, msg ? strlen(msg) : 0, true, level);
 }
 
-void logln(String msg, int level) {
-  log(msg + "\n", level);
+void logPrintf(int level, const char* fmt, ...) {
+  if (level < LOG_LEVEL) return;
+  char buf[LOG_RECORD_MAX + 1];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  if (n < 0) return;
+  writeLog(buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1, true, level);
+}
+
+void logBinary(int level, uint32_t formatId, const char* fmt, ...) {
+  if (level < LOG_LEVEL) return;
+  uint8_t record[LOG_RECORD_MAX];
+  va_list args;
+  va_start(args, fmt);
+  const size_t len = logBinaryPack(record, sizeof(record), formatId, fmt, args);
+  va_end(args);
+
+  LogEntry entry = newEntry(level);
+  entry.binary = true;
+  entry.length = (uint16_t)len;
+#if LOG_SERIAL_ECHO
+  // Rendered from the packed record, so Serial shows exactly what /log will
+  char prefix[80];
+  char text[LOG_RECORD_MAX + 1];
+  logFormatPrefix(entry, prefix, sizeof(prefix));
+  logFormatMessage(entry, record, text, sizeof(text));
+  Serial.print(prefix);
+  Serial.print(text);
+  Serial.print("\n");
+#endif
+  logRingAppend(entry, record, len);
 }
 
 void setLogLevel(LogLevel level) {
@@ -2,24 +2,47 @@
 #include <Arduino.h>
 // #include "network.h"  // For access to telnetClient
 #include "config.h"
+#include "log_ring.h"
+#include "log_binary.h"
+#include "log_text.h"
 
-enum LogLevel {
-  LOG_LEVEL_DEBUG = 0,
-  LOG_LEVEL_INFO,
-  LOG_LEVEL_WARN,
-  LOG_LEVEL_ERROR
-};
 extern LogLevel LOG_LEVEL;
 
+// Lowest level compiled in; release builds can pass
+// -DLOG_COMPILE_MIN_LEVEL=LOG_LEVEL_INFO to drop debug logging entirely
+#ifndef LOG_COMPILE_MIN_LEVEL
+#define LOG_COMPILE_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+#define LOG_ENABLED(level) ((level) >= LOG_COMPILE_MIN_LEVEL && (level) >= LOG_LEVEL)
+
 // Basic log function
-void log(String msg, int level = LOG_LEVEL_INFO);
-void logln(String msg, int level = LOG_LEVEL_INFO);
+void log(const String& msg, int level = LOG_LEVEL_INFO);
+void log(const char* msg, int level = LOG_LEVEL_INFO);
+void logln(const String& msg, int level = LOG_LEVEL_INFO);
+void logln(const char* msg, int level = LOG_LEVEL_INFO);
+// printf-style, formatted into a stack buffer (LOG_RECORD_MAX bytes)
+void logPrintf(int level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+// printf-style, stored unformatted as format ID + arguments (log_binary.h)
+void logBinary(int level, uint32_t formatId, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+
+// Convenience macros: the message is only built when the level is enabled
+#define logAt(level, msg) do { if (LOG_ENABLED(level)) logln(msg, level); } while (0)
+#define logDebug(msg) logAt(LOG_LEVEL_DEBUG, msg)
+#define logInfo(msg)  logAt(LOG_LEVEL_INFO, msg)
+#define logWarn(msg)  logAt(LOG_LEVEL_WARN, msg)
+#define logError(msg) logAt(LOG_LEVEL_ERROR, msg)
 
-// Convenience functions
-#define logDebug(msg) logln(msg, LOG_LEVEL_DEBUG)
-#define logInfo(msg)  logln(msg, LOG_LEVEL_INFO)
-#define logWarn(msg)  logln(msg, LOG_LEVEL_WARN)
-#define logError(msg) logln(msg, LOG_LEVEL_ERROR)
+// Formats must be string literals so tools/log_formats.py can collect them
+#if LOG_BINARY
+#define logfAt(level, fmt, ...) \
+  do { if (LOG_ENABLED(level)) logBinary(level, LOG_FORMAT_ID(fmt), fmt, ##__VA_ARGS__); } while (0)
+#else
+#define logfAt(level, ...) do { if (LOG_ENABLED(level)) logPrintf(level, __VA_ARGS__); } while (0)
+#endif
+#define logDebugf(...) logfAt(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define logInfof(...)  logfAt(LOG_LEVEL_INFO, __VA_ARGS__)
+#define logWarnf(...)  logfAt(LOG_LEVEL_WARN, __VA_ARGS__)
+#define logErrorf(...) logfAt(LOG_LEVEL_ERROR, __VA_ARGS__)
 
 void setLogLevel(LogLevel level);
 void initLogSettings();
@@ -0,0 +1,213 @@
+#include "log_binary.h"
+#include <stdio.h>
+#include <string.h>
+#include "config.h"
+
+enum ArgKind : uint8_t {
+  ARG_NONE = 0,  // %% (and unsupported conversions, which take no argument)
+  ARG_INT,
+  ARG_LONG,      // also size_t / ptrdiff_t
+  ARG_LLONG,
+  ARG_FLOAT,     // float and double, stored as float
+  ARG_STRING,
+  ARG_POINTER,
+};
+
+struct Spec {
+  ArgKind kind;
+  uint8_t stars;     // '*' width/precision, each an extra int argument
+  char length[3];    // h/hh kept as written, l/ll from the kind
+  char conversion;
+};
+
+// Parses the conversion after a '%'; returns the first char after it
+static const char* parseSpec(const char* p, Spec& spec) {
+  spec = Spec{};
+  while (*p && strchr("-+ #0", *p)) p++;
+  if (*p == '*') { spec.stars++; p++; }
+  while (*p >= '0' && *p <= '9') p++;
+  if (*p == '.') {
+    p++;
+    if (*p == '*') { spec.stars++; p++; }
+    while (*p >= '0' && *p <= '9') p++;
+  }
+  int longs = 0;
+  int shorts = 0;
+  while (*p && strchr("hlLjzt", *p)) {
+    if (*p == 'h') shorts++;
+    else if (*p == 'l') longs++;
+    else if (*p == 'j') longs = 2;
+    else if (*p == 'z' || *p == 't') longs = 1;
+    p++;
+  }
+  spec.conversion = *p;
+  if (!*p) return p;
+  switch (*p) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+      spec.kind = longs >= 2 ? ARG_LLONG : longs == 1 ? ARG_LONG : ARG_INT;
+      if (spec.kind == ARG_INT && shorts > 0) memcpy(spec.length, shorts > 1 ? "hh" : "h", shorts > 1 ? 3 : 2);
+      if (spec.kind == ARG_LONG) memcpy(spec.length, "l", 2);
+      if (spec.kind == ARG_LLONG) memcpy(spec.length, "ll", 3);
+      break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      spec.kind = ARG_FLOAT;
+      break;
+    case 's': spec.kind = ARG_STRING; break;
+    case 'p': spec.kind = ARG_POINTER; break;
+    default: spec.kind = ARG_NONE; break;
+  }
+  return p + 1;
+}
+
+template <typename T>
+static bool put(uint8_t*& p, const uint8_t* end, T value) {
+  if ((size_t)(end - p) < sizeof(T)) return false;
+  memcpy(p, &value, sizeof(T));
+  p += sizeof(T);
+  return true;
+}
+
+template <typename T>
+static bool take(const uint8_t*& p, const uint8_t* end, T& value) {
+  if ((size_t)(end - p) < sizeof(T)) return false;
+  memcpy(&value, p, sizeof(T));
+  p += sizeof(T);
+  return true;
+}
+
+const char* logFormatLookup(uint32_t id) {
+  size_t lo = 0;
+  size_t hi = LOG_FORMAT_COUNT;
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    if (LOG_FORMATS[mid].id < id) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo < LOG_FORMAT_COUNT && LOG_FORMATS[lo].id == id ? LOG_FORMATS[lo].fmt : nullptr;
+}
+
+size_t logBinaryPack(uint8_t* out, size_t size, uint32_t id, const char* fmt, va_list args) {
+  uint8_t* p = out;
+  const uint8_t* end = out + size;
+  if (!put(p, end, id)) return 0;
+  Spec spec;
+  while (*fmt) {
+    if (*fmt++ != '%') continue;
+    fmt = parseSpec(fmt, spec);
+    bool ok = true;
+    for (uint8_t i = 0; i < spec.stars && ok; i++) ok = put(p, end, (int32_t)va_arg(args, int));
+    switch (spec.kind) {
+      case ARG_INT: ok = ok && put(p, end, (int32_t)va_arg(args, int)); break;
+      case ARG_LONG: ok = ok && put(p, end, va_arg(args, long)); break;
+      case ARG_LLONG: ok = ok && put(p, end, (int64_t)va_arg(args, long long)); break;
+      case ARG_FLOAT: ok = ok && put(p, end, (float)va_arg(args, double)); break;
+      case ARG_POINTER: ok = ok && put(p, end, (uintptr_t)va_arg(args, void*)); break;
+      case ARG_STRING: {
+        const char* s = va_arg(args, const char*);
+        if (!s) s = "(null)";
+        size_t n = strnlen(s, LOG_ARG_STRING_MAX);
+        if (!ok || p >= end) return p - out;
+        if (n > (size_t)(end - p) - 1) n = (size_t)(end - p) - 1;
+        memcpy(p, s, n);
+        p[n] = '\0';
+        p += n + 1;
+        break;
+      }
+      case ARG_NONE: break;
+    }
+    if (!ok) break;  // out of room: later arguments are dropped
+  }
+  return p - out;
+}
+
+size_t logBinaryFormat(const uint8_t* payload, size_t length, char* out, size_t size) {
+  if (size == 0) return 0;
+  const uint8_t* p = payload;
+  const uint8_t* end = payload + length;
+  size_t pos = 0;
+  auto append = [&](int n) {
+    if (n > 0) pos += (size_t)n < size - pos ? (size_t)n : size - pos - 1;
+  };
+
+  uint32_t id = 0;
+  take(p, end, id);
+  const char* fmt = logFormatLookup(id);
+  if (!fmt) {
+    append(snprintf(out, size, "<log format %08lx, %u bytes>", (unsigned long)id, (unsigned)(end - p)));
+    return pos;
+  }
+
+  out[0] = '\0';
+  Spec spec;
+  while (*fmt && pos < size - 1) {
+    if (*fmt != '%') {
+      out[pos++] = *fmt++;
+      out[pos] = '\0';
+      continue;
+    }
+    const char* specStart = fmt++;
+    fmt = parseSpec(fmt, spec);
+    if (spec.conversion == '%') {
+      append(snprintf(out + pos, size - pos, "%%"));
+      continue;
+    }
+
+    // Rebuild the conversion with '*' resolved and a length matching the stored type
+    char conv[32];
+    size_t c = 0;
+    bool ok = true;
+    for (const char* s = specStart; s < fmt - 1 && c < sizeof(conv) - 12; s++) {
+      if (*s == '*') {
+        int32_t v = 0;
+        ok = ok && take(p, end, v);
+        c += snprintf(conv + c, sizeof(conv) - c, "%ld", (long)v);
+      } else if (!strchr("hlLjzt", *s)) {
+        conv[c++] = *s;
+      }
+    }
+    c += snprintf(conv + c, sizeof(conv) - c, "%s%c", spec.length, spec.conversion);
+    if (!ok) break;
+
+    switch (spec.kind) {
+      case ARG_INT: {
+        int32_t v;
+        if (!take(p, end, v)) return pos;
+        append(snprintf(out + pos, size - pos, conv, (int)v));
+        break;
+      }
+      case ARG_LONG: {
+        long v;
+        if (!take(p, end, v)) return pos;
+        append(snprintf(out + pos, size - pos, conv, v));
+        break;
+      }
+      case ARG_LLONG: {
+        int64_t v;
+        if (!take(p, end, v)) return pos;
+        append(snprintf(out + pos, size - pos, conv, (long long)v));
+        break;
+      }
+      case ARG_FLOAT: {
+        float v;
+        if (!take(p, end, v)) return pos;
+        append(snprintf(out + pos, size - pos, conv, (double)v));
+        break;
+      }
+      case ARG_POINTER: {
+        uintptr_t v;
+        if (!take(p, end, v)) return pos;
+        append(snprintf(out + pos, size - pos, conv, (void*)v));
+        break;
+      }
+      case ARG_STRING: {
+        const uint8_t* nul = p < end ? (const uint8_t*)memchr(p, '\0', end - p) : nullptr;
+        if (!nul) return pos;
+        append(snprintf(out + pos, size - pos, conv, (const char*)p));
+        p = nul + 1;
+        break;
+      }
+      case ARG_NONE: break;
+    }
+  }
+  return pos;
+}
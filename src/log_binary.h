@@ -0,0 +1,35 @@
+#pragma once
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+// Deferred-format log records: a 32-bit format ID followed by the raw
+// arguments (ints 4 bytes, long long 8, floating point as float, strings
+// inline and NUL-terminated). The ID is the FNV-1a hash of the format
+// string, computed at compile time; tools/log_formats.py collects every
+// log*f() format into src/log_formats.cpp so the device (and
+// tools/log_decode.py off-device) can turn records back into text.
+
+constexpr uint32_t logFormatHash(const char* s, uint32_t h = 2166136261u) {
+  return *s ? logFormatHash(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+// Forces the hash to be a compile-time constant; fmt must be a literal
+#define LOG_FORMAT_ID(fmt) (std::integral_constant<uint32_t, logFormatHash(fmt)>::value)
+
+struct LogFormat {
+  uint32_t id;
+  const char* fmt;
+};
+
+// Generated table, sorted by id
+extern const LogFormat LOG_FORMATS[];
+extern const size_t LOG_FORMAT_COUNT;
+
+// nullptr for IDs missing from the table (stale build)
+const char* logFormatLookup(uint32_t id);
+// Packs id and the arguments described by fmt; returns the bytes used
+size_t logBinaryPack(uint8_t* out, size_t size, uint32_t id, const char* fmt, va_list args);
+// Renders a packed record as text (NUL-terminated); returns its length
+size_t logBinaryFormat(const uint8_t* payload, size_t length, char* out, size_t size);
@@ -0,0 +1,155 @@
+#include "log_file.h"
+#include <stdio.h>
+#include <string.h>
+#include "log_text.h"
+
+void LogFileSink::poll(uint32_t nowMs) {
+  LogEntry entry;
+  for (;;) {
+    const uint32_t expected = cursor.seq > 0 ? cursor.seq : 1;
+    if (!logRingRead(cursor, entry, payload, sizeof(payload))) break;
+    if (entry.seq != expected) {
+      const uint32_t lost = entry.seq - expected;
+      counters.lostRecords += lost;
+      add(line, (size_t)snprintf(line, sizeof(line), "... %lu log records lost ...\n", (unsigned long)lost), nowMs);
+    }
+    size_t len = logFormatPrefix(entry, line, sizeof(line));
+    len += logFormatMessage(entry, payload, line + len, sizeof(line) - len - 1);
+    line[len++] = '\n';
+    add(line, len, nowMs);
+    if (entry.level >= LOG_LEVEL_WARN) urgent = true;
+  }
+  if (batchUsed > 0 && (urgent || nowMs - batchSinceMs >= LOG_FILE_FLUSH_MS)) writeBatch();
+}
+
+void LogFileSink::flush() {
+  if (batchUsed > 0) writeBatch();
+}
+
+void LogFileSink::add(const char* line, size_t len, uint32_t nowMs) {
+  if (batchUsed + len > sizeof(batch)) writeBatch();
+  if (batchUsed == 0) batchSinceMs = nowMs;
+  memcpy(batch + batchUsed, line, len);
+  batchUsed += len;
+}
+
+void LogFileSink::writeBatch() {
+  if (store.currentSize() > 0 && store.currentSize() + batchUsed > maxFileBytes && store.rotate()) {
+    counters.rotations++;
+  }
+  if (store.append(batch, batchUsed)) {
+    counters.writes++;
+    counters.bytesWritten += batchUsed;
+  }
+  batchUsed = 0;
+  urgent = false;
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <Arduino.h>
+#include "fs_compat.h"
+#include "log.h"
+
+static const char* const LOG_FILE_DIR = "/logs";
+static const uint32_t LOG_FILE_POLL_MS = 500;
+// The record buffers live in LogFileSink; this covers snprintf/strftime
+// and the SPIFFS open/write/rename call chains
+static const uint32_t LOG_FILE_TASK_STACK = 6144;
+
+static String logFilePath(int generation) {
+  return String(LOG_FILE_DIR) + "/log" + generation + ".txt";
+}
+
+// Generation 0 is the file being written, LOG_FILE_COUNT - 1 the oldest
+class FlashLogFileStore : public LogFileStore {
+public:
+  void begin() {
+    File f = FS_IMPL.open(logFilePath(0), "r");
+    size = f ? f.size() : 0;
+    if (f) f.close();
+  }
+
+  size_t currentSize() override { return size; }
+
+  bool append(const char* data, size_t len) override {
+    File f = FS_IMPL.open(logFilePath(0), FILE_APPEND);
+    if (!f) return false;
+    const size_t written = f.write((const uint8_t*)data, len);
+    f.close();
+    size += written;
+    return written == len;
+  }
+
+  bool rotate() override {
+    if (holds > 0) return false;
+    FS_IMPL.remove(logFilePath(LOG_FILE_COUNT - 1));
+    for (int g = LOG_FILE_COUNT - 1; g > 0; g--) {
+      if (FS_IMPL.exists(logFilePath(g - 1))) FS_IMPL.rename(logFilePath(g - 1), logFilePath(g));
+    }
+    size = 0;
+    return true;
+  }
+
+  uint8_t holds = 0;  // open downloads, under fileLock
+
+private:
+  size_t size = 0;
+};
+
+static FlashLogFileStore flashStore;
+static LogFileSink fileSink(flashStore);
+static SemaphoreHandle_t fileLock = nullptr;
+
+static void logFileTask(void*) {
+  for (;;) {
+    xSemaphoreTake(fileLock, portMAX_DELAY);
+    fileSink.poll(millis());
+    xSemaphoreGive(fileLock);
+    vTaskDelay(pdMS_TO_TICKS(LOG_FILE_POLL_MS));
+  }
+}
+
+void logFileBegin() {
+  if (fileLock) return;
+  fileLock = xSemaphoreCreateMutex();
+  flashStore.begin();
+  // Lowest priority on the network core: flash writes never hold up the loop
+  if (xTaskCreatePinnedToCore(logFileTask, "logfile", LOG_FILE_TASK_STACK, nullptr, 1, nullptr, 0) != pdPASS) {
+    logError("❌ Log file task start failed");
+  }
+}
+
+void logFileFlush() {
+  if (!fileLock) return;
+  xSemaphoreTake(fileLock, portMAX_DELAY);
+  fileSink.poll(millis());
+  fileSink.flush();
+  xSemaphoreGive(fileLock);
+}
+
+uint8_t logFileOpenAll(File* files, uint8_t max) {
+  if (!fileLock) return 0;
+  xSemaphoreTake(fileLock, portMAX_DELAY);
+  flashStore.holds++;
+  uint8_t count = 0;
+  for (int g = LOG_FILE_COUNT - 1; g >= 0 && count < max; g--) {
+    File f = FS_IMPL.open(logFilePath(g), "r");
+    if (f) files[count++] = f;
+  }
+  xSemaphoreGive(fileLock);
+  return count;
+}
+
+void logFileRelease() {
+  if (!fileLock) return;
+  xSemaphoreTake(fileLock, portMAX_DELAY);
+  if (flashStore.holds > 0) flashStore.holds--;
+  xSemaphoreGive(fileLock);
+}
+
+LogFileStats logFileStats() {
+  return fileSink.stats();
+}
+
+#endif
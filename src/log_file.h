@@ -0,0 +1,73 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+#include "log_ring.h"
+
+// Persistent log: records from the RAM ring are copied as text lines to
+// rotating files on flash, so the lines before a panic, brownout or watchdog
+// reset survive it. Lines are batched into LOG_FILE_CHUNK-sized writes;
+// warnings and errors are written at the next poll.
+
+// Where the batches go: files on flash on the device, memory in host checks
+class LogFileStore {
+public:
+  virtual ~LogFileStore() {}
+  virtual size_t currentSize() = 0;
+  virtual bool append(const char* data, size_t len) = 0;
+  // Ages every file by one generation (dropping the oldest) and starts an
+  // empty current file. False when rotation is held off; the batch then
+  // goes to the current file, which may grow past the size limit meanwhile.
+  virtual bool rotate() = 0;
+};
+
+struct LogFileStats {
+  uint32_t writes;
+  uint32_t bytesWritten;
+  uint32_t rotations;
+  uint32_t lostRecords;  // evicted from the ring before they were written
+};
+
+class LogFileSink {
+public:
+  explicit LogFileSink(LogFileStore& store, size_t maxFileBytes = LOG_FILE_MAX_BYTES)
+    : store(store), maxFileBytes(maxFileBytes) {}
+
+  // Moves new ring records into the batch and writes it when full, older
+  // than LOG_FILE_FLUSH_MS or holding a warning/error
+  void poll(uint32_t nowMs);
+  // Writes whatever is pending
+  void flush();
+  const LogFileStats& stats() const { return counters; }
+
+private:
+  void add(const char* line, size_t len, uint32_t nowMs);
+  void writeBatch();
+
+  LogFileStore& store;
+  size_t maxFileBytes;
+  LogCursor cursor;
+  char batch[LOG_FILE_CHUNK];
+  // Read/format buffers for poll(), kept off the writer task's stack
+  uint8_t payload[LOG_RECORD_MAX];
+  char line[LOG_RECORD_MAX + 96];
+  size_t batchUsed = 0;
+  uint32_t batchSinceMs = 0;
+  bool urgent = false;
+  LogFileStats counters = {};
+};
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <FS.h>
+
+// Starts the writer task; call after the filesystem is mounted
+void logFileBegin();
+// Writes pending records now (before a restart or a download)
+void logFileFlush();
+// Opens up to `max` log files for reading, oldest first, and holds off
+// rotation until logFileRelease() so they stay put while a download streams
+// them. Writes continue; the current file only grows. Returns the count.
+uint8_t logFileOpenAll(File* files, uint8_t max);
+void logFileRelease();
+LogFileStats logFileStats();
+#endif
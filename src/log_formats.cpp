@@ -0,0 +1,19 @@
+// Generated by tools/log_formats.py from the log*f() calls in src/. Do not edit by hand.
+#include "log_binary.h"
+
+const LogFormat LOG_FORMATS[] = {
+  {0x0c35760fu, "🧵 Job %lu (%s) queued"},
+  {0x25081cb9u, "🔢 Text part shown: %c"},
+  {0x50426ad1u, "Animation completed; segments=%u, HET IS duration=%us"},
+  {0x6078a40eu, "🌦️ Sequence: no weather data yet, step skipped"},
+  {0x6606c1bfu, "🔌 Boot, reset reason: %s"},
+  {0x71bdf5a4u, "✅ Sequence completed: %s"},
+  {0x940820ecu, "🎞️ Start animation to new text"},
+  {0x9d4fe720u, "🔄 %02d:%02d"},
+  {0x9ef23a6au, "Animation completed; segments=%u, HET IS duration=%s"},
+  {0xbf076470u, "⏰ Display wakeups last minute: %lu, LED frames shown/skipped: %lu/%lu"},
+  {0xcc0cf2e0u, "'HET IS' hidden after configured duration"},
+  {0xd45af7ffu, "🔁 Sequence started: %s"},
+  {0xffb5370cu, "MQTT reconnect failed (%s); retry in %lu ms"},
+};
+const size_t LOG_FORMAT_COUNT = 13;
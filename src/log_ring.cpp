@@ -0,0 +1,154 @@
+#include "log_ring.h"
+#include <string.h>
+#include "config.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <Arduino.h>
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+#define LOG_RING_LOCK() portENTER_CRITICAL(&logMux)
+#define LOG_RING_UNLOCK() portEXIT_CRITICAL(&logMux)
+#else
+#define LOG_RING_LOCK()
+#define LOG_RING_UNLOCK()
+#endif
+
+// Record layout in the arena: header, payload, padding to 4 bytes. A header
+// with WRAP_MARKER as length (or too little room for a header) means the
+// next record starts at offset 0. Sequence numbers are not stored: records
+// are contiguous, so a record's seq follows from its position after tail.
+struct RecordHeader {
+  uint32_t seconds;
+  uint16_t meta;    // bits 0-9 millis, 10-11 level, 12 synced, 13 binary
+  uint16_t length;
+};
+
+static const uint16_t META_MILLIS_MASK = 0x03FF;
+static const uint8_t META_LEVEL_SHIFT = 10;
+static const uint16_t META_SYNCED = 1u << 12;
+static const uint16_t META_BINARY = 1u << 13;
+
+static const uint16_t WRAP_MARKER = 0xFFFF;
+static const size_t HEADER_SIZE = sizeof(RecordHeader);
+static const size_t ARENA_SIZE = LOG_ARENA_SIZE;
+
+static_assert(sizeof(RecordHeader) == 8, "log record header must stay packed");
+static_assert(LOG_ARENA_SIZE % 4 == 0, "log arena must be 4-byte aligned");
+static_assert(LOG_RECORD_MAX + sizeof(RecordHeader) + 3 <= LOG_ARENA_SIZE / 4, "log records too large for arena");
+
+alignas(4) static uint8_t arena[ARENA_SIZE];
+static size_t head = 0;    // where the next record goes
+static size_t tail = 0;    // oldest record
+static size_t used = 0;    // bytes from tail to head, including skipped wrap space
+static uint32_t firstSeq = 1;
+static uint32_t nextSeq = 1;
+
+static size_t recordSize(size_t length) {
+  return (HEADER_SIZE + length + 3) & ~(size_t)3;
+}
+
+static const RecordHeader* headerAt(size_t offset) {
+  return reinterpret_cast<const RecordHeader*>(arena + offset);
+}
+
+// Start of the record at or after offset, following a wrap
+static size_t resolve(size_t offset) {
+  if (offset + HEADER_SIZE > ARENA_SIZE || headerAt(offset)->length == WRAP_MARKER) return 0;
+  return offset;
+}
+
+static void evictOldest() {
+  const size_t at = resolve(tail);
+  if (at != tail) {
+    used -= ARENA_SIZE - tail;  // wrap space
+    tail = 0;
+    return;
+  }
+  const size_t size = recordSize(headerAt(tail)->length);
+  used -= size;
+  tail += size;
+  if (tail == ARENA_SIZE) tail = 0;
+  firstSeq++;
+}
+
+void logRingAppend(const LogEntry& entry, const void* payload, size_t length) {
+  if (length > LOG_RECORD_MAX) length = LOG_RECORD_MAX;
+  const size_t size = recordSize(length);
+
+  RecordHeader h;
+  h.seconds = entry.seconds;
+  h.meta = (uint16_t)((entry.millis % 1000) | ((entry.level & 0x3) << META_LEVEL_SHIFT) |
+                      (entry.synced ? META_SYNCED : 0) | (entry.binary ? META_BINARY : 0));
+  h.length = (uint16_t)length;
+
+  LOG_RING_LOCK();
+  const size_t skip = ARENA_SIZE - head < size ? ARENA_SIZE - head : 0;
+  while (ARENA_SIZE - used < skip + size) evictOldest();
+  if (skip) {
+    if (skip >= HEADER_SIZE) {
+      RecordHeader marker = {};
+      marker.length = WRAP_MARKER;
+      memcpy(arena + head, &marker, HEADER_SIZE);
+    }
+    used += skip;
+    head = 0;
+  }
+
+  memcpy(arena + head, &h, HEADER_SIZE);
+  memcpy(arena + head + HEADER_SIZE, payload, length);
+  head += size;
+  if (head == ARENA_SIZE) head = 0;
+  used += size;
+  nextSeq++;
+  LOG_RING_UNLOCK();
+}
+
+bool logRingRead(LogCursor& cursor, LogEntry& entry, uint8_t* payload, size_t payloadSize) {
+  LOG_RING_LOCK();
+  // Clamp first: a reader at seq 0 of an empty ring is caught up
+  if (cursor.seq < firstSeq) cursor.seq = firstSeq;
+  if (cursor.seq >= nextSeq) {
+    LOG_RING_UNLOCK();
+    return false;
+  }
+  size_t offset;
+  if (cursor.seq == firstSeq) {
+    offset = resolve(tail);
+  } else if (cursor.offset <= ARENA_SIZE) {
+    // Hints come from an earlier read; the record is still live when its
+    // seq has not been evicted, so the offset is exact
+    offset = resolve(cursor.offset);
+  } else {
+    offset = resolve(tail);
+    for (uint32_t seq = firstSeq; seq < cursor.seq; seq++) {
+      offset = resolve(offset + recordSize(headerAt(offset)->length));
+    }
+  }
+
+  const RecordHeader* h = headerAt(offset);
+  entry.seq = cursor.seq;
+  entry.seconds = h->seconds;
+  entry.millis = h->meta & META_MILLIS_MASK;
+  entry.level = (uint8_t)((h->meta >> META_LEVEL_SHIFT) & 0x3);
+  entry.synced = (h->meta & META_SYNCED) != 0;
+  entry.binary = (h->meta & META_BINARY) != 0;
+  entry.length = h->length;
+  if (payloadSize > 0) {
+    memcpy(payload, arena + offset + HEADER_SIZE, h->length < payloadSize ? h->length : payloadSize);
+  }
+  cursor.seq++;
+  cursor.offset = offset + recordSize(h->length);
+  LOG_RING_UNLOCK();
+  return true;
+}
+
+uint32_t logRingFirstSeq() {
+  return firstSeq;
+}
+
+uint32_t logRingNextSeq() {
+  return nextSeq;
+}
+
+size_t logRingBytesUsed() {
+  return used;
+}
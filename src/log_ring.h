@@ -0,0 +1,33 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// In-memory log history: one preallocated byte arena used as a ring of
+// variable-length records, oldest records evicted first. Appends take a
+// short spinlock so any task can log; readers copy one record at a time.
+// Records keep raw time and payload; text is only produced when read.
+
+struct LogEntry {
+  uint32_t seq;       // increases by one per record, never reused
+  uint32_t seconds;   // epoch seconds when synced, else uptime seconds
+  uint16_t millis;    // millisecond part of millis() at the time of logging
+  uint8_t level;
+  bool synced;        // seconds is wall clock time
+  bool binary;        // payload is a packed format ID + arguments (log_binary.h)
+  uint16_t length;    // payload bytes
+};
+
+// Reader position; start at seq 0 to read from the oldest record
+struct LogCursor {
+  uint32_t seq = 0;
+  uint32_t offset = UINT32_MAX;  // arena offset hint for seq
+};
+
+// entry.seq is assigned by the ring
+void logRingAppend(const LogEntry& entry, const void* payload, size_t length);
+// Copies the next record at or after cursor.seq (payload truncated to
+// payloadSize) and advances the cursor. False when caught up.
+bool logRingRead(LogCursor& cursor, LogEntry& entry, uint8_t* payload, size_t payloadSize);
+uint32_t logRingFirstSeq();
+uint32_t logRingNextSeq();
+size_t logRingBytesUsed();
@@ -0,0 +1,139 @@
+#include "log_stream.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <Arduino.h>
+#include <errno.h>
+#include <lwip/sockets.h>
+#include "log.h"
+
+static const uint32_t KEEPALIVE_MS = 15000;
+static const size_t PENDING_MAX = 1024;
+
+struct TailClient {
+  bool active = false;
+  WiFiClient client;
+  LogCursor cursor;
+  uint32_t missed = 0;
+  uint32_t lastSendMs = 0;
+  char pending[PENDING_MAX];
+  size_t pendingLen = 0;
+  size_t pendingOff = 0;
+};
+
+static TailClient clients[LOG_STREAM_MAX_CLIENTS];
+
+static void dropClient(TailClient& c) {
+  c.client.stop();
+  c.active = false;
+  c.pendingLen = c.pendingOff = 0;
+}
+
+// Sends as much pending data as the socket takes without waiting
+static bool flushPending(TailClient& c) {
+  while (c.pendingOff < c.pendingLen) {
+    const int n = send(c.client.fd(), c.pending + c.pendingOff, c.pendingLen - c.pendingOff, MSG_DONTWAIT);
+    if (n > 0) {
+      c.pendingOff += (size_t)n;
+      c.lastSendMs = millis();
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return false;
+    dropClient(c);  // closed or reset by the browser
+    return false;
+  }
+  c.pendingLen = c.pendingOff = 0;
+  return true;
+}
+
+static bool queue(TailClient& c, const char* data, size_t len) {
+  if (c.pendingLen + len > PENDING_MAX) return false;
+  memcpy(c.pending + c.pendingLen, data, len);
+  c.pendingLen += len;
+  return true;
+}
+
+// Fills the (empty) pending buffer with the next events
+static void fillPending(TailClient& c) {
+  const uint32_t next = logRingNextSeq();
+  if (c.cursor.seq + LOG_STREAM_BACKLOG < next) {
+    // Too far behind: skip to the newest records
+    c.missed += next - LOG_STREAM_BACKLOG - c.cursor.seq;
+    c.cursor.seq = next - LOG_STREAM_BACKLOG;
+    c.cursor.offset = UINT32_MAX;
+  }
+
+  LogEntry entry;
+  uint8_t payload[LOG_RECORD_MAX];
+  char event[LOG_RECORD_MAX + 128];
+  while (c.cursor.seq < next) {
+    const LogCursor before = c.cursor;
+    if (!logRingRead(c.cursor, entry, payload, sizeof(payload))) break;
+    const uint32_t gap = entry.seq - before.seq;
+    size_t len = 0;
+    if (c.missed + gap > 0) {
+      len = snprintf(event, sizeof(event), "event: missed\ndata: %lu\n\n", (unsigned long)(c.missed + gap));
+    }
+    len += snprintf(event + len, sizeof(event) - len, "id: %lu\ndata: ", (unsigned long)entry.seq);
+    len += logFormatPrefix(entry, event + len, sizeof(event) - len);
+    const size_t start = len;
+    len += logFormatMessage(entry, payload, event + len, sizeof(event) - len - 2);
+    for (size_t i = start; i < len; i++) {
+      if (event[i] == '\n' || event[i] == '\r') event[i] = ' ';  // one data line per record
+    }
+    event[len++] = '\n';
+    event[len++] = '\n';
+    if (!queue(c, event, len)) {
+      c.cursor = before;  // next round
+      break;
+    }
+    c.missed = 0;
+  }
+}
+
+bool logStreamAttach(WiFiClient& client, uint32_t since) {
+  TailClient* slot = nullptr;
+  for (auto& c : clients) {
+    if (c.active && !c.client.connected()) dropClient(c);
+    if (!c.active && !slot) slot = &c;
+  }
+  if (!slot) return false;
+
+  // Headers written directly: the response stays open after the handler returns
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/event-stream\r\n"
+               "Cache-Control: no-store\r\n"
+               "Connection: keep-alive\r\n"
+               "\r\n"
+               "retry: 3000\n\n");
+  slot->client = client;  // shares the socket; WebServer releasing its copy does not close it
+  slot->active = true;
+  slot->cursor = LogCursor();
+  const uint32_t next = logRingNextSeq();
+  slot->cursor.seq = (since == 0 || since > next) ? next : since;
+  slot->missed = 0;
+  slot->pendingLen = slot->pendingOff = 0;
+  slot->lastSendMs = millis();
+  return true;
+}
+
+void logStreamLoop() {
+  for (auto& c : clients) {
+    if (!c.active) continue;
+    if (c.pendingLen > 0 && !flushPending(c)) continue;
+    if (c.cursor.seq != logRingNextSeq()) {
+      fillPending(c);
+    } else if (millis() - c.lastSendMs >= KEEPALIVE_MS) {
+      queue(c, ": ping\n\n", 8);  // also notices browsers that went away
+    }
+    if (c.pendingLen > 0) flushPending(c);
+  }
+}
+
+uint8_t logStreamClients() {
+  uint8_t n = 0;
+  for (auto& c : clients) n += c.active ? 1 : 0;
+  return n;
+}
+
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+#include <stdint.h>
+
+// Live log tail as Server-Sent Events. Each subscriber reads the log ring
+// through its own cursor; log() never waits for a subscriber. Writes are
+// non-blocking, and a client more than LOG_STREAM_BACKLOG records behind
+// skips ahead and receives "event: missed" with the number of records it
+// lost. Each record is sent with "id: <seq>" so EventSource reconnects
+// resume from Last-Event-ID.
+
+#define LOG_STREAM_MAX_CLIENTS 2
+#define LOG_STREAM_BACKLOG 64
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <WiFiClient.h>
+
+// Takes over the request's connection and sends the SSE response headers.
+// Records from seq `since` on are sent first (0 = only new records).
+// False when all client slots are taken.
+bool logStreamAttach(WiFiClient& client, uint32_t since);
+// Feeds subscribers; call every loop pass
+void logStreamLoop();
+uint8_t logStreamClients();
+#endif
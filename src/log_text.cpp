@@ -0,0 +1,46 @@
+#include "log_text.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "config.h"
+#include "log_binary.h"
+
+static inline const char* levelToTag(int level) {
+  switch (level) {
+    case LOG_LEVEL_DEBUG: return "DEBUG";
+    case LOG_LEVEL_INFO:  return "INFO";
+    case LOG_LEVEL_WARN:  return "WARN";
+    case LOG_LEVEL_ERROR: return "ERROR";
+    default:              return "INFO";
+  }
+}
+
+size_t logFormatPrefix(const LogEntry& entry, char* out, size_t size) {
+  int n;
+  if (!entry.synced) {
+    n = snprintf(out, size, "[uptime %lu.%03us][%s] ", (unsigned long)entry.seconds, (unsigned)entry.millis,
+                 levelToTag(entry.level));
+  } else {
+    // Format: [YYYY-MM-DD HH:MM:SS.mmm TZ][LEVEL]
+    const time_t t = (time_t)entry.seconds;
+    struct tm lt = {};
+    localtime_r(&t, &lt);
+    char datebuf[32];
+    char tzbuf[8];
+    strftime(datebuf, sizeof(datebuf), "%Y-%m-%d %H:%M:%S", &lt);
+    strftime(tzbuf, sizeof(tzbuf), "%Z", &lt);
+    n = snprintf(out, size, "[%s.%03u %s][%s] ", datebuf, (unsigned)entry.millis, tzbuf, levelToTag(entry.level));
+  }
+  if (n < 0) return 0;
+  return (size_t)n < size ? (size_t)n : size - 1;
+}
+
+size_t logFormatMessage(const LogEntry& entry, const uint8_t* payload, char* out, size_t size) {
+  if (size == 0) return 0;
+  const size_t length = entry.length < LOG_RECORD_MAX ? entry.length : LOG_RECORD_MAX;
+  if (entry.binary) return logBinaryFormat(payload, length, out, size);
+  const size_t n = length < size - 1 ? length : size - 1;
+  memcpy(out, payload, n);
+  out[n] = '\0';
+  return n;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "log_ring.h"
+
+// Text form of ring records, shared by Serial, /log, the log files, syslog
+// and the live tail. No Arduino dependencies, so it also builds on a host.
+
+enum LogLevel {
+  LOG_LEVEL_DEBUG = 0,
+  LOG_LEVEL_INFO,
+  LOG_LEVEL_WARN,
+  LOG_LEVEL_ERROR
+};
+
+// "[YYYY-MM-DD HH:MM:SS.mmm TZ][LEVEL] " (or uptime before time sync)
+size_t logFormatPrefix(const LogEntry& entry, char* out, size_t size);
+// Message text of a record read with logRingRead (binary records are formatted here)
+size_t logFormatMessage(const LogEntry& entry, const uint8_t* payload, char* out, size_t size);
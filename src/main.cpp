@@ -24,6 +24,9 @@
 #include "web_routes.h"
 #include "network_init.h"
 #include "log.h"
+#include "log_file.h"
+#include "log_stream.h"
+#include "file_stream.h"
 #include "config.h"
 #include "ota_init.h"
 #include "sequence_controller.h"
@@ -31,10 +34,11 @@
 #include "weather_settings.h"
 #include "ui_auth.h"
 #include "mqtt_client.h"
+#include "syslog_client.h"
+#include "background_jobs.h"
 
 
 bool clockEnabled = true;
-StartupSequence startupSequence;
 DisplaySettings displaySettings;
 UiAuth uiAuth;
 
@@ -69,9 +73,14 @@ void setup() {
   logError("SPIFFS mount failed.");
   } else {
   logDebug("SPIFFS loaded successfully.");
+  logFileBegin();             // Log history naar flash, overleeft resets
   }
+  logInfof("🔌 Boot, reset reason: %s", reset_reason_to_str(esp_reset_reason()));
 
+  fsLockBegin();              // Lock voor SPIFFS bestanden die jobs vervangen
+  jobsBegin();                // Achtergrondtaken (update check, MQTT test) buiten loop()
   initWebServer(server);      // Webserver en routes
+  syslog_begin();             // Optionele log-shipping naar een syslog server
 
   // Wacht op WiFi verbinding (max 20x proberen)
   logInfo("Checking WiFi connection");
@@ -98,28 +107,37 @@ void setup() {
   initTimeSync(TZ_INFO, NTP_SERVER1, NTP_SERVER2);
   initDisplay();
   initClothingSystem(uiAuth);
-  initStartupSequence(startupSequence);
+  initStartupSequence(sequencePlayer);
 }
 
 // Loop: hoofdprogramma, verwerkt webrequests, OTA, MQTT en kloklogica
 void loop() {
   server.handleClient();
+  logStreamLoop();
+  fileStreamLoop();
   ArduinoOTA.handle();
   mqttEventLoop();
+  syslog_loop();
 
   // Startup animatie: blokkeert klok tot animatie klaar is
-  if (updateStartupSequence(startupSequence)) {
+  static bool sequenceWasRunning = false;
+  if (updateStartupSequence(sequencePlayer)) {
+    sequenceWasRunning = true;
     return;  // Voorkomt dat klok al tijd toont
   }
+  if (sequenceWasRunning) {
+    sequenceWasRunning = false;
+    clothingDisplayRequestRefresh();  // Sequence heeft de LEDs overschreven
+  }
 
-  // Tijd- en animatie-update (clothingDisplayLoop regelt zelf per-minuut/animatie)
-  static unsigned long lastLoop = 0;
-  unsigned long now = millis();
-  if (now - lastLoop >= 50) {
-    lastLoop = now;
-    runClothingDisplayLoop();
+  // Tijd- en animatie-update: clothingDisplayLoop plant zelf zijn volgende deadline
+  runClothingDisplayLoop();
 
-    // Dagelijkse firmwarecheck om 02:00
+  // Dagelijkse firmwarecheck om 02:00 (controle elke 30 s is ruim voldoende)
+  static unsigned long lastFirmwarePoll = 0;
+  unsigned long now = millis();
+  if (now - lastFirmwarePoll >= 30000UL) {
+    lastFirmwarePoll = now;
     struct tm timeinfo;
     if (getLocalTime(&timeinfo)) {
       time_t nowEpoch = time(nullptr);
@@ -127,7 +145,7 @@ void loop() {
       if (timeinfo.tm_hour == 2 && timeinfo.tm_min == 0 && nowEpoch - lastFirmwareCheck > 3600) {
         if (displaySettings.getAutoUpdate()) {
           logInfo("🛠️ Daily firmware check started...");
-          checkForFirmwareUpdate();
+          startFirmwareUpdateJob();
         } else {
           logInfo("ℹ️ Automatic firmware updates disabled (02:00 check skipped)");
         }
@@ -6,17 +6,19 @@
 #include "display_settings.h"
 #include "led_state.h"
 #include "log.h"
+#include "log_file.h"
 #include "ota_updater.h"
 #include "clothing_display.h"
 #include "time_mapper.h"
 #include "sequence_controller.h"
 #include "mqtt_settings.h"
+#include "palette_settings.h"
+#include "led_controller.h"
 #include <esp_system.h>
 #include <Preferences.h>
 
 extern DisplaySettings displaySettings;
 extern bool clockEnabled;
-extern StartupSequence startupSequence;
 
 static WiFiClient espClient;
 static PubSubClient mqtt(espClient);
@@ -36,10 +38,12 @@ static String tAnimState, tAnimSet;
 static String tAutoUpdState, tAutoUpdSet;
 static String tSellState, tSellSet;
 static String tHetIsState, tHetIsSet;
+static String tPaletteState, tPaletteSet;
 static String tLogLvlState, tLogLvlSet;
 static String tRestartCmd, tSeqCmd, tUpdateCmd;
 static String tVersion, tUiVersion, tIp, tRssi, tUptime;
 static String tHeap, tWifiChan, tBootReason, tResetCount;
+static String tLedCurrent, tLedThrottle;
 
 static unsigned long lastReconnectAttempt = 0;
 static unsigned long lastStateAt = 0;
@@ -70,6 +74,8 @@ static void buildTopics() {
   tSellSet      = base + "/sell/set";
   tHetIsState   = base + "/hetis/state";
   tHetIsSet     = base + "/hetis/set";
+  tPaletteState = base + "/palette/state";
+  tPaletteSet   = base + "/palette/set";
   tLogLvlState  = base + "/loglevel/state";
   tLogLvlSet    = base + "/loglevel/set";
   tRestartCmd   = base + "/restart/press";
@@ -84,6 +90,8 @@ static void buildTopics() {
   tWifiChan     = base + "/wifi_channel";
   tBootReason   = base + "/boot_reason";
   tResetCount   = base + "/reset_count";
+  tLedCurrent   = base + "/led_current";
+  tLedThrottle  = base + "/led_throttle_events";
 }
 
 static void publishDiscovery() {
@@ -202,6 +210,8 @@ static void publishDiscovery() {
   publishSensor("WiFi Channel", tWifiChan, nodeId + String("_wifichan"));
   publishSensor("Boot Reason", tBootReason, nodeId + String("_bootreason"));
   publishSensor("Reset Count", tResetCount, nodeId + String("_resetcount"));
+  publishSensor("LED Current (mA)", tLedCurrent, nodeId + String("_ledcurrent"));
+  publishSensor("LED Throttle Events", tLedThrottle, nodeId + String("_ledthrottle"));
 }
 
 static void publishAvailability(const char* st) {
@@ -246,7 +256,7 @@ static bool g_bootTimeSet = false;
 static String g_bootReasonStr;
 static uint32_t g_resetCount = 0;
 
-static const char* reset_reason_to_str(esp_reset_reason_t r) {
+const char* reset_reason_to_str(esp_reset_reason_t r) {
   switch (r) {
     case ESP_RST_POWERON:   return "POWERON";
     case ESP_RST_EXT:       return "EXTERNAL";
@@ -273,6 +283,7 @@ void mqtt_publish_state(bool force) {
   publishSwitch(tAutoUpdState, displaySettings.getAutoUpdate());
   publishSwitch(tSellState, displaySettings.isSellMode());
   publishNumber(tHetIsState, displaySettings.getHetIsDurationSec());
+  mqtt.publish(tPaletteState.c_str(), paletteToJson().c_str(), true);
   publishSelect(tLogLvlState);
 
   mqtt.publish(tVersion.c_str(), FIRMWARE_VERSION, true);
@@ -286,6 +297,9 @@ void mqtt_publish_state(bool force) {
   }
   mqtt.publish(tBootReason.c_str(), g_bootReasonStr.c_str(), true);
   char rc[16]; snprintf(rc, sizeof(rc), "%lu", (unsigned long)g_resetCount); mqtt.publish(tResetCount.c_str(), rc, true);
+  const LedPowerStats power = ledPowerStats();
+  char ma[16]; snprintf(ma, sizeof(ma), "%u", (unsigned)power.estimatedMa); mqtt.publish(tLedCurrent.c_str(), ma, true);
+  char te[16]; snprintf(te, sizeof(te), "%lu", (unsigned long)power.throttleEvents); mqtt.publish(tLedThrottle.c_str(), te, true);
 
   // Publish last startup timestamp (local time) once NTP is synced
   time_t nowEpoch = time(nullptr);
@@ -332,17 +346,19 @@ static void handleMessage(char* topic, byte* payload, unsigned int length) {
         uint8_t r = doc["color"]["r"] | 0; uint8_t g = doc["color"]["g"] | 0; uint8_t b = doc["color"]["b"] | 0;
         ledState.setRGB(r,g,b);
       }
-      // Apply display immediately
-      struct tm timeinfo; if (getLocalTime(&timeinfo)) { auto idx = get_led_indices_for_time(&timeinfo); showLeds(idx); }
+      // Display loop applies the new state on its next pass
+      clothingDisplayRequestRefresh();
       publishLightState();
     }
   } else if (is(tClockSet)) {
     bool on = (msg == "ON" || msg == "on" || msg == "1");
     clockEnabled = on;
+    clothingDisplayRequestRefresh();
     publishSwitch(tClockState, on);
   } else if (is(tAnimSet)) {
     bool on = (msg == "ON" || msg == "on" || msg == "1");
     displaySettings.setAnimateWords(on);
+    clothingDisplayRequestRefresh();
     publishSwitch(tAnimState, on);
   } else if (is(tAutoUpdSet)) {
     bool on = (msg == "ON" || msg == "on" || msg == "1");
@@ -351,21 +367,37 @@ static void handleMessage(char* topic, byte* payload, unsigned int length) {
   } else if (is(tSellSet)) {
     bool on = (msg == "ON" || msg == "on" || msg == "1");
     displaySettings.setSellMode(on);
+    clothingDisplayRequestRefresh();
     publishSwitch(tSellState, on);
   } else if (is(tHetIsSet)) {
     int v = msg.toInt(); v = constrain(v, 0, 360); displaySettings.setHetIsDurationSec((uint16_t)v);
+    clothingDisplayRequestRefresh();
     publishNumber(tHetIsState, v);
+  } else if (is(tPaletteSet)) {
+    // {"slot":1,"color":"0050FF","white":0}
+    JsonDocument doc;
+    if (!deserializeJson(doc, msg) && doc["slot"].is<int>() && doc["color"].is<const char*>()) {
+      String err;
+      int white = constrain(doc["white"] | 0, 0, 255);
+      if (paletteSetFromHex((uint8_t)doc["slot"].as<int>(), String(doc["color"].as<const char*>()), (uint8_t)white, err)) {
+        clothingDisplayRequestRefresh();
+      } else {
+        logWarn("MQTT palette: " + err);
+      }
+    }
+    mqtt.publish(tPaletteState.c_str(), paletteToJson().c_str(), true);
   } else if (is(tLogLvlSet)) {
     LogLevel level = LOG_LEVEL_INFO;
     if (msg == "DEBUG") level = LOG_LEVEL_DEBUG; else if (msg == "INFO") level = LOG_LEVEL_INFO; else if (msg == "WARN") level = LOG_LEVEL_WARN; else if (msg == "ERROR") level = LOG_LEVEL_ERROR;
     setLogLevel(level);
     publishSelect(tLogLvlState);
   } else if (is(tRestartCmd)) {
+    logFileFlush();
     ESP.restart();
   } else if (is(tSeqCmd)) {
-    extern StartupSequence startupSequence; startupSequence.start();
+    sequencePlayer.start(displaySettings.getFastBoot() ? SEQUENCE_STARTUP_FAST : SEQUENCE_STARTUP);
   } else if (is(tUpdateCmd)) {
-    checkForFirmwareUpdate();
+    startFirmwareUpdateJob();
   }
 }
 
@@ -414,6 +446,7 @@ static bool mqtt_connect() {
   mqtt.subscribe(tAutoUpdSet.c_str());
   mqtt.subscribe(tSellSet.c_str());
   mqtt.subscribe(tHetIsSet.c_str());
+  mqtt.subscribe(tPaletteSet.c_str());
   mqtt.subscribe(tLogLvlSet.c_str());
   mqtt.subscribe(tRestartCmd.c_str());
   mqtt.subscribe(tSeqCmd.c_str());
@@ -469,9 +502,8 @@ void mqtt_loop() {
         unsigned long jittered = nextDelay + jitter;
         if (jittered > RECONNECT_DELAY_MAX_MS) jittered = RECONNECT_DELAY_MAX_MS;
         reconnectDelayMs = jittered;
-        String warnMsg = String("MQTT reconnect failed (") + (g_lastErr.length() ? g_lastErr : String("unknown")) +
-                         "); retry in " + reconnectDelayMs + " ms";
-        logWarn(warnMsg);
+        logWarnf("MQTT reconnect failed (%s); retry in %lu ms", g_lastErr.length() ? g_lastErr.c_str() : "unknown",
+                 (unsigned long)reconnectDelayMs);
       }
     }
     return;
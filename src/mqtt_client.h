@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <esp_system.h>
 
 void mqtt_begin();
 void mqtt_loop();
@@ -10,6 +11,9 @@ void mqtt_publish_state(bool force = false);
 struct MqttSettings; // fwd
 void mqtt_apply_settings(const MqttSettings& s);
 
+// "POWERON", "PANIC", "BROWNOUT", ... for esp_reset_reason()
+const char* reset_reason_to_str(esp_reset_reason_t r);
+
 // Status helpers for Web UI
 bool mqtt_is_connected();
 const String& mqtt_last_error();
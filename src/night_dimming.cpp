@@ -0,0 +1,100 @@
+#include "night_dimming.h"
+#include "sun_position.h"
+#include "weather_settings.h"
+#include "virtual_clock.h"
+
+NightDimSettings nightDimSettings;
+
+// Sun times for the current local day, valid for [cacheFrom, cacheUntil)
+static bool cacheValid = false;
+static time_t cacheFrom = 0;
+static time_t cacheUntil = 0;
+static SunState cacheState = SunState::NORMAL;
+static time_t sunriseAt = 0;
+static time_t sunsetAt = 0;
+
+static const time_t TIME_VALID_AFTER = 1640995200; // 2022-01-01, same threshold as MQTT
+
+// Days since 1970-01-01 for a civil date (proleptic Gregorian)
+static long daysFromCivil(int y, unsigned m, unsigned d) {
+  y -= m <= 2;
+  const long era = (y >= 0 ? y : y - 399) / 400;
+  const unsigned yoe = (unsigned)(y - era * 400);
+  const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097L + (long)doe - 719468L;
+}
+
+static bool recompute(time_t now) {
+  const String& lat = weatherSettings.getLatitude();
+  const String& lon = weatherSettings.getLongitude();
+  if (lat.length() == 0 || lon.length() == 0) return false;
+
+  struct tm lt;
+  if (!localtime_r(&now, &lt)) return false;
+  struct tm midnight = lt;
+  midnight.tm_hour = midnight.tm_min = midnight.tm_sec = 0;
+  midnight.tm_isdst = -1;
+  cacheFrom = mktime(&midnight);
+  midnight.tm_mday += 1;
+  midnight.tm_isdst = -1;
+  cacheUntil = mktime(&midnight); // mktime normalises month ends and DST days
+
+  const SunTimes sun = computeSunTimes(lat.toFloat(), lon.toFloat(), lt.tm_year + 1900, lt.tm_yday + 1);
+  const time_t utcMidnight = (time_t)daysFromCivil(lt.tm_year + 1900, lt.tm_mon + 1, lt.tm_mday) * 86400;
+  cacheState = sun.state;
+  sunriseAt = utcMidnight + (time_t)sun.sunriseMin * 60;
+  sunsetAt = utcMidnight + (time_t)sun.sunsetMin * 60;
+  cacheValid = true;
+  return true;
+}
+
+static bool ensureCache(time_t now) {
+  if (now < TIME_VALID_AFTER) return false;
+  if (cacheValid && now >= cacheFrom && now < cacheUntil) return true;
+  return recompute(now);
+}
+
+// 0 before the ramp, 256 after it, smoothstep in between (Q8)
+static uint16_t rampQ8(long sinceEvent, long halfRamp) {
+  if (sinceEvent <= -halfRamp) return 0;
+  if (sinceEvent >= halfRamp) return 256;
+  const uint32_t t = (uint32_t)((sinceEvent + halfRamp) * 256L / (2 * halfRamp));
+  return (uint16_t)((t * t * (768 - 2 * t)) >> 16);
+}
+
+uint8_t nightDimBrightness(uint8_t dayBrightness) {
+  if (!nightDimSettings.isEnabled()) return dayBrightness;
+  const time_t now = clockNow();
+  if (!ensureCache(now)) return dayBrightness;
+
+  uint16_t dayQ8;
+  if (cacheState == SunState::POLAR_DAY) {
+    dayQ8 = 256;
+  } else if (cacheState == SunState::POLAR_NIGHT) {
+    dayQ8 = 0;
+  } else {
+    const long halfRamp = (long)nightDimSettings.getRampMinutes() * 30;
+    if (halfRamp == 0) {
+      dayQ8 = (now >= sunriseAt && now < sunsetAt) ? 256 : 0;
+    } else {
+      const uint16_t up = rampQ8((long)(now - sunriseAt), halfRamp);
+      const uint16_t down = rampQ8((long)(sunsetAt - now), halfRamp);
+      dayQ8 = up < down ? up : down;
+    }
+  }
+
+  const int night = nightDimSettings.getNightBrightness();
+  return (uint8_t)(night + (((int)dayBrightness - night) * (int)dayQ8) / 256);
+}
+
+bool nightDimSunTimes(time_t& sunrise, time_t& sunset) {
+  if (!ensureCache(clockNow()) || cacheState != SunState::NORMAL) return false;
+  sunrise = sunriseAt;
+  sunset = sunsetAt;
+  return true;
+}
+
+void nightDimInvalidateCache() {
+  cacheValid = false;
+}
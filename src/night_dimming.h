@@ -0,0 +1,62 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <time.h>
+
+// Brightness follows the sun: the LedState brightness is the day level, and
+// the display ramps to a lower night level around sunset and back up around
+// sunrise. Sun times come from the WeatherSettings location.
+class NightDimSettings {
+public:
+  void begin() {
+    prefs.begin("nightdim", false);
+    enabled = prefs.getBool("on", false);
+    nightBrightness = prefs.getUChar("night_br", 8);
+    rampMinutes = prefs.getUShort("ramp", 60);
+    prefs.end();
+  }
+
+  bool isEnabled() const { return enabled; }
+  uint8_t getNightBrightness() const { return nightBrightness; }
+  // Length of the transition, centred on sunrise and sunset
+  uint16_t getRampMinutes() const { return rampMinutes; }
+
+  void setEnabled(bool on) {
+    enabled = on;
+    prefs.begin("nightdim", false);
+    prefs.putBool("on", enabled);
+    prefs.end();
+  }
+
+  void setNightBrightness(uint8_t level) {
+    nightBrightness = level;
+    prefs.begin("nightdim", false);
+    prefs.putUChar("night_br", nightBrightness);
+    prefs.end();
+  }
+
+  void setRampMinutes(uint16_t minutes) {
+    if (minutes > 240) minutes = 240;
+    rampMinutes = minutes;
+    prefs.begin("nightdim", false);
+    prefs.putUShort("ramp", rampMinutes);
+    prefs.end();
+  }
+
+private:
+  bool enabled = false;
+  uint8_t nightBrightness = 8;
+  uint16_t rampMinutes = 60;
+  Preferences prefs;
+};
+
+extern NightDimSettings nightDimSettings;
+
+// Brightness to show now for the given day level. Cheap enough to call per
+// frame: sun times are computed once per local day and cached.
+uint8_t nightDimBrightness(uint8_t dayBrightness);
+// Today's sunrise/sunset as epoch seconds; false without time sync or location
+bool nightDimSunTimes(time_t& sunrise, time_t& sunset);
+// Drop the cached sun times (location changed)
+void nightDimInvalidateCache();
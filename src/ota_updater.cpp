@@ -6,8 +6,11 @@
 #include "fs_compat.h"
 #include "config.h"
 #include "log.h"
+#include "log_file.h"
 #include "secrets.h"
 #include "ota_updater.h"
+#include "background_jobs.h"
+#include "web_assets.h"
 
 static const char* FS_VERSION_FILE = "/.fs_version"; // marker
 
@@ -66,10 +69,16 @@ static bool downloadToFs(const String& url, const String& path, WiFiClientSecure
   f.flush(); f.close();
   http.end();
 
-  FS_IMPL.remove(path);
-  if (!FS_IMPL.rename(tmp, path)) {
-    FS_IMPL.remove(tmp);
-    return false;
+  {
+    // serveFile() must not open the page between remove and rename
+    FsLock lock;
+    FS_IMPL.remove(path);
+    if (!FS_IMPL.rename(tmp, path)) {
+      FS_IMPL.remove(tmp);
+      return false;
+    }
+    // A precompressed copy of the old file would be served instead of this one
+    if (!path.endsWith(".gz") && FS_IMPL.exists(path + ".gz")) FS_IMPL.remove(path + ".gz");
   }
   logInfo("Wrote " + path + " (" + String(written) + " bytes)");
   return true;
@@ -147,6 +156,7 @@ void syncFilesFromManifest() {
     for (const auto& e : files) {
       if (!downloadToFs(e.url, e.path, *client)) { ok = false; }
     }
+    webAssetsInvalidate();
     if (ok && manifestVersion.length()) writeFsVersion(manifestVersion);
     logInfo(ok ? "✅ UI files synced." : "⚠️ Some UI files failed.");
   } else {
@@ -224,8 +234,20 @@ void checkForFirmwareUpdate() {
   if (Update.isFinished()) {
     logInfo("✅ Firmware updated, rebooting...");
     delay(500);
+    logFileFlush();
     ESP.restart();
   } else {
     logError("❌ Update not finished");
   }
 }
+
+uint32_t startFirmwareUpdateJob() {
+  const uint32_t running = jobActive("firmware-update");
+  if (running) return running;
+  return jobStart("firmware-update", [](String& message) {
+    checkForFirmwareUpdate();
+    // Returning at all means no new firmware was installed (that reboots)
+    message = "Finished without a firmware update; see the log";
+    return true;
+  });
+}
@@ -1,5 +1,9 @@
 // Public OTA functions (implementation in ota_updater.cpp)
 #pragma once
+#include <stdint.h>
 
 void syncFilesFromManifest();
 void checkForFirmwareUpdate();
+// Runs checkForFirmwareUpdate() as a background job (one at a time);
+// returns the job id, 0 when the job queue is full
+uint32_t startFirmwareUpdateJob();
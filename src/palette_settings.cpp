@@ -0,0 +1,48 @@
+#include "palette_settings.h"
+#include <ArduinoJson.h>
+
+PaletteSettings paletteSettings;
+
+static String hexColor(uint32_t c) {
+  char buf[7];
+  snprintf(buf, sizeof(buf), "%02X%02X%02X", (unsigned)((c >> 16) & 0xFF), (unsigned)((c >> 8) & 0xFF), (unsigned)(c & 0xFF));
+  return String(buf);
+}
+
+String paletteToJson() {
+  JsonDocument doc;
+  JsonArray arr = doc["slots"].to<JsonArray>();
+  for (uint8_t slot = 1; slot < PALETTE_SIZE; ++slot) {
+    const uint32_t c = paletteSettings.getColor(slot);
+    JsonObject o = arr.add<JsonObject>();
+    o["slot"] = slot;
+    o["name"] = PaletteSettings::slotName(slot);
+    o["color"] = hexColor(c);
+    o["white"] = (c >> 24) & 0xFF;
+  }
+  String out;
+  serializeJson(doc, out);
+  return out;
+}
+
+bool paletteSetFromHex(uint8_t slot, const String& hex, uint8_t white, String& error) {
+  if (slot == PALETTE_TEXT || slot >= PALETTE_SIZE) {
+    error = "slot must be 1.." + String(PALETTE_SIZE - 1) + " (slot 0 follows /setColor)";
+    return false;
+  }
+  String h = hex;
+  h.replace("#", "");
+  if (h.length() != 6) {
+    error = "color must be RRGGBB";
+    return false;
+  }
+  for (size_t i = 0; i < h.length(); ++i) {
+    if (!isxdigit((unsigned char)h[i])) {
+      error = "color must be RRGGBB";
+      return false;
+    }
+  }
+  const uint32_t rgb = (uint32_t)strtoul(h.c_str(), nullptr, 16) & 0xFFFFFF;
+  paletteSettings.setColor(slot, ((uint32_t)white << 24) | rgb);
+  return true;
+}
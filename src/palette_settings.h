@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Indexed colour palette for frames. Slot 0 is the clock text colour from
+// LedState (set via /setColor); the other slots are stored here. Colours are
+// packed 0xWWRRGGBB like Adafruit_NeoPixel::Color().
+constexpr uint8_t PALETTE_SIZE = 8;
+
+enum PaletteSlot : uint8_t {
+  PALETTE_TEXT = 0,
+  PALETTE_LONG_PANTS,
+  PALETTE_SHORTS,
+  PALETTE_RAIN,
+};
+
+class PaletteSettings {
+public:
+  void begin() {
+    prefs.begin("palette", false);
+    for (uint8_t i = 1; i < PALETTE_SIZE; ++i) {
+      colors[i] = prefs.getULong(key(i), defaultColor(i));
+    }
+    prefs.end();
+  }
+
+  // Slot 0 is owned by LedState and always reads as 0 here
+  uint32_t getColor(uint8_t slot) const {
+    return (slot > 0 && slot < PALETTE_SIZE) ? colors[slot] : 0;
+  }
+
+  bool setColor(uint8_t slot, uint32_t color) {
+    if (slot == 0 || slot >= PALETTE_SIZE) return false;
+    colors[slot] = color;
+    prefs.begin("palette", false);
+    prefs.putULong(key(slot), color);
+    prefs.end();
+    return true;
+  }
+
+  static const char* slotName(uint8_t slot) {
+    switch (slot) {
+      case PALETTE_TEXT: return "text";
+      case PALETTE_LONG_PANTS: return "long_pants";
+      case PALETTE_SHORTS: return "shorts";
+      case PALETTE_RAIN: return "rain";
+      default: return "custom";
+    }
+  }
+
+private:
+  static uint32_t defaultColor(uint8_t slot) {
+    switch (slot) {
+      case PALETTE_LONG_PANTS: return 0x000050FF; // blue
+      case PALETTE_SHORTS: return 0x00FF8000;     // orange
+      case PALETTE_RAIN: return 0x0000C8FF;       // cyan accent
+      default: return 0xFF000000;                 // white channel
+    }
+  }
+
+  static const char* key(uint8_t slot) {
+    static const char* const KEYS[PALETTE_SIZE] = { "c0", "c1", "c2", "c3", "c4", "c5", "c6", "c7" };
+    return KEYS[slot];
+  }
+
+  uint32_t colors[PALETTE_SIZE] = {};
+  Preferences prefs;
+};
+
+extern PaletteSettings paletteSettings;
+
+// {"slots":[{"slot":1,"name":"long_pants","color":"0050FF","white":0},...]}
+String paletteToJson();
+// Shared by REST and MQTT; returns false with a message on invalid input
+bool paletteSetFromHex(uint8_t slot, const String& hex, uint8_t white, String& error);
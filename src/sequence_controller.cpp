@@ -0,0 +1,228 @@
+#include "sequence_controller.h"
+#include <WiFi.h>
+#include <string.h>
+#include "grid_layout.h"
+#include "led_controller.h"
+#include "log.h"
+#include "palette_settings.h"
+#include "time_mapper.h"
+#include "weather_client.h"
+#include "clothing_advisor.h"
+#include "virtual_clock.h"
+#include <math.h>
+
+SequencePlayer sequencePlayer;
+
+static const unsigned long FADE_FRAME_MS = 16;
+static const unsigned long TEXT_GAP_MS = 150;  // blank between repeated characters
+
+static const SequenceStep STARTUP_STEPS[] = {
+  { SeqFrame::SWEEP,      SWEEP_STEP_MS, SeqTransition::CUT, PALETTE_TEXT, 1, nullptr },
+  { SeqFrame::TEXT,       IP_STEP_MS,    SeqTransition::CUT, PALETTE_TEXT, SEQ_TEXT_IP, nullptr },
+  { SeqFrame::CLEAR,      2000,          SeqTransition::CUT, PALETTE_TEXT, 0, nullptr },
+};
+
+// Same show with eight sweep lanes in parallel: 21 frames instead of 161
+static const SequenceStep STARTUP_FAST_STEPS[] = {
+  { SeqFrame::SWEEP,      SWEEP_STEP_MS, SeqTransition::CUT, PALETTE_TEXT, 8, nullptr },
+  { SeqFrame::TEXT,       IP_STEP_MS,    SeqTransition::CUT, PALETTE_TEXT, SEQ_TEXT_IP, nullptr },
+  { SeqFrame::CLEAR,      500,           SeqTransition::CUT, PALETTE_TEXT, 0, nullptr },
+};
+
+static const SequenceStep OUTFIT_STEPS[] = {
+  { SeqFrame::ALL,   1500, SeqTransition::FADE, PALETTE_LONG_PANTS, 0, nullptr },
+  { SeqFrame::ALL,   1500, SeqTransition::FADE, PALETTE_SHORTS,     0, nullptr },
+  { SeqFrame::ALL,   1500, SeqTransition::FADE, PALETTE_RAIN,       0, nullptr },
+  { SeqFrame::CLEAR, 500,  SeqTransition::CUT,  PALETTE_TEXT,       0, nullptr },
+};
+
+static const SequenceStep TEST_STEPS[] = {
+  { SeqFrame::ALL,           1000,          SeqTransition::CUT,  PALETTE_TEXT,       0, nullptr },
+  { SeqFrame::ALL,           1000,          SeqTransition::CUT,  PALETTE_LONG_PANTS, 0, nullptr },
+  { SeqFrame::ALL,           1000,          SeqTransition::CUT,  PALETTE_SHORTS,     0, nullptr },
+  { SeqFrame::ALL,           1000,          SeqTransition::CUT,  PALETTE_RAIN,       0, nullptr },
+  { SeqFrame::EXTRA_MINUTES, 1000,          SeqTransition::FADE, PALETTE_TEXT,       0, nullptr },
+  { SeqFrame::SWEEP,         SWEEP_STEP_MS, SeqTransition::CUT,  PALETTE_TEXT,       1, nullptr },
+  { SeqFrame::CLEAR,         500,           SeqTransition::CUT,  PALETTE_TEXT,       0, nullptr },
+};
+
+static const SequenceStep WEATHER_STEPS[] = {
+  { SeqFrame::TEXT,  800, SeqTransition::FADE, PALETTE_SHORTS, SEQ_TEXT_TEMPERATURE, nullptr },
+  { SeqFrame::CLEAR, 600, SeqTransition::CUT,  PALETTE_TEXT,   0,                    nullptr },
+  { SeqFrame::TEXT,  800, SeqTransition::FADE, PALETTE_RAIN,   SEQ_TEXT_RAIN,        nullptr },
+  { SeqFrame::CLEAR, 500, SeqTransition::CUT,  PALETTE_TEXT,   0,                    nullptr },
+};
+
+static const SequenceStep TIME_STEPS[] = {
+  { SeqFrame::TEXT,  800, SeqTransition::FADE, PALETTE_TEXT, SEQ_TEXT_TIME, nullptr },
+  { SeqFrame::CLEAR, 500, SeqTransition::CUT,  PALETTE_TEXT, 0,             nullptr },
+};
+
+#define SEQUENCE(name, steps) { name, steps, (uint8_t)(sizeof(steps) / sizeof(steps[0])) }
+const Sequence SEQUENCE_STARTUP = SEQUENCE("startup", STARTUP_STEPS);
+const Sequence SEQUENCE_STARTUP_FAST = SEQUENCE("startup_fast", STARTUP_FAST_STEPS);
+const Sequence SEQUENCE_OUTFIT = SEQUENCE("outfit", OUTFIT_STEPS);
+const Sequence SEQUENCE_TEST = SEQUENCE("test", TEST_STEPS);
+const Sequence SEQUENCE_WEATHER = SEQUENCE("weather", WEATHER_STEPS);
+const Sequence SEQUENCE_TIME = SEQUENCE("time", TIME_STEPS);
+#undef SEQUENCE
+
+const Sequence* findSequence(const String& name) {
+  static const Sequence* const ALL_SEQUENCES[] = {
+    &SEQUENCE_STARTUP, &SEQUENCE_STARTUP_FAST, &SEQUENCE_OUTFIT, &SEQUENCE_TEST,
+    &SEQUENCE_WEATHER, &SEQUENCE_TIME
+  };
+  for (const Sequence* s : ALL_SEQUENCES) {
+    if (name == s->name) return s;
+  }
+  return nullptr;
+}
+
+void SequencePlayer::prepareText(const SequenceStep& step) {
+  text.count = 0;
+  switch (step.arg) {
+    case SEQ_TEXT_LITERAL:
+      renderText(step.word, text);
+      break;
+    case SEQ_TEXT_IP:
+      renderText(WiFi.localIP().toString().c_str(), text);
+      break;
+    case SEQ_TEXT_TEMPERATURE:
+    case SEQ_TEXT_RAIN: {
+      // Cached data only: a fetch would stall the display loop for seconds
+      WeatherData data;
+      String msg;
+      bool stale = false;
+      const bool cached = weatherCachedData(data, stale);
+      if (!cached || stale) weatherRefreshAsync();
+      if (!cached) {
+        logDebugf("🌦️ Sequence: no weather data yet, step skipped");
+        break;
+      }
+      if (step.arg == SEQ_TEXT_TEMPERATURE) {
+        if (!isnan(data.temperatureC)) renderNumber(lroundf(data.temperatureC), text);
+        break;
+      }
+      OutfitRecommendation rec;
+      if (computeOutfitRecommendation(data, "now", rec, msg) && !isnan(rec.rainProbability)) {
+        renderNumber(lroundf(rec.rainProbability), text);
+      }
+      break;
+    }
+    case SEQ_TEXT_TIME: {
+      struct tm timeinfo;
+      if (clockLocalTime(&timeinfo)) renderTime(timeinfo.tm_hour, timeinfo.tm_min, text);
+      break;
+    }
+  }
+}
+
+unsigned long SequencePlayer::frameDuration(const SequenceStep& step) const {
+  if (step.frame == SeqFrame::TEXT && text.glyphs[frameIndex] == TEXT_GLYPH_BLANK) return TEXT_GAP_MS;
+  return step.durationMs;
+}
+
+uint16_t SequencePlayer::frameCountFor(const SequenceStep& step) const {
+  switch (step.frame) {
+    case SeqFrame::SWEEP: {
+      const uint16_t lanes = step.arg ? step.arg : 1;
+      return (NUM_LEDS + lanes - 1) / lanes;
+    }
+    case SeqFrame::TEXT:
+      return text.count;
+    default:
+      return 1;
+  }
+}
+
+void SequencePlayer::start(const Sequence& sequence) {
+  current = &sequence;
+  stepIndex = 0;
+  logDebugf("🔁 Sequence started: %s", sequence.name);
+  beginStep(millis());
+}
+
+void SequencePlayer::beginStep(unsigned long now) {
+  // Skip steps without frames (e.g. no IP address yet)
+  while (stepIndex < current->count) {
+    const SequenceStep& step = current->steps[stepIndex];
+    if (step.frame == SeqFrame::TEXT) prepareText(step);
+    frameCount = frameCountFor(step);
+    if (frameCount > 0) break;
+    ++stepIndex;
+  }
+  if (stepIndex >= current->count) {
+    showLeds({});
+    logInfof("✅ Sequence completed: %s", current->name);
+    current = nullptr;
+    return;
+  }
+  frameIndex = 0;
+  frameStart = now;
+  const SequenceStep& step = current->steps[stepIndex];
+  renderFrame(step.transition == SeqTransition::FADE ? 0 : 255);
+  lastRender = now;
+}
+
+void SequencePlayer::renderFrame(uint8_t level) {
+  const SequenceStep& step = current->steps[stepIndex];
+  static uint8_t levels[NUM_LEDS];
+  static uint8_t slots[NUM_LEDS];
+  memset(levels, 0, sizeof(levels));
+  memset(slots, step.palette, sizeof(slots));
+
+  auto light = [&](uint16_t led) {
+    if (led < NUM_LEDS) levels[led] = level;
+  };
+  switch (step.frame) {
+    case SeqFrame::CLEAR:
+      break;
+    case SeqFrame::ALL:
+      for (uint16_t i = 0; i < NUM_LEDS; ++i) light(i);
+      break;
+    case SeqFrame::WORD:
+      for (uint16_t led : get_leds_for_word(step.word)) light(led);
+      break;
+    case SeqFrame::EXTRA_MINUTES:
+      for (int i = 0; i < 4; ++i) light(EXTRA_MINUTE_LEDS[i]);
+      break;
+    case SeqFrame::SWEEP:
+      // Lane k lights LED frameIndex + k * frameCount, so all lanes finish together
+      for (uint16_t led = frameIndex; led < NUM_LEDS; led += frameCount) light(led);
+      break;
+    case SeqFrame::TEXT:
+      textFrameLeds(text, frameIndex, levels, level);
+      if (level == 255 && text.glyphs[frameIndex] != TEXT_GLYPH_BLANK) {
+        logDebugf("🔢 Text part shown: %c", text.chars[frameIndex]);
+      }
+      break;
+  }
+  showLedFrame(levels, slots);
+}
+
+void SequencePlayer::update() {
+  if (!current) return;
+  const unsigned long now = millis();
+  const SequenceStep& step = current->steps[stepIndex];
+  const unsigned long elapsed = now - frameStart;
+  const unsigned long durationMs = frameDuration(step);
+
+  if (elapsed < durationMs) {
+    const unsigned long fadeMs = durationMs / 2;
+    if (step.transition == SeqTransition::FADE && elapsed <= fadeMs + FADE_FRAME_MS &&
+        now - lastRender >= FADE_FRAME_MS) {
+      renderFrame(elapsed >= fadeMs ? 255 : (uint8_t)(elapsed * 255UL / fadeMs));
+      lastRender = now;
+    }
+    return;
+  }
+
+  if (++frameIndex < frameCount) {
+    frameStart = now;
+    renderFrame(step.transition == SeqTransition::FADE ? 0 : 255);
+    lastRender = now;
+    return;
+  }
+  ++stepIndex;
+  beginStep(now);
+}
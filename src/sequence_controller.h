@@ -1,149 +1,82 @@
 #pragma once
-#include <vector>
-#include <string>
-#include <WiFi.h>
-#include "led_controller.h"
-#include "grid_layout.h"
-#include "time_mapper.h"
-#include "log.h"
+#include <Arduino.h>
+#include "config.h"
+#include "text_renderer.h"
 
-class StartupSequence {
-public:
-  enum State {
-    SWEEP,
-    IP_DIGITS,
-    IP_LAST_HOLD,
-    IP_PAUSE,
-    DONE
-  };
-
-  StartupSequence() : state(SWEEP), index(0), lastUpdate(0), step(0) {}
+// Declarative LED sequences: a sequence is a table of steps, each one frame
+// (or a run of generated frames) with a duration and a transition. The
+// startup show, IP display, outfit showcase and test patterns are all data
+// interpreted by SequencePlayer.
 
-  void start() {
-    state = SWEEP;
-    index = 0;
-    step = 0;
-    lastUpdate = millis();
-  logDebug("🔁 Startup: Sweep started");
-  }
+enum class SeqFrame : uint8_t {
+  CLEAR,          // all LEDs off
+  ALL,            // every LED
+  WORD,           // one word from the active grid (step.word)
+  EXTRA_MINUTES,  // the four minute LEDs
+  SWEEP,          // run through all LEDs; arg = parallel lanes (1 = one LED at a time)
+  TEXT,           // one frame per character; arg = SeqText source
+};
 
-  void update() {
-    unsigned long now = millis();
+// What a TEXT step shows
+enum SeqText : uint16_t {
+  SEQ_TEXT_LITERAL = 0,  // step.word
+  SEQ_TEXT_IP,           // current IP address
+  SEQ_TEXT_TEMPERATURE,  // current temperature, whole degrees
+  SEQ_TEXT_RAIN,         // rain probability now, percent
+  SEQ_TEXT_TIME,         // local time as H.MM
+};
 
-    switch (state) {
-      case SWEEP:
-        if (now - lastUpdate >= SWEEP_STEP_MS && index < NUM_LEDS) {
-          showLeds({ (uint16_t)index });
-          index++;
-          lastUpdate = now;
-          if (index >= NUM_LEDS) {
-            state = IP_DIGITS;
-            logDebug("📡 Startup: IP address animation");
-            prepareIPSequence();
-            // Toon direct het eerste element van het IP-adres
-            if (!ipSequence.empty()) {
-              showLeds(ipSequence[0]);
-              logDebug(String("🔢 IP part shown: ") + ipLabels[0]);
-              step = 1;
-            } else {
-              step = 0;
-            }
-            lastUpdate = now;
-          }
-        }
-        break;
+enum class SeqTransition : uint8_t {
+  CUT,   // frame appears at once
+  FADE,  // frame fades in during the first half of its duration
+};
 
-      case IP_DIGITS:
-        if (now - lastUpdate >= IP_STEP_MS && step < ipSequence.size()) {
-          showLeds(ipSequence[step]);
-          logDebug(String("🔢 IP part shown: ") + ipLabels[step]);
-          step++;
-          lastUpdate = now;
-          if (step >= ipSequence.size()) {
-            // Laat het laatste IP-deel nog IP_STEP_MS zichtbaar blijven
-            state = IP_LAST_HOLD;
-            lastUpdate = now;
-          }
-        }
-        break;
+struct SequenceStep {
+  SeqFrame frame;
+  uint16_t durationMs;      // per generated frame for SWEEP and TEXT
+  SeqTransition transition;
+  uint8_t palette;          // PaletteSlot for the lit LEDs
+  uint16_t arg;
+  const char* word;
+};
 
-      case IP_LAST_HOLD:
-        // Short intermediate step: keep last shown digit/dot visible,
-        // then clear before entering pause.
-        if (now - lastUpdate >= IP_STEP_MS) {
-          showLeds({});
-          state = IP_PAUSE;
-          lastUpdate = now;
-          logDebug("⏳ Startup: pause after IP display");
-        }
-        break;
+struct Sequence {
+  const char* name;
+  const SequenceStep* steps;
+  uint8_t count;
+};
 
-      case IP_PAUSE:
-        if (now - lastUpdate >= 2000) {
-          state = DONE;
-          showLeds({});
-          logInfo("✅ Startup completed");
-        }
-        break;
+extern const Sequence SEQUENCE_STARTUP;       // full sweep, then the IP address
+extern const Sequence SEQUENCE_STARTUP_FAST;  // 8-lane sweep, then the IP address
+extern const Sequence SEQUENCE_OUTFIT;        // long pants / shorts / rain colours
+extern const Sequence SEQUENCE_TEST;          // palette and sweep test pattern
+extern const Sequence SEQUENCE_WEATHER;       // temperature, then rain percentage
+extern const Sequence SEQUENCE_TIME;          // the time spelled out
 
-      case DONE:
-      default:
-        break;
-    }
-  }
+// Lookup by name for /startSequence?name=; nullptr if unknown
+const Sequence* findSequence(const String& name);
 
-  bool isRunning() const { return state != DONE; }
+class SequencePlayer {
+public:
+  void start(const Sequence& sequence);
+  void update();
+  bool isRunning() const { return current != nullptr; }
+  const char* runningName() const { return current ? current->name : ""; }
 
 private:
-  State state;
-  uint16_t index;
-  unsigned long lastUpdate;
-  int step;
-  std::vector<std::vector<uint16_t>> ipSequence;
-  std::vector<String> ipLabels;
-  // Timing and LED indices from config.h are now used directly as global constexprs from config.h
+  void beginStep(unsigned long now);
+  void renderFrame(uint8_t level);
+  uint16_t frameCountFor(const SequenceStep& step) const;
+  unsigned long frameDuration(const SequenceStep& step) const;
+  void prepareText(const SequenceStep& step);
 
-  void prepareIPSequence() {
-    IPAddress ip = WiFi.localIP();
-    ipSequence.clear();
-    ipLabels.clear();
-
-    for (int i = 0; i < 4; ++i) {
-      int part = ip[i];
-      String partStr = String(part);
-      for (int j = 0; j < partStr.length(); ++j) {
-        char digit = partStr[j];
-        std::string word;
-        switch (digit) {
-          case '0': {
-            // Toon '0' als de letter 'O' uit de grid (links in "OVER")
-            ipSequence.push_back({ static_cast<uint16_t>(IP_ZERO_O_LED_INDEX) });
-            ipLabels.push_back("0");
-            continue;
-          }
-          case '1': word = "EEN"; break;
-          case '2': word = "TWEE"; break;
-          case '3': word = "DRIE"; break;
-          case '4': word = "VIER"; break;
-          case '5': word = "VIJF"; break;
-          case '6': word = "ZES"; break;
-          case '7': word = "ZEVEN"; break;
-          case '8': word = "ACHT"; break;
-          case '9': word = "NEGEN"; break;
-        }
-        ipSequence.push_back(get_leds_for_word(word.c_str()));
-        ipLabels.push_back(String(digit));
-      }
-      if (i < 3) {
-        // Scheidingsteken '.': toon alle 4 minuten-LEDs
-        ipSequence.push_back({
-          static_cast<uint16_t>(EXTRA_MINUTE_LEDS[0]),
-          static_cast<uint16_t>(EXTRA_MINUTE_LEDS[1]),
-          static_cast<uint16_t>(EXTRA_MINUTE_LEDS[2]),
-          static_cast<uint16_t>(EXTRA_MINUTE_LEDS[3])
-        });
-        ipLabels.push_back(".");
-      }
-    }
-  }
+  const Sequence* current = nullptr;
+  uint8_t stepIndex = 0;
+  uint16_t frameIndex = 0;
+  uint16_t frameCount = 0;
+  unsigned long frameStart = 0;
+  unsigned long lastRender = 0;
+  TextFrames text;
 };
+
+extern SequencePlayer sequencePlayer;
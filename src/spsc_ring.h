@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Lock-free single-producer/single-consumer ring buffer. One task pushes,
+// another pops; neither blocks or takes a lock. Capacity must be a power of two.
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  bool push(const T& item) {
+    const uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= Capacity) return false; // full
+    slots[h & (Capacity - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T& item) {
+    const uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false; // empty
+    item = slots[t & (Capacity - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+  }
+
+private:
+  T slots[Capacity];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+};
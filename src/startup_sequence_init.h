@@ -1,21 +1,22 @@
 #pragma once
 
 #include "sequence_controller.h"
+#include "display_settings.h"
 #include "log.h"
 
 // Initialize and start the startup animation
 // This function starts the clock's startup animation.
 // Called after setup so the clock only becomes active after the animation.
-inline void initStartupSequence(StartupSequence& startupSequence) {
-    startupSequence.start();
-    logInfo("🟢 StartupSequence started");
+inline void initStartupSequence(SequencePlayer& player) {
+    player.start(displaySettings.getFastBoot() ? SEQUENCE_STARTUP_FAST : SEQUENCE_STARTUP);
+    logInfo(String("🟢 Startup sequence started (") + player.runningName() + ")");
 }
 
-// Update the startup animation
+// Update the running sequence (startup or started via web/MQTT)
 // This function updates the animation and indicates whether the clock can be shown yet.
-inline bool updateStartupSequence(StartupSequence& startupSequence) {
-    if (startupSequence.isRunning()) {
-        startupSequence.update();
+inline bool updateStartupSequence(SequencePlayer& player) {
+    if (player.isRunning()) {
+        player.update();
         return true; // animatie actief, klok nog niet tonen
     }
     return false; // animatie klaar
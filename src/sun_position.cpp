@@ -0,0 +1,40 @@
+#include "sun_position.h"
+#include <math.h>
+
+static bool isLeapYear(int year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+SunTimes computeSunTimes(float latDeg, float lonDeg, int year, int dayOfYear) {
+  const float DEG = (float)M_PI / 180.0f;
+  const float daysInYear = isLeapYear(year) ? 366.0f : 365.0f;
+
+  // Fractional year at solar noon, in radians
+  const float g = 2.0f * (float)M_PI / daysInYear * (dayOfYear - 1);
+  const float eqTimeMin = 229.18f * (0.000075f + 0.001868f * cosf(g) - 0.032077f * sinf(g)
+                                     - 0.014615f * cosf(2 * g) - 0.040849f * sinf(2 * g));
+  const float decl = 0.006918f - 0.399912f * cosf(g) + 0.070257f * sinf(g)
+                     - 0.006758f * cosf(2 * g) + 0.000907f * sinf(2 * g)
+                     - 0.002697f * cosf(3 * g) + 0.00148f * sinf(3 * g);
+
+  // Hour angle where the upper limb touches the horizon (90.833° incl. refraction)
+  const float lat = latDeg * DEG;
+  const float cosHa = cosf(90.833f * DEG) / (cosf(lat) * cosf(decl)) - tanf(lat) * tanf(decl);
+
+  SunTimes out = { SunState::NORMAL, 0, 0 };
+  const float noonMin = 720.0f - 4.0f * lonDeg - eqTimeMin;
+  if (cosHa > 1.0f) {
+    out.state = SunState::POLAR_NIGHT;
+    out.sunriseMin = out.sunsetMin = (int16_t)lroundf(noonMin);
+    return out;
+  }
+  if (cosHa < -1.0f) {
+    out.state = SunState::POLAR_DAY;
+    out.sunriseMin = out.sunsetMin = (int16_t)lroundf(noonMin);
+    return out;
+  }
+  const float haMin = 4.0f * acosf(cosHa) / DEG;
+  out.sunriseMin = (int16_t)lroundf(noonMin - haMin);
+  out.sunsetMin = (int16_t)lroundf(noonMin + haMin);
+  return out;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+// Sunrise/sunset from latitude/longitude, NOAA general solar position
+// approximation (about one minute accurate outside the polar circles).
+// Runs locally so no weather API call is needed.
+enum class SunState : uint8_t {
+  NORMAL = 0,   // sun rises and sets on this day
+  POLAR_DAY,    // sun stays above the horizon
+  POLAR_NIGHT,  // sun stays below the horizon
+};
+
+struct SunTimes {
+  SunState state;
+  int16_t sunriseMin;  // minutes after 00:00 UTC; may be < 0 or > 1440 far from Greenwich
+  int16_t sunsetMin;
+};
+
+// dayOfYear is 1..366; latitude north and longitude east are positive
+SunTimes computeSunTimes(float latDeg, float lonDeg, int year, int dayOfYear);
@@ -0,0 +1,215 @@
+#include "syslog_client.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "log.h"
+
+static const uint8_t SEVERITY[] = { 7, 6, 4, 3 };  // DEBUG, INFO, WARN, ERROR
+
+size_t syslogFormat(const LogEntry& entry, const char* text, const char* hostname, char* out, size_t size) {
+  char timestamp[32] = "-";
+  if (entry.synced) {
+    const time_t t = (time_t)entry.seconds;
+    struct tm utc = {};
+    gmtime_r(&t, &utc);
+    const size_t n = strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", &utc);
+    snprintf(timestamp + n, sizeof(timestamp) - n, ".%03uZ", (unsigned)entry.millis);
+  }
+  // Returns the full length, like snprintf, so callers can tell it was cut
+  const int n = snprintf(out, size, "<%u>1 %s %s ciws - - [meta sequenceId=\"%lu\"] \xEF\xBB\xBF%s",
+                         (unsigned)(SYSLOG_FACILITY * 8 + SEVERITY[entry.level & 3]), timestamp, hostname,
+                         (unsigned long)entry.seq, text);
+  return n < 0 ? 0 : (size_t)n;
+}
+
+void SyslogShipper::configure(const char* name, uint8_t level, uint8_t perDatagram, uint16_t perSec) {
+  snprintf(hostname, sizeof(hostname), "%s", name && *name ? name : "-");
+  minLevel = level;
+  maxPerDatagram = perDatagram > 0 ? perDatagram : 1;
+  ratePerSec = perSec > 0 ? perSec : 1;
+  if (milliTokens > (uint32_t)ratePerSec * 1000) milliTokens = (uint32_t)ratePerSec * 1000;
+}
+
+bool SyslogShipper::poll(uint32_t nowMs) {
+  const uint32_t capacity = (uint32_t)ratePerSec * 1000;
+  if (!started) {
+    started = true;
+    milliTokens = capacity;
+  } else {
+    uint32_t elapsed = nowMs - lastRefillMs;
+    if (elapsed > 1000) elapsed = 1000;
+    milliTokens += elapsed * ratePerSec;
+    if (milliTokens > capacity) milliTokens = capacity;
+  }
+  lastRefillMs = nowMs;
+  if (milliTokens < 1000) return false;
+
+  LogEntry entry;
+  uint8_t payload[LOG_RECORD_MAX];
+  char text[LOG_RECORD_MAX + 1];
+  size_t used = 0;
+  uint8_t count = 0;
+  while (count < maxPerDatagram) {
+    const LogCursor before = cursor;
+    if (!logRingRead(cursor, entry, payload, sizeof(payload))) break;
+    // Evicted records show up as a gap; the very first read starts wherever the ring does
+    const uint32_t gap = before.seq > 0 ? entry.seq - before.seq : 0;
+    if (entry.level < minLevel) {
+      counters.dropped += gap;
+      continue;
+    }
+
+    logFormatMessage(entry, payload, text, sizeof(text));
+    for (char* c = text; *c; c++) {
+      if (*c == '\n' || *c == '\r') *c = ' ';  // LF separates messages
+    }
+    char* dst = datagram + used + (used > 0 ? 1 : 0);
+    const size_t room = sizeof(datagram) - (size_t)(dst - datagram);
+    size_t len = syslogFormat(entry, text, hostname, dst, room);
+    if (len >= room) {
+      if (used > 0) {
+        cursor = before;  // next datagram
+        break;
+      }
+      len = room - 1;  // a single oversized message is truncated
+    }
+    if (used > 0) datagram[used] = '\n';
+    used = (size_t)(dst - datagram) + len;
+    counters.dropped += gap;
+    count++;
+  }
+  if (count == 0) return false;
+
+  milliTokens -= 1000;
+  if (!transport.send((const uint8_t*)datagram, used)) {
+    // Backpressure: drop this batch and wait for the bucket to refill
+    counters.sendErrors++;
+    counters.dropped += count;
+    milliTokens = 0;
+    return false;
+  }
+  counters.datagrams++;
+  counters.records += count;
+  return true;
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "background_jobs.h"
+#include "config.h"
+#include "syslog_settings.h"
+
+static const uint32_t RESOLVE_RETRY_MS = 300000;
+
+class UdpSyslogTransport : public SyslogTransport {
+public:
+  void setTarget(const IPAddress& ip, uint16_t p) {
+    target = ip;
+    port = p;
+  }
+
+  bool send(const uint8_t* data, size_t len) override {
+    if (!udp.beginPacket(target, port)) return false;
+    udp.write(data, len);
+    return udp.endPacket() == 1;
+  }
+
+private:
+  WiFiUDP udp;
+  IPAddress target;
+  uint16_t port = 514;
+};
+
+static SyslogSettings g_syslogCfg;
+static UdpSyslogTransport udpTransport;
+static SyslogShipper shipper(udpTransport);
+static bool g_resolved = false;
+static uint32_t g_lastResolveMs = 0;
+// Host names are looked up on the jobs task (DNS blocks); the job hands its
+// result to syslog_loop() through these. A lookup for an older target
+// (settings changed meanwhile) is ignored.
+static uint32_t g_targetGeneration = 1;
+static volatile uint32_t g_lookupGeneration = 0;  // set last, publishes g_lookupIp
+static volatile uint32_t g_lookupIp = 0;          // 0 = not resolved
+
+static void useTarget(const IPAddress& ip) {
+  g_resolved = true;
+  udpTransport.setTarget(ip, g_syslogCfg.port);
+  logInfo(String("📤 Syslog to ") + ip.toString() + ":" + g_syslogCfg.port);
+}
+
+// IP literals need no lookup; host names get a background job, at most
+// every RESOLVE_RETRY_MS while it fails. Records wait in the ring meanwhile.
+static void resolveTarget() {
+  g_lastResolveMs = millis();
+  IPAddress ip;
+  if (ip.fromString(g_syslogCfg.host)) {
+    useTarget(ip);
+    return;
+  }
+  if (jobActive("syslog-dns")) return;
+  const uint32_t generation = g_targetGeneration;
+  const String host = g_syslogCfg.host;
+  jobStart("syslog-dns", [generation, host](String& message) {
+    IPAddress found;
+    const bool ok = WiFi.hostByName(host.c_str(), found) == 1;
+    g_lookupIp = ok ? (uint32_t)found : 0;
+    g_lookupGeneration = generation;
+    message = ok ? host + " is " + found.toString() : "Cannot resolve " + host;
+    return ok;
+  });
+}
+
+// Applies a finished lookup for the current target
+static void takeLookupResult() {
+  if (g_lookupGeneration != g_targetGeneration) return;
+  const uint32_t ip = g_lookupIp;
+  g_lookupGeneration = 0;
+  if (ip) {
+    useTarget(IPAddress(ip));
+  } else {
+    logWarn(String("⚠️ Syslog host not resolved: ") + g_syslogCfg.host);
+  }
+}
+
+static void configureShipper() {
+  shipper.configure(MDNS_HOSTNAME, g_syslogCfg.minLevel, g_syslogCfg.maxPerDatagram,
+                    g_syslogCfg.maxDatagramsPerSec);
+  g_resolved = false;
+  g_lastResolveMs = 0;
+  g_targetGeneration++;
+}
+
+void syslog_begin() {
+  syslog_settings_load(g_syslogCfg);
+  configureShipper();
+}
+
+void syslog_loop() {
+  if (!g_syslogCfg.enabled || g_syslogCfg.host.length() == 0) return;
+  if (WiFi.status() != WL_CONNECTED) return;  // records wait in the ring
+  if (!g_resolved) takeLookupResult();
+  if (!g_resolved) {
+    if (g_lastResolveMs != 0 && millis() - g_lastResolveMs < RESOLVE_RETRY_MS) return;
+    resolveTarget();
+    if (!g_resolved) return;
+  }
+  shipper.poll(millis());
+}
+
+void syslog_apply_settings(const SyslogSettings& s) {
+  if (!syslog_settings_save(s)) {
+    logError("❌ Failed to save syslog settings");
+    return;
+  }
+  g_syslogCfg = s;
+  configureShipper();
+}
+
+SyslogStats syslog_stats() {
+  return shipper.stats();
+}
+
+#endif
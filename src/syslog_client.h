@@ -0,0 +1,64 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "log_ring.h"
+
+// Ships log records to a syslog collector as RFC 5424 messages over UDP:
+//   <PRI>1 TIMESTAMP HOSTNAME ciws - - [meta sequenceId="SEQ"] BOM MSG
+// Several messages go into one datagram, separated by LF (RFC 6587
+// non-transparent framing), up to SYSLOG_DATAGRAM_MAX bytes. A token bucket
+// caps datagrams per second; when sending fails the datagram is dropped.
+// Records the ring evicts before they are shipped are counted as dropped;
+// the collector sees the gap in sequenceId. Shipping never waits.
+
+#define SYSLOG_DATAGRAM_MAX 1200  // stays below a 1500-byte MTU
+#define SYSLOG_FACILITY 16        // local0
+
+class SyslogTransport {
+public:
+  virtual ~SyslogTransport() {}
+  // Non-blocking; false when the datagram could not be queued
+  virtual bool send(const uint8_t* data, size_t len) = 0;
+};
+
+struct SyslogStats {
+  uint32_t datagrams;
+  uint32_t records;
+  uint32_t dropped;      // evicted before shipping or lost with a failed datagram
+  uint32_t sendErrors;
+};
+
+class SyslogShipper {
+public:
+  explicit SyslogShipper(SyslogTransport& transport) : transport(transport) {}
+
+  void configure(const char* hostname, uint8_t minLevel, uint8_t maxPerDatagram, uint16_t maxDatagramsPerSec);
+  // Sends at most one datagram; true when one went out
+  bool poll(uint32_t nowMs);
+  const SyslogStats& stats() const { return counters; }
+
+private:
+  SyslogTransport& transport;
+  LogCursor cursor;
+  char hostname[64] = "-";
+  uint8_t minLevel = 1;
+  uint8_t maxPerDatagram = 8;
+  uint16_t ratePerSec = 10;
+  uint32_t milliTokens = 0;   // token bucket, 1000 per datagram
+  uint32_t lastRefillMs = 0;
+  bool started = false;
+  char datagram[SYSLOG_DATAGRAM_MAX];
+  SyslogStats counters = {};
+};
+
+// One RFC 5424 message (without framing); returns its length
+size_t syslogFormat(const LogEntry& entry, const char* text, const char* hostname, char* out, size_t size);
+
+#if defined(ARDUINO_ARCH_ESP32)
+struct SyslogSettings;
+void syslog_begin();
+void syslog_loop();
+// Persist, then apply live
+void syslog_apply_settings(const SyslogSettings& s);
+SyslogStats syslog_stats();
+#endif
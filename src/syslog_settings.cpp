@@ -0,0 +1,37 @@
+#include "syslog_settings.h"
+#include <Preferences.h>
+
+static const char* NS = "syslog";
+
+bool syslog_settings_load(SyslogSettings& out) {
+  Preferences p;
+  p.begin(NS, /*readOnly*/ true);
+  const bool stored = p.isKey("host");
+  SyslogSettings defaults;
+  out.enabled = p.getBool("on", defaults.enabled);
+  out.host = p.getString("host", "");
+  uint32_t port = p.getUInt("port", defaults.port);
+  out.port = (port == 0 || port > 65535) ? defaults.port : (uint16_t)port;
+  uint8_t level = p.getUChar("level", defaults.minLevel);
+  out.minLevel = level <= 3 ? level : defaults.minLevel;
+  uint8_t batch = p.getUChar("batch", defaults.maxPerDatagram);
+  out.maxPerDatagram = (batch >= 1 && batch <= 32) ? batch : defaults.maxPerDatagram;
+  uint32_t rate = p.getUInt("rate", defaults.maxDatagramsPerSec);
+  out.maxDatagramsPerSec = (rate >= 1 && rate <= 100) ? (uint16_t)rate : defaults.maxDatagramsPerSec;
+  p.end();
+  return stored;
+}
+
+bool syslog_settings_save(const SyslogSettings& in) {
+  Preferences p;
+  if (!p.begin(NS, /*readOnly*/ false)) return false;
+  bool ok = true;
+  ok &= p.putBool("on", in.enabled) > 0;
+  ok &= p.putString("host", in.host) > 0 || in.host.length() == 0;
+  ok &= p.putUInt("port", (uint32_t)in.port) > 0;
+  ok &= p.putUChar("level", in.minLevel) > 0;
+  ok &= p.putUChar("batch", in.maxPerDatagram) > 0;
+  ok &= p.putUInt("rate", (uint32_t)in.maxDatagramsPerSec) > 0;
+  p.end();
+  return ok;
+}
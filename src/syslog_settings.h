@@ -0,0 +1,20 @@
+// syslog_settings.h
+#pragma once
+
+#include <Arduino.h>
+
+// Remote log shipping (syslog_client.h), configured next to MQTT
+struct SyslogSettings {
+  bool enabled = false;
+  String host;
+  uint16_t port = 514;
+  uint8_t minLevel = 1;            // LOG_LEVEL_INFO
+  uint8_t maxPerDatagram = 8;      // 1 = strictly one message per datagram (RFC 5426)
+  uint16_t maxDatagramsPerSec = 10;
+};
+
+// Load from Preferences; false (and defaults) when nothing stored yet
+bool syslog_settings_load(SyslogSettings& out);
+
+// Save to Preferences (persist across reboots)
+bool syslog_settings_save(const SyslogSettings& in);
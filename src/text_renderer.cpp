@@ -0,0 +1,108 @@
+#include "text_renderer.h"
+#include "config.h"
+#include "grid_layout.h"
+
+// Glyph ids: blank, '0'..'9', 'A'..'Z', '.', '-'
+static const uint8_t GLYPH_DIGIT = 1;
+static const uint8_t GLYPH_LETTER = GLYPH_DIGIT + 10;
+static const uint8_t GLYPH_DOT = GLYPH_LETTER + 26;
+static const uint8_t GLYPH_DASH = GLYPH_DOT + 1;
+static const uint8_t GLYPH_COUNT = GLYPH_DASH + 1;
+
+// LEDs of all glyphs back to back; glyph g uses [glyphStart[g], glyphStart[g + 1])
+static uint8_t glyphLeds[NUM_LEDS];
+static uint8_t glyphStart[GLYPH_COUNT + 1];
+static bool glyphsBuilt = false;
+static GridVariant glyphsVariant;
+
+static_assert(NUM_LEDS <= 256, "glyph tables store LED indices as uint8_t");
+
+static int16_t ledForLetter(char letter) {
+  for (int row = 0; row < GRID_HEIGHT; ++row) {
+    for (int col = 0; col < GRID_WIDTH; ++col) {
+      if (LETTER_GRID[row][col] != letter) continue;
+      const int16_t led = ACTIVE_CELL_LEDS[row * GRID_WIDTH + col];
+      if (led >= 0) return led;
+    }
+  }
+  return -1;
+}
+
+static void buildGlyphs() {
+  uint8_t used = 0;
+  auto add = [&](int led) {
+    if (led >= 0 && led < NUM_LEDS && used < NUM_LEDS) glyphLeds[used++] = (uint8_t)led;
+  };
+
+  for (uint8_t g = 0; g < GLYPH_COUNT; ++g) {
+    glyphStart[g] = used;
+    if (g > GLYPH_DIGIT && g < GLYPH_LETTER) {
+      // ACTIVE_HOUR_WORDS[n] is the word for hour n, twelve first
+      const WordPosition& w = ACTIVE_WORDS[ACTIVE_HOUR_WORDS[g - GLYPH_DIGIT]];
+      for (int i = 0; i < 20 && w.indices[i] != 0; ++i) add(w.indices[i]);
+    } else if (g == GLYPH_DIGIT) {
+      add(ledForLetter('O'));
+    } else if (g >= GLYPH_LETTER && g < GLYPH_DOT) {
+      add(ledForLetter('A' + (g - GLYPH_LETTER)));
+    } else if (g == GLYPH_DOT) {
+      for (size_t i = 0; i < EXTRA_MINUTE_LED_COUNT; ++i) add(EXTRA_MINUTE_LEDS[i]);
+    } else if (g == GLYPH_DASH && EXTRA_MINUTE_LED_COUNT >= 4) {
+      add(EXTRA_MINUTE_LEDS[1]);
+      add(EXTRA_MINUTE_LEDS[2]);
+    }
+  }
+  glyphStart[GLYPH_COUNT] = used;
+  glyphsBuilt = true;
+  glyphsVariant = getActiveGridVariant();
+}
+
+static void ensureGlyphs() {
+  if (!glyphsBuilt || glyphsVariant != getActiveGridVariant()) buildGlyphs();
+}
+
+static int glyphFor(char c) {
+  if (c >= '0' && c <= '9') return GLYPH_DIGIT + (c - '0');
+  if (c >= 'a' && c <= 'z') c = c - 'a' + 'A';
+  if (c >= 'A' && c <= 'Z') return GLYPH_LETTER + (c - 'A');
+  if (c == '.' || c == ':') return GLYPH_DOT;
+  if (c == '-') return GLYPH_DASH;
+  return -1;
+}
+
+uint8_t renderText(const char* text, TextFrames& out) {
+  ensureGlyphs();
+  out.count = 0;
+  int last = -1;
+  for (const char* p = text; p && *p && out.count < TEXT_MAX_FRAMES; ++p) {
+    const int g = glyphFor(*p);
+    if (g < 0 || glyphStart[g] == glyphStart[g + 1]) continue;
+    if (g == last) {
+      if (out.count + 1 >= TEXT_MAX_FRAMES) break;
+      out.glyphs[out.count] = TEXT_GLYPH_BLANK;
+      out.chars[out.count++] = ' ';
+    }
+    out.glyphs[out.count] = (uint8_t)g;
+    out.chars[out.count++] = *p;
+    last = g;
+  }
+  return out.count;
+}
+
+uint8_t renderNumber(long value, TextFrames& out) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%ld", value);
+  return renderText(buf, out);
+}
+
+uint8_t renderTime(int hour, int minute, TextFrames& out) {
+  char buf[8];
+  snprintf(buf, sizeof(buf), "%d.%02d", hour, minute);
+  return renderText(buf, out);
+}
+
+void textFrameLeds(const TextFrames& frames, uint8_t index, uint8_t* levels, uint8_t level) {
+  if (index >= frames.count) return;
+  ensureGlyphs();
+  const uint8_t g = frames.glyphs[index];
+  for (uint8_t i = glyphStart[g]; i < glyphStart[g + 1]; ++i) levels[glyphLeds[i]] = level;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Shows numbers and short strings on the word grid, one frame per character.
+// Digits 1-9 light the variant's hour words (EEN, TWEE... / ONE, TWO...),
+// letters and 0 light a single cell holding that letter in LETTER_GRID, and
+// '.', ':' and '-' use the minute LEDs. Glyph tables are built once per
+// active grid variant.
+constexpr uint8_t TEXT_MAX_FRAMES = 24;
+constexpr uint8_t TEXT_GLYPH_BLANK = 0;  // separates repeated characters ("11")
+
+struct TextFrames {
+  uint8_t count = 0;
+  uint8_t glyphs[TEXT_MAX_FRAMES];
+  char chars[TEXT_MAX_FRAMES];  // source character, ' ' for blanks
+};
+
+// Unsupported characters are skipped; returns the frame count
+uint8_t renderText(const char* text, TextFrames& out);
+uint8_t renderNumber(long value, TextFrames& out);
+// Time as H.MM with the minute LEDs as separator
+uint8_t renderTime(int hour, int minute, TextFrames& out);
+
+// Sets levels[led] = level for every LED of the frame
+void textFrameLeds(const TextFrames& frames, uint8_t index, uint8_t* levels, uint8_t level);
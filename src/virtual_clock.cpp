@@ -0,0 +1,99 @@
+#include "virtual_clock.h"
+#include <sys/time.h>
+
+static const time_t TIME_VALID_AFTER = 1451606400; // 2016-01-01, as getLocalTime()
+static const unsigned long EDGE_MARGIN_MS = 20;
+
+static ClockMode mode = ClockMode::REAL;
+static int64_t offsetMs = 0;
+static int64_t anchorRealMs = 0;     // ACCELERATED: real time at the anchor
+static int64_t anchorVirtualMs = 0;  // FROZEN/ACCELERATED: virtual time at the anchor
+static uint16_t factor = 1;
+
+static int64_t realNowMs() {
+  struct timeval tv;
+  if (gettimeofday(&tv, nullptr) != 0) return 0;
+  return (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+static int64_t virtualAt(int64_t realMs) {
+  switch (mode) {
+    case ClockMode::OFFSET: return realMs + offsetMs;
+    case ClockMode::FROZEN: return anchorVirtualMs;
+    case ClockMode::ACCELERATED: return anchorVirtualMs + (realMs - anchorRealMs) * factor;
+    case ClockMode::REAL:
+    default: return realMs;
+  }
+}
+
+ClockMode clockMode() {
+  return mode;
+}
+
+const char* clockModeName(ClockMode m) {
+  switch (m) {
+    case ClockMode::OFFSET: return "offset";
+    case ClockMode::FROZEN: return "frozen";
+    case ClockMode::ACCELERATED: return "accelerated";
+    case ClockMode::REAL:
+    default: return "real";
+  }
+}
+
+uint16_t clockFactor() {
+  return mode == ClockMode::ACCELERATED ? factor : 1;
+}
+
+int64_t clockNowMs() {
+  return virtualAt(realNowMs());
+}
+
+time_t clockNow() {
+  return (time_t)(clockNowMs() / 1000);
+}
+
+bool clockLocalTime(struct tm* info) {
+  if (!info || time(nullptr) < TIME_VALID_AFTER) return false;
+  const time_t now = clockNow();
+  return localtime_r(&now, info) != nullptr;
+}
+
+unsigned long clockMsUntilNextMinute() {
+  if (mode == ClockMode::FROZEN) return 60000UL;
+  const int64_t v = clockNowMs();
+  const unsigned long intoMinute = (unsigned long)(((v % 60000) + 60000) % 60000);
+  const uint16_t f = clockFactor();
+  const unsigned long margin = EDGE_MARGIN_MS / f > 0 ? EDGE_MARGIN_MS / f : 1;
+  return (60000UL - intoMinute + f - 1) / f + margin;
+}
+
+unsigned long clockRealMs(unsigned long virtualMs) {
+  const uint16_t f = clockFactor();
+  if (f <= 1) return virtualMs;
+  return virtualMs / f > 0 ? virtualMs / f : 1;
+}
+
+void clockSetReal() {
+  mode = ClockMode::REAL;
+  factor = 1;
+}
+
+void clockSetOffset(long seconds) {
+  offsetMs = (int64_t)seconds * 1000;
+  mode = ClockMode::OFFSET;
+  factor = 1;
+}
+
+void clockFreeze(time_t at) {
+  anchorVirtualMs = at ? (int64_t)at * 1000 : clockNowMs();
+  mode = ClockMode::FROZEN;
+  factor = 1;
+}
+
+void clockAccelerate(uint16_t newFactor, time_t from) {
+  const int64_t realMs = realNowMs();
+  anchorVirtualMs = from ? (int64_t)from * 1000 : virtualAt(realMs);
+  anchorRealMs = realMs;
+  factor = newFactor > 0 ? newFactor : 1;
+  mode = ClockMode::ACCELERATED;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+// Time as seen by the display, advisor, weather client and night dimming.
+// Normally the real (NTP) time; for demos and soak tests it can be shifted,
+// frozen or sped up (1440x plays 24 h in 60 s). Runtime only, not persisted.
+enum class ClockMode : uint8_t {
+  REAL = 0,
+  OFFSET,       // real time plus a fixed offset
+  FROZEN,       // stands still at one moment
+  ACCELERATED,  // runs `factor` times faster from an anchor
+};
+
+ClockMode clockMode();
+const char* clockModeName(ClockMode mode);
+uint16_t clockFactor();
+
+// Virtual epoch seconds / milliseconds
+time_t clockNow();
+int64_t clockNowMs();
+// Like getLocalTime() but for virtual time; never blocks, false before time sync
+bool clockLocalTime(struct tm* info);
+// Real milliseconds until the virtual minute changes, with a small margin so
+// a wake lands just after the boundary
+unsigned long clockMsUntilNextMinute();
+// Real milliseconds for a span of virtual milliseconds (timers like HET IS)
+unsigned long clockRealMs(unsigned long virtualMs);
+
+void clockSetReal();
+void clockSetOffset(long seconds);
+// at = 0 freezes / starts from the current virtual time
+void clockFreeze(time_t at);
+void clockAccelerate(uint16_t factor, time_t from);
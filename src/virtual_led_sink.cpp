@@ -0,0 +1,52 @@
+#include "virtual_led_sink.h"
+#include "grid_layout.h"
+
+void VirtualLedSink::show(const uint32_t* pixels, uint16_t count) {
+  Frame f;
+  f.atMs = clock ? clock() : 0;
+  f.pixels.assign(pixels, pixels + count);
+  total++;
+
+  if (file) {
+    fprintf(file, "@%lu\n%s\n", (unsigned long)f.atMs, renderAscii(f).c_str());
+    fflush(file);
+  }
+  if (maxFrames == 0) return;
+  if (recorded.size() >= maxFrames) {
+    recorded.erase(recorded.begin());
+  }
+  recorded.push_back(std::move(f));
+}
+
+bool VirtualLedSink::recordTo(const char* path) {
+  closeFile();
+  file = fopen(path, "w");
+  return file != nullptr;
+}
+
+void VirtualLedSink::closeFile() {
+  if (file) {
+    fclose(file);
+    file = nullptr;
+  }
+}
+
+std::string VirtualLedSink::renderAscii(const Frame& frame) {
+  std::string out;
+  out.reserve((GRID_WIDTH + 1) * GRID_HEIGHT);
+  for (int r = 0; r < GRID_HEIGHT; ++r) {
+    const char* row = LETTER_GRID[r];
+    for (int c = 0; c < GRID_WIDTH; ++c) {
+      int16_t led = ACTIVE_CELL_LEDS[r * GRID_WIDTH + c];
+      bool lit = led >= 0 && (size_t)led < frame.pixels.size() && frame.pixels[led] != 0;
+      char ch = row[c];
+      if (!lit) {
+        out += '.';
+      } else {
+        out += (ch >= 'A' && ch <= 'Z') ? ch : 'o';
+      }
+    }
+    out += '\n';
+  }
+  return out;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdio.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "led_sink.h"
+
+// Records frames instead of driving a strip, so the render path can run on a
+// host (golden-frame comparisons per grid variant and time, benchmarks) or be
+// inspected on the device. Install with setLedSink(&sink).
+class VirtualLedSink : public LedSink {
+public:
+  // Timestamp source for recorded frames in ms: millis() on the device, a
+  // fake clock in tests. Frames are stamped 0 without one.
+  typedef std::function<uint32_t()> Clock;
+
+  struct Frame {
+    uint32_t atMs;
+    std::vector<uint32_t> pixels;
+  };
+
+  // Keeps the newest maxFrames frames in memory (0 = keep none, file only)
+  explicit VirtualLedSink(size_t maxFrames = 32, Clock clock = nullptr)
+    : maxFrames(maxFrames), clock(clock) {}
+  ~VirtualLedSink() override { closeFile(); }
+
+  void begin() override {}
+  void show(const uint32_t* pixels, uint16_t count) override;
+  uint32_t minFrameUs() const override { return 1; }
+
+  const std::vector<Frame>& frames() const { return recorded; }
+  uint32_t frameCount() const { return total; }
+  void clear() { recorded.clear(); total = 0; }
+
+  // Also append every frame as ASCII art to a file; returns false if it cannot be opened
+  bool recordTo(const char* path);
+  void closeFile();
+
+  // Renders a frame over the active LETTER_GRID: lit cells show their letter
+  // ('o' for minute or blank cells), dark cells '.'. One line per grid row.
+  static std::string renderAscii(const Frame& frame);
+
+private:
+  size_t maxFrames;
+  Clock clock;
+  std::vector<Frame> recorded;
+  uint32_t total = 0;
+  FILE* file = nullptr;
+};
@@ -8,16 +8,86 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "background_jobs.h"
 #include "config.h"
 #include "log.h"
 #include "secrets.h"
 #include "weather_settings.h"
+#include "virtual_clock.h"
 
 namespace {
 constexpr unsigned long kCacheDurationMs = 10UL * 60UL * 1000UL;  // 10 minutes
 WeatherData g_cache;
 unsigned long g_lastFetchMs = 0;
 String g_lastMessage;
+String g_cacheDate;  // virtual date the cache was fetched for, empty for real time
+// Guards the cache: weatherRefreshAsync() fills it on the jobs task. Created
+// on the loop task before the first job can use it.
+SemaphoreHandle_t g_cacheLock = nullptr;
+
+void lockCache() {
+  if (!g_cacheLock) g_cacheLock = xSemaphoreCreateMutex();
+  xSemaphoreTake(g_cacheLock, portMAX_DELAY);
+}
+
+void unlockCache() {
+  xSemaphoreGive(g_cacheLock);
+}
+
+// Days around today (real time) that the forecast API serves
+constexpr int kPastDays = 92;
+constexpr int kForecastDays = 16;
+
+String localDate(time_t t) {
+  struct tm lt;
+  char buf[12];
+  if (!localtime_r(&t, &lt) || !strftime(buf, sizeof(buf), "%Y-%m-%d", &lt)) return String();
+  return String(buf);
+}
+
+// Local date of the virtual clock when it is not running in real time
+String virtualForecastDate(int addDays = 0) {
+  if (clockMode() == ClockMode::REAL) return String();
+  return localDate(clockNow() + (time_t)addDays * 86400);
+}
+
+// False (with a message) when the virtual day and the next fall outside the
+// API's window, which it would answer with an error status
+bool virtualDateServed(const String& startDate, String& message) {
+  const time_t real = time(nullptr);
+  if (real < 1577836800) return true;  // before NTP sync (2020): let the API decide
+  const String first = localDate(real - (time_t)kPastDays * 86400);
+  const String last = localDate(real + (time_t)(kForecastDays - 2) * 86400);  // end_date is the day after
+  if (startDate >= first && startDate <= last) return true;
+  message = String("Virtuele datum ") + startDate + " valt buiten het bereik van Open-Meteo (" + first + " t/m " + last + ").";
+  return false;
+}
+
+// Current values for the virtual clock from the hourly entry it falls in
+void applyVirtualNow(WeatherData& data) {
+  const time_t now = clockNow();
+  size_t idx = 0;
+  bool found = false;
+  for (size_t i = 0; i < data.hourlyCount; ++i) {
+    if (data.hourlyTimestamps[i] == 0 || data.hourlyTimestamps[i] > now) continue;
+    if (!found || data.hourlyTimestamps[i] > data.hourlyTimestamps[idx]) idx = i;
+    found = true;
+  }
+  data.windspeed = NAN;
+  data.winddirection = NAN;
+  data.weathercode = -1;
+  if (!found) {
+    data.temperatureC = NAN;
+    data.timeIso = "";
+    return;
+  }
+  data.temperatureC = data.hourlyTemperature[idx];
+  struct tm lt;
+  char buf[20];
+  if (localtime_r(&data.hourlyTimestamps[idx], &lt) && strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M", &lt)) {
+    data.timeIso = buf;
+  }
+}
 
 String buildRequestUrl(const String& lat, const String& lon) {
   String url = WEATHER_API_ENDPOINT;
@@ -31,10 +101,18 @@ String buildRequestUrl(const String& lat, const String& lon) {
   }
   url += "latitude=" + lat;
   url += "&longitude=" + lon;
-  url += "&current_weather=true";
   url += "&timezone=Europe%2FAmsterdam";
-  url += "&hourly=apparent_temperature,precipitation_probability";
-  url += "&forecast_days=2";
+  url += "&hourly=temperature_2m,apparent_temperature,precipitation_probability";
+  const String startDate = virtualForecastDate();
+  if (startDate.length()) {
+    // Forecast window follows the virtual clock (demo/soak playback); the
+    // current reading would be real time, so it is not requested
+    url += "&start_date=" + startDate;
+    url += "&end_date=" + virtualForecastDate(1);
+  } else {
+    url += "&current_weather=true";
+    url += "&forecast_days=2";
+  }
   return url;
 }
 
@@ -57,17 +135,27 @@ time_t parseLocalIso(const char* iso) {
 }
 
 void assignCache(const WeatherData& data, const String& message) {
+  const String date = virtualForecastDate();
+  lockCache();
   g_cache = data;
   g_lastFetchMs = millis();
   g_lastMessage = message;
+  g_cacheDate = date;
+  unlockCache();
 }
 }  // namespace
 
 bool weatherGetData(WeatherData& data, String& message) {
-  const unsigned long now = millis();
-  if (g_cache.valid && (now - g_lastFetchMs) < kCacheDurationMs) {
+  const String date = virtualForecastDate();
+  lockCache();
+  const bool hit = g_cache.valid && (millis() - g_lastFetchMs) < kCacheDurationMs && g_cacheDate == date;
+  if (hit) {
     data = g_cache;
     message = g_lastMessage;
+  }
+  unlockCache();
+  if (hit) {
+    if (date.length()) applyVirtualNow(data);
     return true;
   }
 
@@ -84,6 +172,14 @@ bool weatherGetData(WeatherData& data, String& message) {
     return false;
   }
 
+  if (date.length() && !virtualDateServed(date, message)) {
+    WeatherData empty;
+    empty.valid = false;
+    assignCache(empty, message);
+    data = empty;
+    return false;
+  }
+
   if (WiFi.status() != WL_CONNECTED) {
     message = "Geen WiFi-verbinding.";
     WeatherData empty;
@@ -144,7 +240,7 @@ bool weatherGetData(WeatherData& data, String& message) {
   }
 
   JsonObject current = doc["current_weather"];
-  if (current.isNull()) {
+  if (current.isNull() && !date.length()) {
     message = "Geen 'current_weather' veld in antwoord.";
     WeatherData empty;
     empty.valid = false;
@@ -155,17 +251,20 @@ bool weatherGetData(WeatherData& data, String& message) {
 
   WeatherData fresh;
   fresh.valid = true;
-  fresh.temperatureC = current["temperature"] | NAN;
-  fresh.windspeed = current["windspeed"] | NAN;
-  fresh.winddirection = current["winddirection"] | NAN;
-  fresh.weathercode = current["weathercode"] | -1;
-  fresh.timeIso = current["time"].as<String>();
+  if (!date.length()) {
+    fresh.temperatureC = current["temperature"] | NAN;
+    fresh.windspeed = current["windspeed"] | NAN;
+    fresh.winddirection = current["winddirection"] | NAN;
+    fresh.weathercode = current["weathercode"] | -1;
+    fresh.timeIso = current["time"].as<String>();
+  }
   fresh.fetchedAtMs = millis();
   fresh.hourlyCount = 0;
 
   JsonObject hourly = doc["hourly"];
   if (!hourly.isNull()) {
     JsonArray times = hourly["time"].as<JsonArray>();
+    JsonArray air = hourly["temperature_2m"].as<JsonArray>();
     JsonArray temps = hourly["apparent_temperature"].as<JsonArray>();
     JsonArray probs = hourly["precipitation_probability"].as<JsonArray>();
     if (!times.isNull() && !temps.isNull() && !probs.isNull()) {
@@ -176,6 +275,7 @@ bool weatherGetData(WeatherData& data, String& message) {
       for (size_t i = 0; i < count; ++i) {
         const char* timeStr = times[i];
         fresh.hourlyTimestamps[i] = parseLocalIso(timeStr);
+        fresh.hourlyTemperature[i] = (air.isNull() || i >= air.size() || air[i].isNull()) ? NAN : air[i].as<float>();
         fresh.hourlyApparent[i] = temps[i].isNull() ? NAN : temps[i].as<float>();
         fresh.hourlyPrecipProb[i] = probs[i].isNull() ? NAN : probs[i].as<float>();
       }
@@ -186,12 +286,38 @@ bool weatherGetData(WeatherData& data, String& message) {
   message = "OK";
   assignCache(fresh, message);
   data = fresh;
+  if (date.length()) applyVirtualNow(data);
   return true;
 }
 
+bool weatherCachedData(WeatherData& data, bool& stale) {
+  const String date = virtualForecastDate();
+  lockCache();
+  const bool ok = g_cache.valid && g_cacheDate == date;
+  if (ok) {
+    data = g_cache;
+    stale = (millis() - g_lastFetchMs) >= kCacheDurationMs;
+  }
+  unlockCache();
+  if (ok && date.length()) applyVirtualNow(data);
+  return ok;
+}
+
+void weatherRefreshAsync() {
+  if (jobActive("weather")) return;
+  lockCache();  // creates the lock here, on the loop task
+  unlockCache();
+  jobStart("weather", [](String& message) {
+    WeatherData data;
+    return weatherGetData(data, message);
+  });
+}
+
 void weatherInvalidateCache() {
+  lockCache();
   g_cache.valid = false;
   g_lastFetchMs = 0;
   g_lastMessage = "";
   g_cache.hourlyCount = 0;
+  unlockCache();
 }
@@ -15,6 +15,7 @@ struct WeatherData {
   unsigned long fetchedAtMs = 0;
 
   size_t hourlyCount = 0;
+  float hourlyTemperature[kMaxHourlyEntries];
   float hourlyApparent[kMaxHourlyEntries];
   float hourlyPrecipProb[kMaxHourlyEntries];
   time_t hourlyTimestamps[kMaxHourlyEntries];
@@ -22,8 +23,20 @@ struct WeatherData {
 
 // Fetches weather data for the current coordinates stored in WeatherSettings.
 // Returns true when fresh (or cached) data is available; false on error and
-// writes a human-readable message to 'message'.
+// writes a human-readable message to 'message'. While the virtual clock is
+// not real time, the forecast covers the virtual day and the current
+// values come from its hourly entry at clockNow() (wind and weather code
+// are left unset); days Open-Meteo cannot serve are rejected.
 bool weatherGetData(WeatherData& data, String& message);
 
+// Copies the cached data for the current (virtual) day without fetching;
+// false when there is none. `stale` is set once it is older than the cache
+// lifetime. Safe to call while a refresh job runs.
+bool weatherCachedData(WeatherData& data, bool& stale);
+
+// Fetches on the jobs task (background_jobs.h) instead of the caller's;
+// does nothing while such a refresh is queued or running.
+void weatherRefreshAsync();
+
 // Clears any cached weather data (e.g. after coordinates change).
 void weatherInvalidateCache();
@@ -1,6 +1,7 @@
 #include "weather_settings.h"
 #include "secrets.h"
 #include "weather_client.h"
+#include "night_dimming.h"
 
 WeatherSettings weatherSettings;
 
@@ -28,4 +29,5 @@ void WeatherSettings::persist() {
   prefs.putString("lon", longitude);
   prefs.end();
   weatherInvalidateCache();
+  nightDimInvalidateCache();
 }
@@ -0,0 +1,115 @@
+#include "web_assets.h"
+#include <stdlib.h>
+#include <string.h>
+#include <esp32/rom/miniz.h>
+#include "fs_compat.h"
+
+struct EtagSlot {
+  String path;
+  String etag;
+};
+
+static EtagSlot slots[WEB_ASSET_CACHE_SLOTS];
+static size_t nextSlot = 0;
+// Bumped by webAssetsInvalidate(), which may run on another task; the slots
+// themselves are only touched from the web server
+static volatile uint32_t generation = 0;
+static uint32_t slotsGeneration = 0;
+// Per built-in page: 0 = not checked, 1 = no override, 2 = override on flash
+static uint8_t overrides[WEB_ASSET_CACHE_SLOTS];
+
+static void dropStaleEntries() {
+  if (slotsGeneration == generation) return;
+  slotsGeneration = generation;
+  for (auto& s : slots) {
+    s.path = String();
+    s.etag = String();
+  }
+  memset(overrides, 0, sizeof(overrides));
+}
+
+const WebAsset* webAssetFind(const char* path) {
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    if (strcmp(WEB_ASSETS[i].path, path) == 0) return &WEB_ASSETS[i];
+  }
+  return nullptr;
+}
+
+bool webAssetOverridden(const char* path) {
+  const WebAsset* asset = webAssetFind(path);
+  const size_t index = asset ? (size_t)(asset - WEB_ASSETS) : WEB_ASSET_CACHE_SLOTS;
+  if (index < WEB_ASSET_CACHE_SLOTS) {
+    dropStaleEntries();
+    if (overrides[index]) return overrides[index] == 2;
+  }
+  const bool found = FS_IMPL.exists(String(WEB_ASSET_OVERRIDE_DIR) + path);
+  if (index < WEB_ASSET_CACHE_SLOTS) overrides[index] = found ? 2 : 1;
+  return found;
+}
+
+String webAssetCachedEtag(const String& path) {
+  dropStaleEntries();
+  for (const auto& s : slots) {
+    if (s.path == path) return s.etag;
+  }
+  return String();
+}
+
+String webAssetEtag(const String& path, File& file) {
+  String etag = webAssetCachedEtag(path);
+  if (etag.length()) return etag;
+
+  uint32_t hash = 2166136261u;  // FNV-1a
+  uint8_t buf[512];
+  size_t n;
+  while ((n = file.read(buf, sizeof(buf))) > 0) {
+    for (size_t i = 0; i < n; i++) {
+      hash = (hash ^ buf[i]) * 16777619u;
+    }
+  }
+  file.seek(0);
+
+  char tag[24];
+  snprintf(tag, sizeof(tag), "\"%08lx-%lx\"", (unsigned long)hash, (unsigned long)file.size());
+  EtagSlot& slot = slots[nextSlot];
+  nextSlot = (nextSlot + 1) % WEB_ASSET_CACHE_SLOTS;
+  slot.path = path;
+  slot.etag = tag;
+  return slot.etag;
+}
+
+void webAssetsInvalidate() {
+  generation = generation + 1;
+}
+
+uint8_t* webAssetInflate(const WebAsset& asset, size_t& size) {
+  size = 0;
+  // tools/web_embed.py writes a bare 10-byte gzip header (no name or extra
+  // fields), the deflate stream, then CRC32 and the inflated size
+  if (asset.size < 18 || asset.data[3] != 0) return nullptr;
+  const uint8_t* trailer = asset.data + asset.size - 4;
+  const size_t plainSize = (size_t)trailer[0] | ((size_t)trailer[1] << 8) | ((size_t)trailer[2] << 16) |
+                           ((size_t)trailer[3] << 24);
+  if (plainSize == 0) return nullptr;
+
+  // The ROM inflater; its state is ~11 KB, too much for the loop() stack
+  uint8_t* out = (uint8_t*)malloc(plainSize);
+  tinfl_decompressor* inflater = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+  if (!out || !inflater) {
+    free(out);
+    free(inflater);
+    return nullptr;
+  }
+  tinfl_init(inflater);
+  size_t inLen = asset.size - 18;
+  size_t outLen = plainSize;
+  const tinfl_status status = tinfl_decompress(inflater, asset.data + 10, &inLen, out, out, &outLen,
+                                               TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+  free(inflater);
+  if (status != TINFL_STATUS_DONE || outLen != plainSize) {
+    free(out);
+    return nullptr;
+  }
+  size = outLen;
+  return out;
+}
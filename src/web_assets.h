@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+// UI pages are built into the firmware (gzipped, with a precomputed ETag)
+// by tools/web_embed.py, so they always match the firmware version and are
+// sent straight from flash. A file under WEB_ASSET_OVERRIDE_DIR on the
+// filesystem replaces the built-in page of the same name.
+//
+// Files served from the filesystem get a strong ETag too: the FNV-1a hash
+// and size of the exact bytes served, so a .gz variant and its plain file
+// get different tags. A file is hashed the first time it is served; the tag
+// is kept until webAssetsInvalidate().
+
+#define WEB_ASSET_CACHE_SLOTS 12
+#define WEB_ASSET_OVERRIDE_DIR "/www"
+
+struct WebAsset {
+  const char* path;
+  const char* mime;
+  const uint8_t* data;  // gzip
+  uint32_t size;
+  const char* etag;
+};
+
+// Generated in web_assets_embedded.cpp
+extern const WebAsset WEB_ASSETS[];
+extern const size_t WEB_ASSET_COUNT;
+
+// Built-in page for `path`, or nullptr
+const WebAsset* webAssetFind(const char* path);
+// Built-in page inflated into a malloc()ed buffer (caller frees) for
+// clients that do not accept gzip; nullptr when there is no room
+uint8_t* webAssetInflate(const WebAsset& asset, size_t& size);
+// True when the filesystem holds an override for the built-in `path`
+// (checked once per path until webAssetsInvalidate())
+bool webAssetOverridden(const char* path);
+
+// Cached ETag for `path`; empty when it has not been hashed yet
+String webAssetCachedEtag(const String& path);
+// ETag for the open file at `path`: hashes it when not cached and rewinds it
+String webAssetEtag(const String& path, File& file);
+// Call after UI files on flash were replaced
+void webAssetsInvalidate();
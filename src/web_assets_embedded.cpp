@@ -0,0 +1,1097 @@
+// Generated by tools/web_embed.py from data/*.html. Do not edit by hand.
+// Source hash: 06a1697fb13f29cf96751a6c414104dbf92428cda210a6969c3281a88d1f3521
+#include "web_assets.h"
+
+// /admin.html: 8064 bytes, 2579 gzipped
+static const uint8_t ASSET_0[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x59, 0xdb, 0x6e, 0x1b, 0xc7,
+  0x19, 0xbe, 0xd7, 0x53, 0x4c, 0x18, 0x23, 0x4b, 0xa2, 0xe2, 0x52, 0x92, 0x13, 0x27, 0x95, 0x44,
+  0x29, 0xb6, 0x2c, 0x25, 0x6e, 0x7d, 0x82, 0x25, 0x39, 0x28, 0x8c, 0x00, 0x1e, 0xee, 0x0e, 0xb9,
+  0x23, 0xed, 0xce, 0x6c, 0x66, 0x66, 0x49, 0xb1, 0x8a, 0x80, 0xf6, 0xa6, 0xb7, 0x2d, 0xd0, 0x5e,
+  0x16, 0xc8, 0x5d, 0x9b, 0x8b, 0x5e, 0x17, 0x7d, 0x9e, 0xbc, 0x40, 0xf3, 0x08, 0xfd, 0xe6, 0xb0,
+  0xe4, 0x92, 0xa2, 0x0e, 0x4e, 0x7d, 0x61, 0xee, 0xce, 0xcc, 0x7f, 0x9c, 0xef, 0x3f, 0xad, 0x76,
+  0x3f, 0x7a, 0xfa, 0xea, 0xe0, 0xe4, 0x77, 0xaf, 0x0f, 0x49, 0x66, 0x8a, 0x7c, 0x6f, 0x6d, 0xd7,
+  0xfe, 0x90, 0x9c, 0x8a, 0x51, 0xbf, 0xc5, 0x44, 0xcb, 0x2e, 0x30, 0x9a, 0xe2, 0xa7, 0x60, 0x86,
+  0x92, 0x24, 0xa3, 0x4a, 0x33, 0xd3, 0x6f, 0x9d, 0x9e, 0x1c, 0x75, 0xbf, 0x68, 0x91, 0x5e, 0xbd,
+  0x21, 0x68, 0xc1, 0xfa, 0xad, 0x31, 0x67, 0x93, 0x52, 0x2a, 0xd3, 0x22, 0x89, 0x14, 0x86, 0x09,
+  0x1c, 0x9c, 0xf0, 0xd4, 0x64, 0xfd, 0x94, 0x8d, 0x79, 0xc2, 0xba, 0xee, 0x65, 0x9d, 0x70, 0xc1,
+  0x0d, 0xa7, 0x79, 0x57, 0x27, 0x34, 0x67, 0xfd, 0xcd, 0x78, 0xc3, 0x33, 0x32, 0xdc, 0xe4, 0x6c,
+  0xef, 0x80, 0x0a, 0xf2, 0x8c, 0x7c, 0xc3, 0xa8, 0x22, 0xc7, 0x19, 0x78, 0x69, 0xf2, 0x38, 0x2d,
+  0xb8, 0xd8, 0xed, 0xf9, 0xed, 0xb5, 0xdd, 0x9c, 0x8b, 0x73, 0x92, 0x29, 0x36, 0xec, 0xb7, 0x32,
+  0x63, 0x4a, 0xbd, 0xdd, 0xeb, 0x25, 0xa9, 0x88, 0xcf, 0x74, 0xca, 0x72, 0x3e, 0x56, 0xb1, 0x60,
+  0xa6, 0x27, 0xca, 0xa2, 0x67, 0x28, 0xcf, 0x27, 0x5c, 0xa4, 0x89, 0xd6, 0x5f, 0x6e, 0xc5, 0x5b,
+  0xf1, 0xe6, 0xaf, 0x7b, 0x29, 0xd7, 0x66, 0xb6, 0x1e, 0x83, 0x6b, 0x8c, 0xcd, 0x16, 0x51, 0x2c,
+  0xef, 0xb7, 0xb4, 0x99, 0xe6, 0x4c, 0x67, 0x8c, 0x19, 0x6b, 0x74, 0x2f, 0x58, 0x3d, 0x90, 0xe9,
+  0x94, 0x24, 0x39, 0xd5, 0xba, 0xdf, 0x1a, 0x8c, 0xba, 0x23, 0x45, 0xa7, 0xdd, 0xcd, 0x8d, 0x0d,
+  0x62, 0xd8, 0x85, 0xf1, 0x6f, 0x5f, 0xe0, 0x6d, 0x08, 0x6b, 0xbb, 0x9a, 0x0a, 0x6d, 0x49, 0x53,
+  0x3e, 0xae, 0x29, 0x0a, 0x7a, 0xd1, 0x9d, 0x74, 0x2f, 0x72, 0x52, 0x5c, 0x74, 0x69, 0x65, 0x24,
+  0x29, 0xbb, 0x9f, 0xd6, 0x2e, 0x65, 0xaa, 0x3e, 0x35, 0xcc, 0xd9, 0x05, 0xe1, 0x86, 0x15, 0xba,
+  0x9b, 0xc0, 0x67, 0xd8, 0x38, 0xab, 0xb4, 0xe1, 0xc3, 0x69, 0x77, 0xc0, 0xcc, 0x84, 0x31, 0x41,
+  0x8a, 0x41, 0xf7, 0x91, 0xa3, 0xdb, 0xac, 0x69, 0x9c, 0xfc, 0x87, 0xe0, 0xec, 0x44, 0x0f, 0x64,
+  0x9e, 0xb6, 0xf6, 0x7e, 0xfe, 0xe1, 0x6f, 0x7f, 0xa9, 0x9d, 0x95, 0x6d, 0x2e, 0x6a, 0x72, 0x5d,
+  0xc6, 0x88, 0x06, 0x65, 0x68, 0x70, 0x66, 0x2f, 0xa5, 0x3a, 0x1b, 0x48, 0xaa, 0xd2, 0xd8, 0x62,
+  0xa0, 0xb5, 0x20, 0x4a, 0x17, 0xde, 0xe4, 0x41, 0x5e, 0xb1, 0xee, 0x23, 0x98, 0x9c, 0xc9, 0x31,
+  0x53, 0xdb, 0x95, 0x80, 0x1d, 0xb8, 0x10, 0xd6, 0xda, 0x7b, 0x42, 0x93, 0x73, 0x02, 0x13, 0x67,
+  0x5c, 0x76, 0x7b, 0xb4, 0xc9, 0x9d, 0x5a, 0xc5, 0x72, 0x39, 0x92, 0x95, 0x59, 0xcd, 0xda, 0x79,
+  0x73, 0x25, 0xeb, 0xe7, 0x8e, 0xca, 0xf3, 0xc3, 0x1d, 0x8e, 0xeb, 0xfb, 0x61, 0x0a, 0x4f, 0x9a,
+  0x25, 0x86, 0x4b, 0xd1, 0xb8, 0xa4, 0x49, 0x06, 0x43, 0xad, 0xab, 0x89, 0x92, 0x96, 0x4b, 0xda,
+  0xdd, 0x82, 0xa3, 0x74, 0x46, 0x53, 0x39, 0xb1, 0x06, 0x97, 0x37, 0x8b, 0xff, 0x7c, 0x63, 0xa3,
+  0xb5, 0x77, 0x92, 0x71, 0x4d, 0x4a, 0x3a, 0x62, 0xc4, 0xfe, 0x2a, 0x69, 0x20, 0x81, 0xa5, 0x64,
+  0xc2, 0x4d, 0x46, 0x28, 0x29, 0xa8, 0xa8, 0x86, 0x34, 0x31, 0x95, 0x82, 0x13, 0x4b, 0xf0, 0x99,
+  0x48, 0x78, 0x6c, 0xb7, 0x57, 0x82, 0x73, 0x95, 0xd7, 0xac, 0x73, 0x20, 0xad, 0x0b, 0xb8, 0x25,
+  0xa4, 0xcc, 0xbb, 0x8f, 0x48, 0x81, 0xcb, 0x22, 0x37, 0x88, 0xb3, 0x88, 0xde, 0x3b, 0xd5, 0x8c,
+  0x98, 0x99, 0xdc, 0xa1, 0x54, 0x56, 0x70, 0x5a, 0x39, 0xd3, 0x7a, 0x9a, 0x29, 0x1b, 0x3e, 0x84,
+  0xba, 0x57, 0x0d, 0x61, 0xa0, 0x70, 0x64, 0x07, 0x0a, 0x91, 0x84, 0x28, 0x22, 0x4c, 0xa4, 0xa5,
+  0xe4, 0x02, 0xd1, 0xa2, 0x58, 0x41, 0xb9, 0xc0, 0xd9, 0x84, 0x69, 0xcd, 0x07, 0x39, 0x23, 0x52,
+  0xe4, 0x53, 0xaf, 0x7d, 0x90, 0x30, 0xd3, 0xd9, 0xb1, 0xe9, 0x55, 0xf9, 0x12, 0x6a, 0x0d, 0x5c,
+  0x37, 0x52, 0x3c, 0x75, 0xff, 0x75, 0x13, 0x99, 0xeb, 0xee, 0x96, 0xc3, 0xcb, 0x96, 0xc7, 0x4b,
+  0x38, 0x57, 0x4e, 0xb1, 0x1c, 0x5c, 0x4c, 0xe0, 0xf7, 0x29, 0xcb, 0x73, 0x39, 0xe9, 0x7e, 0x56,
+  0x87, 0x87, 0xbf, 0x07, 0xf7, 0x18, 0x30, 0xe7, 0x6f, 0x76, 0x7e, 0x14, 0xb7, 0xdd, 0xaa, 0xf1,
+  0xa1, 0x98, 0x36, 0x14, 0xa9, 0xc3, 0xc2, 0xf8, 0x8f, 0xe4, 0x8d, 0x7f, 0xab, 0x31, 0x74, 0x83,
+  0x44, 0x87, 0xc6, 0xfb, 0xc8, 0xab, 0x61, 0xdb, 0x94, 0x86, 0xd8, 0xe2, 0x43, 0x6e, 0xe5, 0xfd,
+  0xf5, 0xdf, 0x56, 0x1e, 0x33, 0xe4, 0x1b, 0x7e, 0xc4, 0xef, 0x10, 0x59, 0x56, 0xaa, 0xcc, 0xef,
+  0x27, 0x34, 0x1c, 0x6d, 0x8a, 0x75, 0x46, 0x1d, 0xb3, 0xef, 0x2a, 0x26, 0x12, 0x00, 0xfb, 0xa7,
+  0xbf, 0xff, 0x48, 0x8e, 0xed, 0x12, 0xa9, 0xd7, 0xee, 0x90, 0x5e, 0xa3, 0xe6, 0x4e, 0xd9, 0x75,
+  0x6a, 0xaa, 0x25, 0x7f, 0xdc, 0x22, 0x3c, 0xed, 0xb7, 0xaa, 0x32, 0xa5, 0x86, 0x3d, 0x31, 0x02,
+  0x69, 0x02, 0xe2, 0xff, 0xf5, 0xa7, 0xff, 0xfe, 0xe7, 0xcf, 0xe4, 0xd4, 0x2d, 0x2e, 0x84, 0xd7,
+  0x12, 0x1a, 0xec, 0xb5, 0x0f, 0x2a, 0x63, 0x10, 0x66, 0x96, 0x8b, 0x85, 0xbf, 0x54, 0x53, 0xb0,
+  0x69, 0x2d, 0x28, 0x5a, 0x5e, 0x00, 0xe5, 0x0d, 0x6d, 0x15, 0x42, 0xef, 0xd1, 0xa2, 0xb2, 0x33,
+  0x05, 0xed, 0x9e, 0x83, 0xff, 0xcf, 0x3f, 0xfc, 0xf3, 0x47, 0x72, 0xe4, 0x39, 0x12, 0x77, 0x2d,
+  0xbb, 0x3d, 0x2f, 0xcb, 0x85, 0x6a, 0x43, 0xde, 0x0b, 0x3d, 0x5a, 0xcc, 0x1c, 0x17, 0x7a, 0x29,
+  0x73, 0x40, 0x57, 0x40, 0xd4, 0xc7, 0xe2, 0x4a, 0x4b, 0x1e, 0x91, 0xd5, 0x89, 0xf0, 0xa1, 0x0b,
+  0x43, 0x3a, 0x60, 0x36, 0xa1, 0x2a, 0x14, 0x03, 0xe0, 0xf3, 0x85, 0x4c, 0xd9, 0x72, 0xa6, 0x6a,
+  0xed, 0x1d, 0x63, 0x87, 0x14, 0xd8, 0x22, 0x6d, 0x9d, 0xc9, 0x09, 0xd9, 0xdc, 0xd8, 0xfe, 0xf4,
+  0xf3, 0x0e, 0x42, 0xc9, 0x12, 0x83, 0x09, 0x17, 0x65, 0x65, 0x88, 0x99, 0x96, 0x28, 0x87, 0x49,
+  0xc6, 0x92, 0xf3, 0x81, 0xbc, 0xf0, 0xbe, 0xbf, 0xc6, 0x33, 0x43, 0x98, 0x4d, 0xbc, 0x73, 0x57,
+  0x2b, 0xbb, 0xa4, 0x94, 0x8d, 0xc6, 0xb7, 0x54, 0x71, 0x2a, 0xe6, 0x19, 0x74, 0x90, 0x4b, 0x9b,
+  0x76, 0x43, 0x66, 0xf1, 0x75, 0x88, 0x15, 0xdc, 0x16, 0x04, 0x5b, 0x35, 0x36, 0x5b, 0x7b, 0x5f,
+  0xd9, 0x40, 0xce, 0xe9, 0xd4, 0x65, 0xd0, 0x5a, 0x4b, 0xe8, 0x82, 0xa4, 0xe6, 0xd4, 0x5a, 0xc5,
+  0x75, 0xd2, 0x1d, 0x56, 0x30, 0x73, 0x80, 0x2c, 0x01, 0x07, 0xd5, 0x37, 0x8a, 0xf8, 0x27, 0x33,
+  0x3f, 0xec, 0xf6, 0x3c, 0x8f, 0x6b, 0xf9, 0x74, 0xe1, 0x52, 0x3e, 0xf3, 0x97, 0x02, 0x35, 0x5e,
+  0x4a, 0x43, 0x0d, 0x67, 0xdb, 0x64, 0x97, 0x15, 0x7b, 0x2f, 0x29, 0x2d, 0xc8, 0xbb, 0x93, 0xc7,
+  0x8f, 0x9f, 0x93, 0xb7, 0x87, 0x6f, 0x8e, 0x9f, 0x1d, 0x7e, 0xbb, 0xdb, 0xc3, 0xf2, 0x3a, 0x19,
+  0xf0, 0xb3, 0xb1, 0x94, 0x6a, 0xc0, 0x18, 0xf4, 0x77, 0x27, 0x99, 0xad, 0x02, 0x54, 0xa4, 0x9a,
+  0xbc, 0xdd, 0x22, 0xef, 0x5e, 0x82, 0x60, 0xcb, 0x1f, 0x0e, 0x29, 0xb7, 0x5c, 0x36, 0x02, 0xf1,
+  0x64, 0x2a, 0xfd, 0xe1, 0x40, 0xc9, 0xb6, 0x16, 0x49, 0xf2, 0x65, 0x6f, 0x5a, 0xf4, 0xc0, 0xa5,
+  0xa0, 0x3b, 0x90, 0xb9, 0x54, 0x28, 0x41, 0x5b, 0xcb, 0xf7, 0x6d, 0xd7, 0xfd, 0x65, 0xbb, 0x6a,
+  0xe7, 0xce, 0xbd, 0xe6, 0xc9, 0x39, 0x53, 0xcb, 0xae, 0xcd, 0xba, 0x9b, 0x5b, 0x0d, 0xc7, 0x6e,
+  0x04, 0x5f, 0x83, 0xbb, 0x6b, 0x85, 0x3e, 0x40, 0x99, 0xd3, 0x32, 0x97, 0x34, 0x25, 0x43, 0xae,
+  0x8a, 0x09, 0x55, 0x2c, 0xa8, 0x05, 0xc0, 0x14, 0xa1, 0x5e, 0x20, 0xed, 0x54, 0xee, 0xcc, 0x51,
+  0x38, 0xd2, 0x22, 0x68, 0xd9, 0x32, 0x09, 0x2d, 0x5f, 0xbf, 0x3a, 0x3e, 0x69, 0xa1, 0x76, 0x24,
+  0x5e, 0xff, 0xa2, 0xca, 0x0d, 0x2f, 0x91, 0x8e, 0x7a, 0x96, 0xbc, 0x8b, 0xac, 0x40, 0x67, 0x7a,
+  0xeb, 0x92, 0xa2, 0x81, 0x9b, 0xfa, 0x12, 0xd0, 0x34, 0x7a, 0xc8, 0x73, 0x70, 0xf4, 0xfd, 0x5f,
+  0xad, 0xc4, 0x91, 0x5b, 0xb3, 0x25, 0xa8, 0x44, 0x0b, 0x18, 0x0f, 0xb8, 0xb0, 0x4d, 0xd6, 0x77,
+  0x15, 0x47, 0xd4, 0x2f, 0x22, 0x37, 0xb8, 0x63, 0x75, 0x69, 0x74, 0xae, 0x08, 0x79, 0xc7, 0x0b,
+  0xd3, 0xd5, 0xa0, 0xe0, 0xe6, 0xf6, 0xac, 0xb3, 0x2a, 0x47, 0x5e, 0xcf, 0x8b, 0xc1, 0x6f, 0x8d,
+  0x5c, 0xe3, 0x8c, 0x9e, 0x21, 0xca, 0x67, 0xca, 0x0f, 0x07, 0x53, 0x68, 0x47, 0xe6, 0xb8, 0xd2,
+  0x89, 0xe2, 0x25, 0xc2, 0x04, 0x1d, 0xb1, 0x36, 0x36, 0x90, 0x0b, 0x6a, 0x02, 0x54, 0x9f, 0xbb,
+  0xd8, 0xee, 0x93, 0xf6, 0xd8, 0xbf, 0x77, 0x48, 0x7f, 0x8f, 0x5c, 0xae, 0xf1, 0x21, 0x69, 0x7f,
+  0x34, 0x5b, 0x52, 0x0c, 0xad, 0x86, 0x20, 0x51, 0xb4, 0x13, 0x58, 0x0c, 0x28, 0x7a, 0x85, 0x3e,
+  0x09, 0x07, 0x62, 0x9f, 0x20, 0xbe, 0xff, 0x7e, 0xb6, 0x70, 0xce, 0xa6, 0xf6, 0x75, 0x4e, 0x60,
+  0x9b, 0xf9, 0x05, 0x02, 0x31, 0xaa, 0x6c, 0x97, 0xb1, 0x7f, 0x6d, 0x29, 0x36, 0xf2, 0xb4, 0x2c,
+  0x99, 0x3a, 0x80, 0x88, 0x76, 0x87, 0x6c, 0x37, 0x98, 0xc0, 0x7f, 0x0d, 0x1e, 0x78, 0xd3, 0xb6,
+  0xe9, 0xda, 0x5f, 0x5e, 0xb9, 0x85, 0x83, 0xae, 0x86, 0x43, 0x7e, 0x01, 0x26, 0xef, 0xac, 0xb8,
+  0x75, 0xcb, 0xf1, 0xdb, 0x18, 0xe8, 0x41, 0x0e, 0x6e, 0x3f, 0x91, 0x32, 0x67, 0x54, 0x74, 0xe2,
+  0x33, 0x34, 0x31, 0xed, 0x88, 0x44, 0x9d, 0x9d, 0xb5, 0x60, 0x78, 0x20, 0xdb, 0x27, 0xef, 0x1f,
+  0x5c, 0x5a, 0xd3, 0xaf, 0xc8, 0xbb, 0x07, 0x97, 0x7e, 0xf1, 0xea, 0xdb, 0xf7, 0x90, 0x60, 0x17,
+  0x77, 0xd6, 0xae, 0x6a, 0x31, 0x13, 0xca, 0xcd, 0x91, 0x54, 0xbf, 0x91, 0x03, 0x88, 0xa2, 0x7a,
+  0x2a, 0x12, 0xd2, 0xe6, 0xe9, 0x3a, 0x31, 0xbc, 0x60, 0xc8, 0x81, 0x2f, 0x34, 0x96, 0x1f, 0x6e,
+  0xe0, 0x5f, 0xf0, 0xb6, 0xa7, 0x4a, 0xd1, 0x4e, 0xda, 0x66, 0x13, 0x9b, 0x4f, 0x71, 0xef, 0xb1,
+  0x90, 0x13, 0xa8, 0xff, 0xab, 0x39, 0xd5, 0xce, 0x1a, 0x90, 0x84, 0x66, 0xaa, 0xdd, 0xd8, 0xde,
+  0x9d, 0x91, 0x75, 0xc0, 0x88, 0x5a, 0xc9, 0x44, 0xb0, 0x09, 0x79, 0xad, 0x64, 0xc1, 0x61, 0xbf,
+  0xb2, 0x12, 0x50, 0xd0, 0x4e, 0x3c, 0x93, 0xb6, 0x5a, 0x27, 0xc0, 0x65, 0xa7, 0x53, 0xab, 0x6a,
+  0x3d, 0xea, 0xa9, 0x86, 0xcc, 0x24, 0x59, 0xfb, 0x7d, 0x8f, 0x96, 0xbc, 0x77, 0x26, 0x07, 0x7a,
+  0x1f, 0x10, 0x7c, 0x70, 0xc9, 0xd3, 0xab, 0xf7, 0x38, 0xec, 0xf0, 0xa0, 0x62, 0x79, 0xde, 0x21,
+  0x03, 0xc5, 0xe8, 0x79, 0x4d, 0x7e, 0xe6, 0x4d, 0x74, 0x0c, 0x14, 0xe6, 0x1f, 0x29, 0xda, 0xe1,
+  0x34, 0x76, 0x62, 0xb4, 0x1a, 0x00, 0x7e, 0xbf, 0xdf, 0x27, 0x51, 0x2a, 0x05, 0x8b, 0x2c, 0x26,
+  0x96, 0xd6, 0x87, 0x98, 0x84, 0x58, 0x1a, 0xcd, 0x30, 0x86, 0x6d, 0x38, 0xb2, 0x76, 0xbc, 0x40,
+  0x60, 0x3a, 0xbf, 0xa6, 0x32, 0xa9, 0x0a, 0xd4, 0xca, 0x78, 0xc4, 0xcc, 0x61, 0xce, 0xec, 0xe3,
+  0x93, 0xe9, 0xb3, 0xb4, 0x1d, 0x35, 0xbb, 0x89, 0xa8, 0x13, 0x4b, 0x91, 0xe4, 0x48, 0x76, 0x73,
+  0xb7, 0xb3, 0xe0, 0x62, 0x16, 0x97, 0x8a, 0x8d, 0x41, 0xf6, 0x94, 0x0d, 0x29, 0x72, 0x4c, 0x7b,
+  0xe6, 0x01, 0x07, 0xff, 0x3b, 0xf8, 0xfb, 0x18, 0x8c, 0x6e, 0xf4, 0x5a, 0xd4, 0x73, 0x75, 0x16,
+  0x77, 0xee, 0x1b, 0x99, 0x68, 0xd1, 0x65, 0x3e, 0x9e, 0x58, 0xde, 0x81, 0xb0, 0xd8, 0x06, 0xee,
+  0x81, 0x1f, 0x4d, 0xc1, 0x25, 0xf2, 0x04, 0x24, 0xf8, 0x61, 0x67, 0x0d, 0xe3, 0xa8, 0x32, 0xed,
+  0xa5, 0xe5, 0x19, 0x14, 0xad, 0x6f, 0xee, 0xe4, 0xe5, 0x74, 0x21, 0xaa, 0x12, 0x82, 0x8b, 0x51,
+  0x1c, 0xc7, 0xe0, 0x6a, 0xd0, 0xd8, 0xd4, 0x38, 0xbb, 0x74, 0xb7, 0x76, 0xb5, 0xe2, 0xde, 0x82,
+  0x71, 0x4c, 0xc3, 0x41, 0xb3, 0xed, 0x39, 0x98, 0xed, 0x9d, 0xae, 0x93, 0xcd, 0x2d, 0x87, 0xdc,
+  0x9d, 0x9b, 0xf5, 0x08, 0x0c, 0xf6, 0xc3, 0x43, 0x5c, 0x60, 0x0a, 0xb0, 0xc1, 0xbe, 0xbd, 0xa4,
+  0x21, 0x06, 0x4c, 0xe4, 0xdd, 0xa0, 0xe7, 0x0e, 0x50, 0x6a, 0xe7, 0x0f, 0x46, 0x30, 0xa0, 0x41,
+  0xe3, 0x2b, 0x92, 0x50, 0xb8, 0x16, 0x22, 0x94, 0xba, 0x97, 0x07, 0x5d, 0x5f, 0xcb, 0xd2, 0x98,
+  0x3c, 0x75, 0x83, 0x3e, 0xa6, 0x0d, 0xcb, 0x9c, 0x0d, 0xa4, 0x34, 0xde, 0x07, 0x8d, 0x28, 0x68,
+  0x3b, 0x54, 0x20, 0xfb, 0x53, 0x9b, 0x28, 0x63, 0x0c, 0xdf, 0xc8, 0xc3, 0xed, 0x0e, 0x8c, 0x0b,
+  0xb6, 0x5d, 0xcd, 0x83, 0xd9, 0xf6, 0x4c, 0xb7, 0x21, 0xa4, 0xee, 0xa9, 0xec, 0x25, 0xd5, 0x68,
+  0xc0, 0x99, 0xe3, 0xd9, 0x72, 0x0c, 0xa3, 0x84, 0x0f, 0x44, 0xe5, 0x74, 0x6f, 0x77, 0xc2, 0xda,
+  0x78, 0x9e, 0x6c, 0x2d, 0x97, 0x8e, 0x93, 0x15, 0x3b, 0xe7, 0xa0, 0x8e, 0xd8, 0xa4, 0x1c, 0x1b,
+  0xc5, 0x0b, 0xab, 0xad, 0x8d, 0x15, 0x29, 0xac, 0x8c, 0xab, 0x8e, 0x35, 0x05, 0xe7, 0x68, 0x9a,
+  0x1e, 0x5a, 0x44, 0x3f, 0xc7, 0x9c, 0xc7, 0x04, 0x32, 0x58, 0x94, 0x64, 0xc8, 0x6a, 0x2c, 0x5a,
+  0x27, 0xed, 0x80, 0xfa, 0x3a, 0xa6, 0xf5, 0x5c, 0x9f, 0x7d, 0x17, 0x7c, 0x88, 0xec, 0x05, 0x59,
+  0xfb, 0x8e, 0xbb, 0xbd, 0x21, 0x39, 0x1c, 0x46, 0x08, 0xf9, 0x35, 0xaf, 0x61, 0xcd, 0xe8, 0x2a,
+  0x08, 0xf6, 0x2e, 0xb1, 0xad, 0xce, 0xb1, 0x6f, 0xdf, 0x6e, 0x71, 0x4c, 0xa3, 0x21, 0x8a, 0x16,
+  0x49, 0x5d, 0x34, 0xdd, 0x93, 0x74, 0x39, 0xf4, 0xec, 0x4d, 0x7d, 0x35, 0xdf, 0xd6, 0xf3, 0x50,
+  0x6f, 0x96, 0xae, 0xb9, 0x86, 0x75, 0x66, 0x59, 0x8c, 0x01, 0x20, 0xf3, 0x5a, 0x08, 0xdb, 0x79,
+  0xb9, 0xc9, 0x79, 0x1e, 0xc4, 0x4c, 0xbb, 0x30, 0x36, 0x99, 0x42, 0xb7, 0x6d, 0xb3, 0xeb, 0xa1,
+  0x52, 0x12, 0xfe, 0xfe, 0xfa, 0xe4, 0xe4, 0x35, 0x89, 0x90, 0xa2, 0xed, 0x09, 0xed, 0x14, 0x9d,
+  0xe9, 0x39, 0x6e, 0xe8, 0xe7, 0xc3, 0x0c, 0x67, 0xea, 0x40, 0x9b, 0xab, 0x17, 0x73, 0x81, 0xab,
+  0xfb, 0xfa, 0xe4, 0xc5, 0x73, 0x0b, 0x65, 0xa0, 0xb4, 0xa6, 0x8b, 0x51, 0xa6, 0x0f, 0x29, 0x14,
+  0x6b, 0x8f, 0x17, 0xaa, 0x84, 0x2c, 0x17, 0x9c, 0x9e, 0x20, 0x1b, 0x1b, 0x16, 0x9c, 0xd7, 0x8e,
+  0xb0, 0xcb, 0x3d, 0x4c, 0xf0, 0x14, 0x8f, 0x29, 0x66, 0x4e, 0x5b, 0x32, 0x63, 0x9e, 0xfa, 0x95,
+  0xc5, 0xd0, 0xb9, 0xde, 0x09, 0x40, 0x98, 0x37, 0x7a, 0x1c, 0xdb, 0xce, 0x6d, 0x8c, 0xf4, 0x69,
+  0xc9, 0x7c, 0x9f, 0xed, 0x30, 0x69, 0x54, 0xc5, 0x16, 0x0c, 0xa0, 0xa8, 0xb5, 0x22, 0x3d, 0x40,
+  0x65, 0x4a, 0xdb, 0x38, 0x1b, 0x80, 0x62, 0x79, 0xcc, 0xef, 0xba, 0x33, 0x53, 0xdf, 0x73, 0x9d,
+  0x97, 0x71, 0xd8, 0xc9, 0x45, 0xea, 0x23, 0x61, 0x26, 0x33, 0xf0, 0x77, 0xa4, 0x4b, 0x2a, 0x07,
+  0x7a, 0x94, 0xe2, 0xc7, 0x78, 0x42, 0x46, 0x77, 0x88, 0xda, 0x26, 0x0f, 0x2e, 0x57, 0x18, 0x13,
+  0xd8, 0x5d, 0xbd, 0x0f, 0x4d, 0xc0, 0xd5, 0xca, 0xac, 0xd2, 0x54, 0xf3, 0x46, 0xb9, 0xd1, 0x6f,
+  0xd1, 0x6a, 0xb8, 0x6f, 0x11, 0x41, 0x71, 0x86, 0xea, 0xc4, 0x99, 0xed, 0x6c, 0x52, 0x26, 0xa2,
+  0x90, 0x31, 0x66, 0xec, 0x02, 0xf4, 0x2e, 0xd7, 0x96, 0xe1, 0xba, 0x74, 0xfb, 0xb7, 0xc4, 0xf0,
+  0x22, 0xaa, 0xbd, 0xf7, 0xb8, 0xbd, 0x81, 0x06, 0xb9, 0xbb, 0xe0, 0x9d, 0x0f, 0xb0, 0xe2, 0x09,
+  0xfb, 0x3d, 0x1f, 0xd9, 0xde, 0x1b, 0xd7, 0xaa, 0x73, 0x4a, 0xc5, 0x4f, 0x7f, 0xf8, 0x47, 0x74,
+  0x57, 0x68, 0xb8, 0xfc, 0xd1, 0x30, 0xc2, 0x77, 0x06, 0x68, 0xd9, 0x91, 0x4e, 0x4e, 0xdf, 0x3c,
+  0x3b, 0x90, 0x45, 0x89, 0xea, 0x0e, 0xf8, 0xf1, 0xb4, 0xd3, 0xe8, 0x16, 0x7e, 0x49, 0xd4, 0xb8,
+  0x6f, 0x9d, 0xab, 0x22, 0xe6, 0xde, 0x26, 0xde, 0x07, 0x17, 0x56, 0x0a, 0x34, 0xdd, 0xf9, 0x3f,
+  0xe0, 0xf0, 0xca, 0xbb, 0x8f, 0xa0, 0xc9, 0xca, 0xab, 0x73, 0xe3, 0x01, 0xe0, 0x0a, 0x47, 0x8d,
+  0xf3, 0xf2, 0xb6, 0x04, 0xb7, 0x3c, 0x9b, 0xd5, 0xb9, 0x06, 0x64, 0x9d, 0x59, 0xde, 0x76, 0x75,
+  0xc4, 0x1d, 0xba, 0xad, 0x88, 0x64, 0xec, 0x62, 0x9e, 0xf8, 0xec, 0xcb, 0x27, 0x9f, 0x10, 0xfc,
+  0xc4, 0x39, 0x13, 0x23, 0x93, 0xb9, 0xca, 0xf1, 0xa8, 0x63, 0xf5, 0x99, 0xa5, 0x83, 0xe8, 0x63,
+  0xeb, 0x7d, 0x9c, 0xf1, 0xa1, 0x6a, 0xb7, 0xae, 0xe3, 0xd0, 0xcd, 0x57, 0xb6, 0x94, 0xb0, 0x05,
+  0x04, 0x3a, 0x69, 0x04, 0x5d, 0x3a, 0x55, 0x50, 0xce, 0xb3, 0x8c, 0x31, 0x12, 0x69, 0x14, 0x2a,
+  0x31, 0x6a, 0x6f, 0xce, 0x8a, 0xa0, 0x03, 0x8d, 0x53, 0x7e, 0xdf, 0xcd, 0xa4, 0x40, 0x0c, 0x68,
+  0x1d, 0x3c, 0x9a, 0x7e, 0x1a, 0x0e, 0x8c, 0xb8, 0xcd, 0x51, 0xf3, 0xef, 0x3c, 0xf3, 0x12, 0x30,
+  0x2c, 0xf4, 0xe8, 0x1e, 0x34, 0x2f, 0xf4, 0xa8, 0x76, 0xab, 0x95, 0xe2, 0xfc, 0x8a, 0xdf, 0x55,
+  0x31, 0x67, 0x7b, 0xc6, 0x6b, 0x21, 0xe7, 0x50, 0x0c, 0x89, 0x76, 0xa2, 0x6c, 0x47, 0x8f, 0x15,
+  0x23, 0x53, 0x59, 0x61, 0x16, 0x08, 0x0f, 0x13, 0xc0, 0xc9, 0x7e, 0x6c, 0xc6, 0xa4, 0xe1, 0x27,
+  0x5d, 0xe2, 0xc6, 0xc8, 0x61, 0xf3, 0x33, 0xd2, 0x7e, 0xd4, 0x99, 0xd7, 0x9f, 0x9b, 0x5a, 0xc7,
+  0x40, 0xe1, 0x08, 0xa0, 0xc4, 0x65, 0x18, 0x8d, 0x91, 0xb2, 0xec, 0x6c, 0x1c, 0x91, 0x3a, 0x9d,
+  0x36, 0x7b, 0x49, 0xeb, 0x82, 0x8e, 0x73, 0xc4, 0x32, 0x30, 0x17, 0x3e, 0x63, 0xdd, 0xd6, 0x14,
+  0x11, 0x6d, 0xff, 0xb4, 0x91, 0x4f, 0x7f, 0x41, 0x73, 0x84, 0x26, 0x0c, 0xf3, 0xdf, 0xdd, 0x9a,
+  0xd8, 0xde, 0xd5, 0xba, 0xc8, 0x69, 0xb1, 0xe8, 0x99, 0x46, 0xc0, 0x60, 0x60, 0x0d, 0xf3, 0x29,
+  0x26, 0x61, 0x44, 0xa6, 0xfb, 0xb4, 0xee, 0xfe, 0x10, 0xf4, 0x3f, 0x98, 0x09, 0x8e, 0xf7, 0x19,
+  0x1a, 0x00, 0x00,
+};
+
+// /changepw.html: 2195 bytes, 967 gzipped
+static const uint8_t ASSET_1[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x55, 0x4d, 0x8f, 0xdb, 0x36,
+  0x10, 0xbd, 0xfb, 0x57, 0x4c, 0x88, 0xa2, 0x92, 0x81, 0x95, 0x64, 0x3b, 0x45, 0x9a, 0x7a, 0x2d,
+  0xa3, 0xe8, 0x66, 0x17, 0x58, 0xa0, 0x48, 0x82, 0xc4, 0x7b, 0xe8, 0x2d, 0xb4, 0x38, 0xb6, 0xd8,
+  0xa5, 0x48, 0x95, 0xa4, 0x2c, 0x1b, 0x1b, 0xff, 0xf7, 0x0e, 0x25, 0xcb, 0xd9, 0x04, 0xa9, 0xd1,
+  0x1e, 0x7a, 0xd2, 0x07, 0x67, 0x86, 0xef, 0xbd, 0x79, 0x1c, 0x2e, 0x5e, 0xbc, 0x79, 0x77, 0xb3,
+  0xfa, 0xe3, 0xfd, 0x2d, 0x94, 0xbe, 0x52, 0xcb, 0xd1, 0x22, 0x3c, 0x40, 0x71, 0xbd, 0xcd, 0x19,
+  0x6a, 0x16, 0x7e, 0x20, 0x17, 0xf4, 0xa8, 0xd0, 0x73, 0x28, 0x4a, 0x6e, 0x1d, 0xfa, 0x9c, 0x3d,
+  0xac, 0xee, 0x92, 0xd7, 0x0c, 0xb2, 0x61, 0x41, 0xf3, 0x0a, 0x73, 0xb6, 0x93, 0xd8, 0xd6, 0xc6,
+  0x7a, 0x06, 0x85, 0xd1, 0x1e, 0x35, 0x05, 0xb6, 0x52, 0xf8, 0x32, 0x17, 0xb8, 0x93, 0x05, 0x26,
+  0xdd, 0xc7, 0x15, 0x48, 0x2d, 0xbd, 0xe4, 0x2a, 0x71, 0x05, 0x57, 0x98, 0x4f, 0xd3, 0x49, 0x5f,
+  0xc8, 0x4b, 0xaf, 0x70, 0x79, 0x53, 0xd2, 0xde, 0x08, 0xef, 0xb9, 0x73, 0xad, 0xb1, 0x62, 0x91,
+  0xf5, 0xbf, 0x47, 0x0b, 0x25, 0xf5, 0x23, 0x94, 0x16, 0x37, 0x39, 0x2b, 0xbd, 0xaf, 0xdd, 0x3c,
+  0xcb, 0x0a, 0xa1, 0xd3, 0x3f, 0x9d, 0x40, 0x25, 0x77, 0x36, 0xd5, 0xe8, 0x33, 0x5d, 0x57, 0x99,
+  0xe7, 0x52, 0xb5, 0x52, 0x8b, 0xc2, 0xb9, 0x5f, 0x67, 0xe9, 0x2c, 0x9d, 0xfe, 0x92, 0x09, 0xe9,
+  0xfc, 0xf9, 0x7f, 0x5a, 0x49, 0x9d, 0xd2, 0x22, 0x03, 0x8b, 0x2a, 0x67, 0xce, 0x1f, 0x14, 0xba,
+  0x12, 0xd1, 0x07, 0xb2, 0xd9, 0x89, 0xed, 0xda, 0x88, 0x03, 0x14, 0x8a, 0x40, 0xe4, 0x6c, 0xbd,
+  0x4d, 0xb6, 0x96, 0x1f, 0x92, 0xe9, 0x64, 0x02, 0x1e, 0xf7, 0xbe, 0xff, 0x7a, 0x4d, 0x5f, 0x1b,
+  0x62, 0x99, 0x38, 0xae, 0x5d, 0x48, 0x15, 0x72, 0x37, 0x64, 0x54, 0x7c, 0x9f, 0xb4, 0x49, 0x25,
+  0xa0, 0xda, 0x27, 0xbc, 0xf1, 0x06, 0xea, 0xe4, 0xa7, 0x4e, 0xca, 0xe9, 0x10, 0xd1, 0xd5, 0x99,
+  0xed, 0x55, 0x5f, 0x62, 0x6d, 0x14, 0xc5, 0xae, 0x43, 0xd0, 0x89, 0x7e, 0x7d, 0xa6, 0x5f, 0x4e,
+  0x29, 0xb1, 0xfe, 0x2a, 0xcf, 0x55, 0xcf, 0x70, 0xbc, 0x22, 0x1c, 0x7d, 0xea, 0xca, 0x74, 0xb2,
+  0x4b, 0xdd, 0xe0, 0x55, 0xe8, 0x54, 0xa8, 0xe3, 0x4b, 0x04, 0x81, 0x1b, 0xde, 0x28, 0x7f, 0xae,
+  0x99, 0x2e, 0xb2, 0x9a, 0x6a, 0x6e, 0x8c, 0xad, 0x40, 0x8a, 0x9c, 0xd5, 0xed, 0x1d, 0xbd, 0xb2,
+  0x67, 0x74, 0xdb, 0x52, 0x7a, 0x0c, 0xa0, 0xc1, 0x9a, 0x46, 0x0b, 0x14, 0x1d, 0x54, 0x57, 0x72,
+  0x61, 0x5a, 0x70, 0x35, 0xa7, 0x56, 0x1e, 0x92, 0x97, 0x27, 0xd2, 0xa1, 0x35, 0x7c, 0x8d, 0xea,
+  0x9c, 0xaf, 0x4c, 0xf1, 0x08, 0x03, 0x50, 0x82, 0x36, 0x65, 0xc4, 0xd2, 0xe6, 0x4c, 0x63, 0xcb,
+  0x96, 0x6f, 0xb1, 0x7d, 0x46, 0xae, 0x4b, 0xa4, 0x02, 0x52, 0xd7, 0x8d, 0xef, 0xc0, 0x84, 0x20,
+  0xf0, 0x87, 0x9a, 0xdc, 0x34, 0x84, 0x31, 0xa0, 0x8e, 0x29, 0xd4, 0x5b, 0x32, 0x12, 0x7b, 0x15,
+  0xda, 0xf6, 0x57, 0x23, 0x2d, 0x8a, 0x61, 0xc3, 0x36, 0xd9, 0x34, 0x4a, 0xc1, 0x9a, 0x42, 0xd1,
+  0x0e, 0x88, 0x09, 0xfd, 0xac, 0xb7, 0x55, 0xd6, 0x63, 0xfc, 0x2f, 0x48, 0x49, 0xc6, 0x8d, 0x24,
+  0x49, 0x96, 0x37, 0xfd, 0xcb, 0x45, 0xc4, 0x43, 0xf0, 0xff, 0x82, 0x7a, 0xdd, 0x78, 0x6f, 0xf4,
+  0xa9, 0xb4, 0x6b, 0xd6, 0x95, 0xf4, 0xe7, 0x46, 0xd5, 0x87, 0x64, 0x06, 0xf5, 0x3e, 0x79, 0x79,
+  0xce, 0xa6, 0xd6, 0xad, 0x55, 0x83, 0x9d, 0x27, 0x3a, 0x5a, 0x7d, 0x23, 0x4b, 0xb3, 0x43, 0x3b,
+  0x1f, 0x16, 0x7f, 0x9e, 0x4c, 0xd8, 0xf2, 0x23, 0xdf, 0xe1, 0x22, 0xeb, 0xab, 0x77, 0xfe, 0x0a,
+  0x4c, 0x2a, 0xb7, 0x65, 0xdf, 0x1a, 0xad, 0x22, 0x9b, 0xb2, 0x65, 0xef, 0x98, 0x2c, 0x58, 0xe6,
+  0x0b, 0x36, 0x57, 0x58, 0x59, 0xfb, 0xe5, 0x88, 0x04, 0x70, 0x1e, 0x3a, 0x3b, 0xe5, 0x20, 0x4c,
+  0xd1, 0x54, 0x74, 0xf2, 0xd3, 0x2d, 0xfa, 0x5b, 0x85, 0xe1, 0xf5, 0xb7, 0xc3, 0xbd, 0x88, 0xa3,
+  0xde, 0x65, 0xd1, 0xf8, 0x7a, 0x14, 0x22, 0x53, 0x2e, 0xc4, 0xed, 0x8e, 0x16, 0x7f, 0xa7, 0xa3,
+  0x89, 0x1a, 0x6d, 0x1c, 0xf5, 0xec, 0xa2, 0x2b, 0xe0, 0xee, 0xa0, 0x0b, 0x88, 0x71, 0x0c, 0xf9,
+  0x12, 0x9e, 0x46, 0x98, 0xd6, 0x16, 0x43, 0xe8, 0x9b, 0xde, 0xc7, 0x31, 0x95, 0xe8, 0xb7, 0xd4,
+  0x97, 0xf6, 0x23, 0x23, 0x45, 0xe3, 0x74, 0xc7, 0x89, 0xf2, 0x10, 0x5f, 0x5c, 0x8a, 0x3f, 0xb5,
+  0xf1, 0xdb, 0x1c, 0xd2, 0xe4, 0x52, 0x16, 0x2d, 0x07, 0x4a, 0x72, 0x03, 0xb1, 0x86, 0x17, 0x79,
+  0x0e, 0xc5, 0x18, 0x9e, 0x42, 0x52, 0x1a, 0x04, 0xbc, 0xe9, 0xa7, 0x20, 0x15, 0x88, 0x86, 0x79,
+  0xe6, 0xa8, 0x16, 0x68, 0x43, 0x85, 0xb9, 0x2f, 0xca, 0xe8, 0xba, 0x8b, 0xed, 0x34, 0x7f, 0x4b,
+  0x23, 0x34, 0x44, 0x76, 0xca, 0x93, 0x51, 0xbe, 0x74, 0xd1, 0x55, 0x14, 0x67, 0xd1, 0x37, 0x56,
+  0x5f, 0xc3, 0xf1, 0x04, 0xac, 0x9b, 0x50, 0x39, 0x7c, 0x22, 0x9e, 0xf9, 0x0f, 0x4f, 0xa8, 0x0b,
+  0x23, 0xf0, 0xe1, 0xc3, 0xfd, 0x8d, 0xa9, 0x6a, 0xa3, 0x69, 0xd3, 0x58, 0x8f, 0x8f, 0x3f, 0x9e,
+  0x48, 0x7d, 0x3f, 0xa0, 0x18, 0x1f, 0x3f, 0x0d, 0x34, 0x2d, 0x95, 0xe2, 0x2d, 0x97, 0xd4, 0x47,
+  0x24, 0x5c, 0x71, 0x94, 0xd1, 0x98, 0x7f, 0xb8, 0x1f, 0x50, 0x53, 0x57, 0x88, 0x15, 0xfa, 0xd2,
+  0x88, 0x39, 0x71, 0x79, 0xf7, 0x71, 0x45, 0x7f, 0xc2, 0xa8, 0x44, 0xeb, 0xe6, 0xf0, 0x14, 0x9d,
+  0x88, 0x26, 0x2b, 0xf2, 0x69, 0x34, 0x8f, 0x78, 0x5d, 0x2b, 0x59, 0x70, 0x2f, 0x8d, 0xce, 0x68,
+  0x12, 0xb6, 0xe4, 0x75, 0xea, 0x79, 0xd2, 0x58, 0xd5, 0xc3, 0x10, 0xd1, 0xf1, 0xaa, 0x27, 0x70,
+  0x3c, 0x37, 0xd3, 0x9f, 0x11, 0xd8, 0x4e, 0xbb, 0xf8, 0x24, 0xab, 0x4d, 0xcd, 0x23, 0x69, 0x3a,
+  0xba, 0xa0, 0x29, 0x38, 0x72, 0xb3, 0x48, 0xe1, 0x03, 0x0a, 0x3a, 0x61, 0x05, 0x4d, 0xc0, 0x6d,
+  0x9a, 0xa6, 0xff, 0xa8, 0xed, 0xd6, 0x22, 0xea, 0xaf, 0xd5, 0x1d, 0x11, 0xdb, 0x95, 0xac, 0xd0,
+  0x34, 0x3e, 0x8e, 0x7b, 0xdf, 0x41, 0xb8, 0x2b, 0x4c, 0x9b, 0xd2, 0x8c, 0xe8, 0x88, 0xa4, 0xe1,
+  0xea, 0x09, 0x35, 0x32, 0xc1, 0x5d, 0xb9, 0x36, 0x9c, 0x06, 0x69, 0xb8, 0x2b, 0x69, 0x1b, 0x22,
+  0x43, 0x77, 0xc3, 0x84, 0x00, 0x1f, 0x01, 0x95, 0xc3, 0xef, 0xa2, 0xf5, 0xf0, 0xf9, 0x33, 0x44,
+  0x77, 0x74, 0x09, 0xd1, 0x41, 0xa5, 0x2b, 0x21, 0x60, 0xfe, 0xf7, 0xed, 0x1f, 0x1d, 0x47, 0x41,
+  0xaa, 0x45, 0x36, 0x1c, 0x3a, 0x3a, 0xbc, 0xa4, 0x5f, 0x77, 0x63, 0x75, 0xf7, 0xf6, 0xdf, 0x22,
+  0x7e, 0xe8, 0x4a, 0xc8, 0x07, 0x00, 0x00,
+};
+
+// /dashboard.html: 38352 bytes, 7895 gzipped
+static const uint8_t ASSET_2[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3d, 0x5d, 0x73, 0xdb, 0x48,
+  0x72, 0xef, 0xfc, 0x15, 0x63, 0xc6, 0x31, 0x80, 0xac, 0x08, 0x52, 0x92, 0xe5, 0xbd, 0x93, 0x44,
+  0xe9, 0x6c, 0x49, 0xf6, 0x2a, 0x27, 0xcb, 0x8e, 0x25, 0xaf, 0x2f, 0xe7, 0x75, 0x59, 0x20, 0x31,
+  0x22, 0x61, 0x81, 0x00, 0x17, 0x1f, 0xa4, 0x74, 0x5a, 0x56, 0x5d, 0xde, 0xf2, 0x94, 0x87, 0x24,
+  0x8f, 0xa9, 0xba, 0xb7, 0xab, 0xe4, 0x2d, 0x55, 0xa9, 0xba, 0xbc, 0x5f, 0xfe, 0xc9, 0xfe, 0x82,
+  0xfb, 0x09, 0xe9, 0x9e, 0x2f, 0xcc, 0x00, 0xe0, 0x87, 0x65, 0xaf, 0xef, 0x92, 0xad, 0x2d, 0x91,
+  0x04, 0x66, 0xfa, 0x6b, 0x7a, 0x7a, 0xba, 0x7b, 0x7a, 0xc6, 0xbb, 0xf7, 0x0e, 0x5f, 0x1c, 0x9c,
+  0xff, 0xfd, 0xcb, 0x23, 0x32, 0xcc, 0x46, 0xe1, 0x5e, 0x63, 0x17, 0x3f, 0x48, 0xe8, 0x45, 0x83,
+  0x6e, 0x93, 0x46, 0x4d, 0x7c, 0x40, 0x3d, 0x1f, 0x3e, 0x46, 0x34, 0xf3, 0x48, 0x7f, 0xe8, 0x25,
+  0x29, 0xcd, 0xba, 0xcd, 0xd7, 0xe7, 0x4f, 0x5b, 0x3f, 0x6b, 0x92, 0xb6, 0x7c, 0x11, 0x79, 0x23,
+  0xda, 0x6d, 0x4e, 0x02, 0x3a, 0x1d, 0xc7, 0x49, 0xd6, 0x24, 0xfd, 0x38, 0xca, 0x68, 0x04, 0x0d,
+  0xa7, 0x81, 0x9f, 0x0d, 0xbb, 0x3e, 0x9d, 0x04, 0x7d, 0xda, 0x62, 0x3f, 0xd6, 0x48, 0x10, 0x05,
+  0x59, 0xe0, 0x85, 0xad, 0xb4, 0xef, 0x85, 0xb4, 0xbb, 0xee, 0x76, 0x38, 0xa0, 0x2c, 0xc8, 0x42,
+  0xba, 0x77, 0xe0, 0x45, 0xe4, 0x98, 0xbc, 0xa1, 0x5e, 0x42, 0xce, 0x86, 0x00, 0x2b, 0x25, 0x87,
+  0x5e, 0x3a, 0xec, 0xc5, 0x5e, 0xe2, 0xef, 0xb6, 0x79, 0x93, 0xc6, 0x6e, 0x18, 0x44, 0x57, 0x64,
+  0x98, 0xd0, 0xcb, 0x6e, 0x73, 0x98, 0x65, 0xe3, 0x74, 0xbb, 0xdd, 0xee, 0xfb, 0x91, 0xfb, 0x21,
+  0xf5, 0x69, 0x18, 0x4c, 0x12, 0x37, 0xa2, 0x59, 0x3b, 0x1a, 0x8f, 0xda, 0x99, 0x17, 0x84, 0xd3,
+  0x20, 0xf2, 0xfb, 0x69, 0xfa, 0x8b, 0x0d, 0x77, 0xc3, 0x5d, 0xff, 0x79, 0xdb, 0x0f, 0xd2, 0x4c,
+  0x3d, 0x77, 0x47, 0x41, 0xe4, 0xc2, 0xcb, 0x26, 0x49, 0x68, 0xd8, 0x6d, 0xa6, 0xd9, 0x4d, 0x48,
+  0xd3, 0x21, 0xa5, 0x19, 0x32, 0xde, 0x16, 0x9c, 0xf7, 0x62, 0xff, 0x86, 0xf4, 0x43, 0x2f, 0x4d,
+  0xbb, 0xcd, 0xde, 0xa0, 0x35, 0x48, 0xbc, 0x9b, 0xd6, 0x7a, 0xa7, 0x43, 0x32, 0x7a, 0x9d, 0xf1,
+  0x5f, 0x3f, 0x83, 0x5f, 0x97, 0xc0, 0x71, 0x2b, 0xf5, 0xa2, 0x14, 0xbb, 0xfa, 0xc1, 0x44, 0xf6,
+  0x18, 0x79, 0xd7, 0xad, 0x69, 0xeb, 0x3a, 0x24, 0xa3, 0xeb, 0x96, 0x97, 0x67, 0x31, 0x19, 0xb7,
+  0x1e, 0x4a, 0xb1, 0xd2, 0x44, 0xb6, 0xba, 0x0c, 0xe9, 0x35, 0x09, 0x32, 0x3a, 0x4a, 0x5b, 0x7d,
+  0x90, 0x1b, 0xbc, 0xf8, 0x90, 0xa7, 0x59, 0x70, 0x79, 0xd3, 0xea, 0xd1, 0x6c, 0x4a, 0x69, 0x44,
+  0x46, 0xbd, 0xd6, 0x23, 0x01, 0x1a, 0x7b, 0xaf, 0xcb, 0x9e, 0x8c, 0x8a, 0x4d, 0x80, 0xcf, 0x08,
+  0xe8, 0xc5, 0xa1, 0xdf, 0xdc, 0xfb, 0xd3, 0xef, 0xfe, 0xe3, 0xbf, 0xc8, 0x42, 0x41, 0x0e, 0xd7,
+  0x01, 0xc8, 0xd8, 0x80, 0x91, 0x8e, 0x34, 0x8e, 0x1e, 0x75, 0x3a, 0xcd, 0xbd, 0xe7, 0x5e, 0xe4,
+  0x0d, 0x28, 0xb9, 0x89, 0xf3, 0x84, 0x4c, 0xa9, 0x97, 0x0d, 0x69, 0xd2, 0xf2, 0x93, 0x60, 0x02,
+  0xd4, 0xc4, 0x79, 0x76, 0x19, 0x64, 0x30, 0x92, 0x7e, 0xd0, 0xf7, 0xb2, 0x38, 0xd9, 0x6d, 0x8f,
+  0x51, 0x62, 0x9c, 0x38, 0x8d, 0xfb, 0x2a, 0x5f, 0x03, 0x4f, 0x08, 0xc0, 0x13, 0x03, 0xd8, 0x1e,
+  0x7d, 0x9f, 0x65, 0x2e, 0xaa, 0x5d, 0xb3, 0x96, 0x9e, 0x5e, 0x98, 0x53, 0xa4, 0x87, 0x0c, 0xe3,
+  0x09, 0x4d, 0xb6, 0xf3, 0x08, 0xc4, 0x06, 0xe3, 0x4f, 0x81, 0xbe, 0xbf, 0x3b, 0x3f, 0xdf, 0x6d,
+  0x7b, 0x3a, 0x2c, 0xcf, 0xc7, 0x11, 0xbd, 0x0b, 0xb0, 0xc7, 0xd8, 0xb3, 0x04, 0x2d, 0x8c, 0x07,
+  0xc0, 0x68, 0x73, 0xa1, 0x98, 0xaa, 0x90, 0x4e, 0x58, 0x2f, 0x0e, 0x4a, 0x48, 0xa4, 0xcd, 0x47,
+  0x1b, 0xbe, 0xa5, 0xb4, 0x9f, 0x05, 0x71, 0xa4, 0xe9, 0xd3, 0x74, 0x08, 0xf2, 0x41, 0xad, 0x20,
+  0x49, 0x8c, 0x50, 0xfc, 0xd6, 0x06, 0x8c, 0x66, 0x3a, 0xf4, 0xfc, 0x78, 0x8a, 0xa3, 0xfe, 0xb0,
+  0x59, 0x23, 0xd2, 0xb2, 0x76, 0x18, 0x22, 0x86, 0x4e, 0x1b, 0x4c, 0xc5, 0x36, 0x0c, 0xca, 0xa5,
+  0x8e, 0xa4, 0x74, 0x14, 0x70, 0x3d, 0x39, 0xcb, 0xbc, 0x2c, 0x4f, 0x81, 0xba, 0x8d, 0x55, 0x46,
+  0x8d, 0xc1, 0x4c, 0xc7, 0xa0, 0x56, 0x81, 0x8f, 0x73, 0x05, 0xfb, 0x1e, 0x4b, 0x05, 0x50, 0x42,
+  0x0a, 0x22, 0x94, 0x02, 0x08, 0x3a, 0xee, 0x5f, 0x91, 0x29, 0x70, 0x35, 0xd4, 0x38, 0xbb, 0xcc,
+  0xc3, 0x90, 0xc8, 0x39, 0xf4, 0x10, 0x75, 0x6c, 0xb7, 0x8d, 0x10, 0xab, 0x80, 0xcf, 0x81, 0xe2,
+  0xe6, 0x12, 0xfd, 0x6c, 0xa9, 0xce, 0x52, 0xcc, 0xf5, 0xfa, 0xa7, 0x88, 0xef, 0xe5, 0x59, 0x16,
+  0x73, 0x2c, 0x59, 0x3c, 0x18, 0x84, 0xf4, 0x00, 0xa9, 0x7c, 0x11, 0x29, 0x44, 0x53, 0x4e, 0xe1,
+  0xf8, 0xa6, 0xb5, 0x21, 0x69, 0xe6, 0xe4, 0x82, 0x8c, 0x5b, 0x5b, 0x72, 0xce, 0xf3, 0x11, 0xe3,
+  0xe3, 0xae, 0xde, 0x32, 0x8a, 0x5e, 0x80, 0x06, 0x71, 0x24, 0xf3, 0xb1, 0x5d, 0x5e, 0x2e, 0x43,
+  0x97, 0x80, 0xa4, 0xe6, 0x21, 0xc3, 0x77, 0x1c, 0xd5, 0xe5, 0xa5, 0x86, 0x4b, 0x0a, 0x40, 0xa8,
+  0xd7, 0xdd, 0x15, 0x6d, 0x89, 0xce, 0x08, 0xdd, 0x3a, 0x89, 0x61, 0xd0, 0x03, 0x2a, 0x34, 0x67,
+  0xb1, 0x1d, 0xc1, 0x2e, 0x9b, 0x00, 0xfa, 0x19, 0xed, 0x25, 0x79, 0x70, 0x45, 0x50, 0x5d, 0x61,
+  0x8c, 0x7d, 0x12, 0x5f, 0x12, 0xcf, 0x4f, 0x68, 0x4a, 0xe2, 0x11, 0xf1, 0x29, 0xa8, 0x34, 0x58,
+  0x66, 0x0a, 0x2b, 0xc7, 0xff, 0xfc, 0x21, 0xf1, 0x83, 0xc8, 0x83, 0xf5, 0x83, 0x4c, 0xbc, 0x34,
+  0x03, 0x68, 0x24, 0xa4, 0x83, 0x01, 0xfe, 0x8c, 0xe3, 0x04, 0x9b, 0x82, 0xca, 0x27, 0x41, 0x74,
+  0x19, 0x27, 0x23, 0xa4, 0xc2, 0x6d, 0x70, 0xeb, 0xa3, 0x0d, 0x3b, 0xa8, 0x05, 0x2c, 0x37, 0x37,
+  0x0c, 0xaf, 0xb0, 0x98, 0xa1, 0xd7, 0xa3, 0xc8, 0x4c, 0xd2, 0x6d, 0x86, 0x8c, 0xfa, 0x38, 0x3a,
+  0x85, 0x45, 0x4b, 0x8d, 0x05, 0x57, 0x58, 0xc9, 0x01, 0x63, 0x7a, 0x44, 0xfd, 0x20, 0xd7, 0xb9,
+  0xf9, 0x9a, 0x09, 0x7e, 0x94, 0xf6, 0x87, 0x49, 0xf0, 0x61, 0x12, 0x44, 0x03, 0x62, 0x23, 0x27,
+  0x6d, 0xc6, 0x86, 0xb3, 0xdb, 0x66, 0x38, 0x00, 0x57, 0x10, 0x8d, 0xf3, 0x8c, 0x0d, 0xbc, 0x89,
+  0x2a, 0xbb, 0x19, 0x53, 0x2e, 0x25, 0x85, 0x76, 0x94, 0xb5, 0xd6, 0x89, 0xd0, 0x83, 0x5e, 0x9c,
+  0xe0, 0x92, 0x20, 0x35, 0x01, 0x94, 0x56, 0xd2, 0xd3, 0x24, 0xe3, 0x10, 0x38, 0x1a, 0xc2, 0x08,
+  0x50, 0x60, 0xe0, 0x09, 0x60, 0x77, 0xc9, 0xe3, 0x11, 0xc8, 0x2b, 0xf1, 0xbd, 0xd1, 0x1a, 0x39,
+  0x3d, 0xe1, 0x4b, 0x68, 0x75, 0x02, 0x0c, 0x92, 0xc0, 0x27, 0xf8, 0xa7, 0xd5, 0x8f, 0xc3, 0x14,
+  0x70, 0xa5, 0xa3, 0xed, 0xe2, 0xe7, 0x06, 0x9b, 0x1b, 0x8b, 0xa5, 0x74, 0x02, 0x7f, 0xb3, 0xdc,
+  0xbf, 0x83, 0xa4, 0x64, 0xcf, 0x45, 0x82, 0x29, 0xa0, 0x7f, 0x2e, 0xe1, 0x6c, 0x6d, 0xb8, 0x9b,
+  0x5f, 0x77, 0x36, 0xca, 0x02, 0x99, 0xc3, 0x5c, 0x1c, 0x0d, 0xee, 0xca, 0x9d, 0xec, 0xba, 0x90,
+  0xbd, 0x02, 0xfe, 0xe7, 0xe2, 0xef, 0xa1, 0xfb, 0xb3, 0x9f, 0x6f, 0x99, 0xec, 0xad, 0xba, 0xee,
+  0x6e, 0x12, 0x7c, 0xde, 0x9a, 0x26, 0xde, 0xb8, 0x64, 0x0e, 0x53, 0x6f, 0x42, 0x4f, 0x04, 0xcd,
+  0x4f, 0xb2, 0xc2, 0x20, 0x32, 0xd3, 0x34, 0xbe, 0x2e, 0x6c, 0x06, 0xda, 0x27, 0xb5, 0x88, 0xd6,
+  0x19, 0x28, 0xf6, 0x52, 0x08, 0x88, 0x19, 0x09, 0x12, 0x8f, 0xd3, 0xd0, 0xf3, 0x74, 0xcb, 0xa8,
+  0x6c, 0xbd, 0x14, 0x13, 0x5f, 0x88, 0x96, 0xd9, 0xfb, 0xb2, 0xb9, 0x47, 0x7e, 0x0d, 0x28, 0xf9,
+  0x68, 0xe4, 0x25, 0x37, 0x0b, 0xc0, 0x00, 0x5d, 0x44, 0x77, 0xe1, 0xc6, 0x9a, 0xe1, 0xe5, 0x96,
+  0xad, 0x24, 0xd2, 0x2f, 0x65, 0x50, 0xdf, 0x80, 0x45, 0x53, 0xd6, 0x14, 0x79, 0x12, 0xfe, 0xd6,
+  0x2a, 0x82, 0x11, 0x20, 0x4e, 0xe3, 0x01, 0x19, 0xa0, 0x71, 0x45, 0xeb, 0xe8, 0x7b, 0xe0, 0x94,
+  0xc7, 0xe3, 0x01, 0x1d, 0x7a, 0x5e, 0xe8, 0xbb, 0x15, 0x03, 0xb9, 0x8a, 0x59, 0x28, 0x14, 0xd0,
+  0xec, 0x2b, 0x05, 0xb8, 0x65, 0xc8, 0xaf, 0x59, 0x59, 0x08, 0x44, 0x23, 0x18, 0xb8, 0x73, 0x3a,
+  0x1a, 0xd3, 0x04, 0x38, 0xc9, 0x85, 0xa3, 0x68, 0xf0, 0xa8, 0xde, 0x26, 0xc5, 0x2c, 0x2c, 0x39,
+  0x2a, 0xad, 0x79, 0xfe, 0xe5, 0xc7, 0xd3, 0xf2, 0x06, 0x7c, 0xd6, 0x1a, 0x22, 0xf0, 0xf1, 0x17,
+  0xc2, 0x9e, 0x04, 0xfd, 0x61, 0x06, 0x8b, 0xc7, 0x1c, 0x2a, 0x0e, 0x83, 0xe4, 0x0b, 0x10, 0x72,
+  0xe2, 0x79, 0x19, 0x2e, 0xb7, 0xf9, 0x18, 0x54, 0x85, 0xd6, 0x90, 0xf2, 0x9a, 0xbd, 0xf8, 0x12,
+  0x32, 0x79, 0xc1, 0x63, 0x89, 0x28, 0xd7, 0xa9, 0xe0, 0x01, 0xc6, 0x69, 0x3c, 0x5d, 0x42, 0x40,
+  0xa9, 0xf5, 0x21, 0xc5, 0xd0, 0xce, 0x9c, 0x2f, 0xd7, 0x29, 0x29, 0x61, 0xfc, 0xec, 0xb4, 0x4f,
+  0xbc, 0xc8, 0xf7, 0xbc, 0x41, 0x95, 0xa4, 0xf3, 0xd8, 0xf7, 0x6e, 0x3e, 0x82, 0x05, 0xd6, 0xfe,
+  0x0e, 0x4c, 0x7c, 0x61, 0x73, 0x75, 0x10, 0x87, 0xb1, 0xb4, 0x57, 0x7c, 0xd1, 0xe3, 0xab, 0x5b,
+  0x1f, 0x9f, 0x37, 0x19, 0x3f, 0xec, 0xeb, 0xcb, 0xa0, 0x7f, 0x45, 0x93, 0xb2, 0xbf, 0x3b, 0x6c,
+  0xad, 0x6f, 0x68, 0x0b, 0x5d, 0x47, 0xac, 0x7d, 0x2d, 0xb9, 0xa8, 0x7d, 0x21, 0x26, 0x9e, 0x24,
+  0xc1, 0x60, 0x98, 0x45, 0x34, 0x5d, 0x39, 0x02, 0xda, 0x54, 0xa1, 0x15, 0x77, 0x25, 0x4c, 0xab,
+  0x0c, 0x93, 0x8a, 0x4e, 0x68, 0xb8, 0x4d, 0x8a, 0xf5, 0xad, 0xa7, 0x50, 0x7c, 0xeb, 0xc1, 0xba,
+  0xb8, 0x61, 0x6a, 0xc2, 0x28, 0x8e, 0xe2, 0x22, 0x8a, 0x29, 0xbb, 0x11, 0x5c, 0xa2, 0x51, 0x3e,
+  0xea, 0x51, 0x21, 0xd2, 0x02, 0xda, 0x31, 0xb6, 0x68, 0x12, 0x88, 0x58, 0xbb, 0xcd, 0x0e, 0x7c,
+  0x7a, 0xd7, 0xdd, 0xe6, 0xc6, 0xd6, 0x56, 0x13, 0x1c, 0x6b, 0x3a, 0xee, 0x36, 0xd7, 0x35, 0x89,
+  0x6f, 0x74, 0xaa, 0xae, 0xc5, 0x7a, 0xe1, 0x5a, 0xb4, 0x57, 0xe1, 0x7b, 0xbd, 0xe4, 0x2d, 0x14,
+  0x84, 0x1c, 0xd2, 0x7e, 0xe1, 0x2b, 0x5c, 0xa3, 0xaf, 0x00, 0x0b, 0xab, 0x19, 0x3a, 0x81, 0xbe,
+  0x6e, 0xa8, 0x30, 0x59, 0x3e, 0xd9, 0x44, 0x0d, 0xfe, 0xf1, 0x1f, 0xff, 0x79, 0xbd, 0x53, 0x1f,
+  0x30, 0xe9, 0xac, 0x7e, 0x02, 0x86, 0xaf, 0x0c, 0xf8, 0xe6, 0x5c, 0xd1, 0xa5, 0x9c, 0x78, 0xd1,
+  0x80, 0xd6, 0xc9, 0xd3, 0xa4, 0xe5, 0x2c, 0x0c, 0xfc, 0x8a, 0x3a, 0x37, 0xbf, 0xa0, 0xca, 0x3e,
+  0x66, 0xb0, 0x6b, 0xf4, 0xb5, 0xb4, 0x9e, 0x6f, 0xd4, 0xc6, 0xbc, 0x10, 0xa4, 0x64, 0x5e, 0x92,
+  0x55, 0xfc, 0x3b, 0x4d, 0x98, 0x37, 0x34, 0x0c, 0xe3, 0xe9, 0xdc, 0xe8, 0x53, 0xbc, 0x66, 0xde,
+  0xd8, 0x9f, 0x7e, 0xf7, 0xaf, 0xff, 0x40, 0x5e, 0x71, 0x90, 0xf5, 0x83, 0x08, 0xf8, 0x68, 0xf6,
+  0x26, 0xb8, 0x0c, 0x16, 0x61, 0x64, 0xfe, 0xe2, 0xd6, 0x22, 0x67, 0x52, 0x60, 0xfb, 0x97, 0x3f,
+  0x20, 0x36, 0x9a, 0x91, 0x37, 0xc1, 0xd3, 0xa0, 0x1e, 0x21, 0xa3, 0xe5, 0x8c, 0x7e, 0x9f, 0xd3,
+  0xa8, 0x4f, 0x17, 0x21, 0x1d, 0xe7, 0xc9, 0x38, 0x9c, 0x8f, 0x56, 0xbc, 0x66, 0x88, 0x7f, 0xfc,
+  0xb7, 0x7f, 0x27, 0x67, 0x08, 0x97, 0x48, 0xc0, 0x7f, 0xbe, 0xb0, 0xfb, 0x69, 0x90, 0x8c, 0xa6,
+  0x5e, 0x22, 0x57, 0x6d, 0xa9, 0x07, 0xc3, 0xcd, 0xb2, 0x7f, 0x68, 0x76, 0x36, 0xfd, 0x5f, 0x16,
+  0x74, 0x00, 0x3c, 0x98, 0xd4, 0x8f, 0xf3, 0x2c, 0xc6, 0x10, 0xba, 0x0f, 0x80, 0x36, 0x4b, 0x69,
+  0x4b, 0x1e, 0xb4, 0x9b, 0x86, 0x4e, 0xe4, 0x76, 0xaa, 0x46, 0x82, 0xc7, 0xdb, 0xd7, 0x5c, 0xe3,
+  0x8c, 0x05, 0x61, 0x48, 0xfb, 0x57, 0xbd, 0xf8, 0x9a, 0xcf, 0x24, 0xcc, 0x7f, 0x72, 0xbf, 0x42,
+  0x33, 0x84, 0xc9, 0xa8, 0xa5, 0x5a, 0x89, 0xd8, 0xa0, 0x20, 0x8c, 0x5c, 0x56, 0x58, 0x96, 0x31,
+  0x80, 0xb4, 0x96, 0x62, 0x0c, 0x3e, 0x5a, 0x08, 0x1b, 0x42, 0x08, 0x07, 0x88, 0x1c, 0xa3, 0x42,
+  0xe5, 0x0b, 0x95, 0x65, 0x31, 0x27, 0x1d, 0x26, 0x13, 0x1b, 0xba, 0x06, 0x32, 0x4e, 0x38, 0x8b,
+  0x75, 0x61, 0xd4, 0x66, 0xc5, 0x70, 0x7d, 0x3d, 0x37, 0xa9, 0xc4, 0xf3, 0xca, 0x6c, 0x9e, 0xfd,
+  0x13, 0xa9, 0x12, 0x59, 0x0d, 0xa6, 0xf8, 0x9b, 0xba, 0x88, 0xc1, 0x70, 0x1e, 0x6a, 0x43, 0xa9,
+  0x3b, 0x4b, 0xef, 0xb9, 0x17, 0xe5, 0x5e, 0x08, 0x54, 0x85, 0xb1, 0xe7, 0x0b, 0xd1, 0xe1, 0x98,
+  0x12, 0x8f, 0xcd, 0x83, 0x6e, 0xb3, 0xcd, 0x5f, 0x49, 0xd5, 0x05, 0xe3, 0x4a, 0xb3, 0x61, 0x0c,
+  0xe4, 0xbe, 0x7c, 0x71, 0x76, 0xde, 0x24, 0x30, 0xa1, 0xb8, 0xa6, 0x8c, 0xf2, 0x30, 0x0b, 0xc6,
+  0x30, 0xcf, 0xda, 0x4c, 0x25, 0x30, 0x80, 0x69, 0x96, 0xd3, 0x39, 0x15, 0xf5, 0xba, 0x0c, 0x42,
+  0x80, 0xc8, 0x37, 0x1f, 0xa4, 0xa6, 0x3c, 0x65, 0xcf, 0xbc, 0x7e, 0x9f, 0x8e, 0xb3, 0x6e, 0xd3,
+  0xed, 0x05, 0x11, 0x66, 0xf7, 0xbf, 0xcf, 0x83, 0x04, 0xc4, 0x6e, 0x04, 0xf9, 0xc2, 0x1d, 0xa9,
+  0x0d, 0x13, 0xf9, 0xca, 0x28, 0x46, 0x96, 0x23, 0x4b, 0xf3, 0xde, 0x28, 0xc8, 0x3e, 0xcb, 0x98,
+  0xbe, 0x16, 0xe2, 0x2a, 0x0c, 0x09, 0x32, 0xad, 0xfb, 0x99, 0x4c, 0xc4, 0x5a, 0xfc, 0x95, 0x66,
+  0x49, 0x1c, 0x0d, 0x0a, 0x0b, 0x00, 0x20, 0x53, 0x90, 0xef, 0x36, 0x0c, 0x24, 0x7f, 0xa3, 0x79,
+  0x1d, 0xe2, 0x9d, 0x9e, 0x20, 0x65, 0xef, 0x24, 0xe8, 0x10, 0x6d, 0x8e, 0x84, 0xf8, 0xfa, 0x78,
+  0x21, 0xac, 0x3c, 0xf8, 0xb6, 0x0c, 0x6d, 0x05, 0xa0, 0xcf, 0x60, 0x25, 0xaa, 0x05, 0x87, 0x4b,
+  0xd4, 0xb7, 0x5e, 0x12, 0x78, 0x51, 0x76, 0x82, 0xf3, 0xb7, 0x06, 0x2a, 0x77, 0x6b, 0xbf, 0x90,
+  0x45, 0x3d, 0x0c, 0xd2, 0x71, 0xe8, 0xdd, 0x08, 0x43, 0xfa, 0x91, 0xc6, 0x4e, 0x79, 0x83, 0x0b,
+  0x2c, 0x5e, 0x14, 0x80, 0x1d, 0xa3, 0x6f, 0xc0, 0x03, 0x4b, 0x97, 0xd8, 0x3c, 0x6c, 0xd3, 0xea,
+  0xdd, 0xb4, 0xa6, 0xf0, 0x49, 0x78, 0x3f, 0x60, 0xbb, 0x6a, 0xef, 0x3e, 0x3f, 0x91, 0x43, 0x9a,
+  0x1d, 0xa7, 0x8f, 0xc3, 0xa9, 0x77, 0x93, 0x6e, 0x2c, 0x33, 0xcc, 0xac, 0x15, 0xc8, 0x1a, 0x24,
+  0x6d, 0x7d, 0x73, 0x74, 0x4e, 0x8e, 0xcf, 0xac, 0x2a, 0x89, 0x95, 0x74, 0x1b, 0xc3, 0x70, 0x98,
+  0x27, 0x8c, 0xa5, 0x8d, 0x39, 0xb9, 0x36, 0x6e, 0x50, 0xce, 0x74, 0xd0, 0xc4, 0x86, 0xd1, 0x8f,
+  0x23, 0x3f, 0x75, 0xb6, 0x35, 0x43, 0x67, 0x40, 0x9b, 0xef, 0x58, 0x6f, 0x76, 0x6a, 0x29, 0x5b,
+  0xd5, 0xc5, 0x9f, 0xe7, 0x85, 0x1b, 0xd8, 0xeb, 0x1c, 0xf1, 0xcd, 0x47, 0x9d, 0x5a, 0x47, 0xfc,
+  0xe1, 0xe7, 0x77, 0xc4, 0x39, 0x2d, 0x9f, 0xe8, 0x83, 0x6f, 0xa5, 0xf5, 0xde, 0x14, 0x03, 0xfe,
+  0x69, 0xee, 0xb7, 0x01, 0x7a, 0x45, 0xbf, 0x9b, 0x89, 0x6f, 0x82, 0xa3, 0x2a, 0xbe, 0x57, 0x84,
+  0xae, 0x8d, 0x36, 0xa6, 0x33, 0x99, 0x50, 0x04, 0xf0, 0xf1, 0xc2, 0xa0, 0x99, 0xf9, 0x3e, 0xcd,
+  0xbd, 0x0e, 0xe9, 0x92, 0x28, 0x8e, 0x83, 0x6c, 0x8d, 0x00, 0x02, 0xf8, 0xe1, 0xc1, 0xd2, 0xf3,
+  0xc1, 0x37, 0x03, 0xea, 0x2f, 0x64, 0x80, 0xd0, 0x52, 0x12, 0xb0, 0x40, 0x6c, 0xc7, 0x90, 0x19,
+  0xa1, 0x94, 0x86, 0x80, 0xb0, 0x6c, 0x2d, 0x5f, 0xe6, 0xbd, 0x30, 0xe8, 0x97, 0x23, 0xe9, 0x05,
+  0x49, 0x63, 0x34, 0xa8, 0x0c, 0xd2, 0x62, 0xa9, 0x3c, 0x12, 0xcb, 0x79, 0xb3, 0x8c, 0x90, 0xfb,
+  0x11, 0x02, 0xed, 0xde, 0x27, 0x5a, 0xe5, 0x8f, 0xd9, 0x59, 0x1a, 0xf4, 0x62, 0x7a, 0x75, 0xd7,
+  0x88, 0x5c, 0x24, 0xf7, 0x07, 0x2c, 0x12, 0x6f, 0x56, 0x03, 0xf4, 0x78, 0x40, 0x42, 0x7c, 0x55,
+  0x58, 0x04, 0x4d, 0xdc, 0x95, 0x7e, 0x5c, 0xbd, 0x14, 0x3f, 0x23, 0x5f, 0x66, 0x2a, 0xa4, 0x8a,
+  0x0b, 0xf6, 0xc4, 0x1a, 0x1d, 0x8f, 0x99, 0x48, 0x84, 0xee, 0x1e, 0xbd, 0x7a, 0xf5, 0xe2, 0x55,
+  0x73, 0x8f, 0x7d, 0xec, 0xb6, 0xf9, 0xbb, 0x4a, 0xa3, 0x37, 0x8f, 0x5f, 0x9d, 0x36, 0xf7, 0xf0,
+  0xef, 0xdc, 0x26, 0xc7, 0xa7, 0x4f, 0x5f, 0x34, 0xf7, 0xf0, 0xef, 0xdc, 0x26, 0x87, 0x47, 0x4f,
+  0x5e, 0x3f, 0x83, 0xc5, 0x0c, 0x3f, 0xb4, 0x46, 0x85, 0x02, 0xa8, 0xd9, 0xa1, 0xb3, 0xb9, 0xd4,
+  0x53, 0xdc, 0x52, 0xb9, 0x65, 0x91, 0xa8, 0x02, 0xbf, 0x43, 0x00, 0x78, 0x91, 0x67, 0x63, 0x6d,
+  0x67, 0xbc, 0x9c, 0x53, 0x1f, 0xb6, 0x1e, 0x76, 0x08, 0xda, 0x83, 0x4b, 0x0c, 0x17, 0x6f, 0x78,
+  0xe1, 0x83, 0x4a, 0xa7, 0x01, 0xb4, 0x84, 0x96, 0xf6, 0xd9, 0xdb, 0x20, 0xc6, 0x08, 0x9d, 0xa2,
+  0xc5, 0x9e, 0x6b, 0x75, 0xb7, 0xfd, 0x50, 0xf4, 0x23, 0xb8, 0x85, 0x01, 0x53, 0x29, 0xc6, 0x4d,
+  0xb9, 0x3c, 0x99, 0x04, 0x13, 0x9a, 0x12, 0x11, 0xf1, 0xe2, 0xde, 0x9c, 0x67, 0xea, 0xaf, 0x90,
+  0x48, 0xda, 0x4f, 0x82, 0x31, 0x48, 0x08, 0x16, 0x99, 0x34, 0x23, 0x7c, 0x47, 0x51, 0xf7, 0x4f,
+  0xc0, 0x38, 0xd8, 0x13, 0xfe, 0xdb, 0x21, 0xdd, 0x3d, 0x72, 0xdb, 0x08, 0x2e, 0x89, 0x7d, 0x4f,
+  0x3d, 0x4a, 0x68, 0x96, 0x27, 0x11, 0xb1, 0xac, 0x1d, 0x01, 0xa2, 0xe7, 0xa5, 0x14, 0x3a, 0x89,
+  0x06, 0x2e, 0xd7, 0xca, 0x1f, 0x7e, 0x50, 0x0f, 0xae, 0xe8, 0x0d, 0xfe, 0x2c, 0x3a, 0x60, 0xa9,
+  0x8d, 0xd1, 0x21, 0x1a, 0xe4, 0x58, 0x75, 0xb1, 0x5f, 0x79, 0xe4, 0x62, 0xf0, 0x34, 0xa6, 0xc9,
+  0x01, 0xa0, 0xb0, 0x1d, 0xb2, 0xad, 0x01, 0x01, 0x99, 0x68, 0x30, 0x84, 0x3f, 0xa7, 0x81, 0x10,
+  0x4f, 0x16, 0x40, 0x48, 0xf3, 0xcb, 0xcb, 0xe0, 0x1a, 0x80, 0xbc, 0x45, 0x74, 0x6b, 0x08, 0xf1,
+  0x9d, 0x0b, 0xee, 0x35, 0x4c, 0x34, 0xfb, 0x49, 0x1c, 0x87, 0xd4, 0x8b, 0x1c, 0xf7, 0x43, 0x1c,
+  0x44, 0xb6, 0x45, 0x2c, 0x67, 0xa7, 0x21, 0x18, 0x17, 0xdd, 0xf6, 0xc9, 0xc5, 0xfd, 0x5b, 0x64,
+  0x7d, 0x46, 0xde, 0xde, 0xbf, 0xe5, 0x0f, 0x67, 0xef, 0x2e, 0x00, 0x03, 0x3e, 0xdc, 0x69, 0xcc,
+  0x24, 0x1a, 0x34, 0x30, 0x67, 0x4c, 0x2b, 0xb9, 0x65, 0x01, 0x84, 0x7e, 0xdc, 0xcf, 0x47, 0x30,
+  0xa3, 0xdd, 0x01, 0xcd, 0x8e, 0x42, 0x8a, 0x5f, 0x9f, 0xdc, 0x1c, 0xfb, 0xb6, 0x55, 0xb1, 0x7e,
+  0x88, 0x57, 0x03, 0xa3, 0x19, 0xa8, 0x15, 0xc1, 0xe8, 0x5d, 0x0a, 0x60, 0xa8, 0x3d, 0xcf, 0x8a,
+  0x46, 0x05, 0x48, 0x2f, 0xbd, 0x89, 0xfa, 0xc4, 0xd6, 0x07, 0xbe, 0x4c, 0xbf, 0xd4, 0x80, 0x9d,
+  0x46, 0x96, 0xdc, 0x40, 0x23, 0x0e, 0x11, 0x37, 0xb5, 0xa1, 0xfb, 0xd4, 0x0b, 0x40, 0xa7, 0x68,
+  0xd6, 0x1f, 0xda, 0x56, 0x3b, 0x0c, 0xd2, 0x4c, 0xc7, 0x82, 0xf8, 0x19, 0x48, 0x68, 0xec, 0xc6,
+  0x57, 0x0e, 0xc9, 0x86, 0x09, 0xac, 0x1e, 0x11, 0x9d, 0x92, 0xa3, 0x24, 0x89, 0x13, 0xdb, 0xfa,
+  0xe6, 0xfc, 0xfc, 0x25, 0xb1, 0xc8, 0x57, 0x08, 0xce, 0xe5, 0x55, 0x11, 0x8a, 0x66, 0x31, 0xb0,
+  0x05, 0x1a, 0x6c, 0xf3, 0x21, 0x8d, 0x23, 0x1b, 0x9a, 0x94, 0x89, 0x74, 0x83, 0x28, 0xa2, 0xc9,
+  0x37, 0xe7, 0xcf, 0x4f, 0xa0, 0x39, 0x0e, 0xb9, 0xec, 0xed, 0x82, 0xc2, 0x1f, 0x79, 0x40, 0x9e,
+  0x3d, 0x11, 0x4c, 0x72, 0xe8, 0x60, 0x41, 0x74, 0x89, 0xf6, 0x13, 0x0a, 0x3e, 0xac, 0x10, 0xaa,
+  0x6d, 0x71, 0xfb, 0x82, 0xf4, 0xc3, 0x37, 0x97, 0x99, 0x20, 0x54, 0x3e, 0x37, 0xf0, 0xf9, 0x13,
+  0x9c, 0xb0, 0x07, 0xbc, 0xfe, 0x0b, 0x9e, 0x57, 0xe7, 0x14, 0x20, 0xe3, 0xac, 0x4f, 0x5c, 0x0c,
+  0x12, 0x27, 0xd4, 0x41, 0x84, 0x2e, 0x37, 0x56, 0x30, 0x85, 0xbb, 0x24, 0x4b, 0x72, 0x5a, 0xc3,
+  0x86, 0x07, 0xba, 0x1b, 0xf9, 0x07, 0xc3, 0x20, 0xf4, 0x6d, 0xe8, 0x01, 0x50, 0x66, 0x02, 0x52,
+  0x59, 0x1f, 0x1c, 0xc5, 0x0a, 0xc7, 0x50, 0x4c, 0x0e, 0xe0, 0x39, 0x88, 0x7c, 0x7b, 0x82, 0xec,
+  0x2a, 0xfc, 0x02, 0x97, 0x06, 0xa0, 0xc4, 0x84, 0x80, 0x02, 0x6a, 0x8e, 0x19, 0x38, 0x30, 0x9e,
+  0x4c, 0x03, 0xb7, 0xc9, 0xfd, 0xdb, 0x1a, 0xf6, 0x04, 0xd0, 0xd9, 0x85, 0x98, 0x60, 0xb3, 0xc6,
+  0x8c, 0xf4, 0x3d, 0xd0, 0x02, 0x62, 0xd3, 0x24, 0x71, 0x84, 0x2a, 0x55, 0x49, 0x5e, 0x42, 0x83,
+  0xf5, 0x4b, 0x98, 0xd2, 0x2c, 0xc5, 0x27, 0x58, 0xa1, 0x11, 0x89, 0x02, 0x8a, 0x16, 0xc4, 0xa7,
+  0x11, 0xc7, 0xa3, 0x49, 0xc3, 0x50, 0xd2, 0xdb, 0x46, 0xbd, 0x92, 0xd7, 0x6a, 0x8b, 0xe7, 0xfb,
+  0x47, 0x13, 0xc0, 0x79, 0x82, 0xf5, 0x18, 0xa0, 0x38, 0xb6, 0xd5, 0x1f, 0xa2, 0x9f, 0x66, 0xad,
+  0x95, 0x66, 0x04, 0x97, 0x70, 0x80, 0x23, 0x56, 0x01, 0xc2, 0xd4, 0x62, 0xe7, 0x8e, 0x9c, 0x3e,
+  0xa1, 0xbf, 0x09, 0x06, 0x98, 0x28, 0x90, 0x7b, 0xc7, 0x3f, 0xfe, 0xf6, 0xf7, 0xd6, 0xb2, 0x29,
+  0x76, 0x01, 0xd6, 0x5d, 0x9f, 0x61, 0xfb, 0xb0, 0x54, 0xdd, 0xbf, 0xa5, 0x51, 0x3f, 0xf6, 0xe9,
+  0xeb, 0x57, 0xc7, 0x07, 0xf1, 0x68, 0x1c, 0x47, 0xa8, 0xc0, 0x81, 0x0f, 0x63, 0xf3, 0x49, 0xb3,
+  0x8f, 0x55, 0x04, 0xd6, 0xcd, 0xbc, 0x3b, 0xb1, 0xbb, 0x8a, 0x4e, 0x21, 0x46, 0xa0, 0x7a, 0xe7,
+  0x33, 0xa9, 0xd2, 0x0b, 0x2e, 0x56, 0x70, 0xbc, 0xd3, 0x30, 0xbf, 0xca, 0xb8, 0xf2, 0xe0, 0x7c,
+  0x12, 0x0c, 0xea, 0xa9, 0xa4, 0x8a, 0x21, 0x9c, 0x6f, 0xe3, 0xb8, 0x98, 0x0a, 0xcb, 0x9a, 0x2a,
+  0x00, 0x4a, 0x52, 0x48, 0x88, 0xad, 0x1a, 0x80, 0x46, 0x77, 0x55, 0xab, 0x2e, 0x10, 0x16, 0xa3,
+  0x22, 0xcf, 0x35, 0xe5, 0xa5, 0x9a, 0x33, 0xcb, 0x71, 0x99, 0xaf, 0x80, 0xc5, 0x35, 0xa4, 0xdb,
+  0xb0, 0x96, 0x97, 0x9e, 0xe1, 0x78, 0xda, 0x6c, 0x65, 0xb4, 0xf4, 0xb2, 0x2e, 0x0b, 0x67, 0x6a,
+  0x51, 0x78, 0xa5, 0x33, 0xb0, 0x68, 0x65, 0x29, 0x2a, 0xd5, 0xa4, 0x31, 0x4f, 0xc1, 0x25, 0x48,
+  0xcb, 0x16, 0x90, 0xe3, 0x3b, 0x64, 0x25, 0xb0, 0xc2, 0x92, 0x30, 0x84, 0xe2, 0x49, 0x7c, 0x79,
+  0x69, 0xb1, 0x15, 0x72, 0x2e, 0x1e, 0xa3, 0x56, 0x0d, 0x98, 0x8e, 0xa3, 0x3e, 0x8c, 0xe9, 0x15,
+  0xfa, 0x26, 0x62, 0x48, 0xe4, 0x00, 0xf0, 0x96, 0xfb, 0x48, 0x18, 0xed, 0xa2, 0x8d, 0x76, 0xb3,
+  0x21, 0x8d, 0x6c, 0x7d, 0x38, 0x9d, 0xd5, 0x71, 0x01, 0x61, 0xab, 0x23, 0x63, 0x8d, 0x3f, 0x16,
+  0x9b, 0xb6, 0x49, 0xc8, 0x50, 0xf1, 0xd8, 0x10, 0x50, 0x51, 0x43, 0xd7, 0x86, 0x14, 0x3d, 0x13,
+  0x70, 0x80, 0xbc, 0x04, 0x20, 0x70, 0xdb, 0xe2, 0xa6, 0x79, 0x2f, 0xcd, 0x92, 0x20, 0x1a, 0xd8,
+  0xeb, 0x80, 0x45, 0xb3, 0x01, 0x6c, 0x73, 0x72, 0x9f, 0x81, 0x06, 0x03, 0x00, 0x7d, 0xd9, 0x6c,
+  0x57, 0x2e, 0x48, 0x79, 0x3b, 0x67, 0xd1, 0x08, 0x97, 0xdb, 0x16, 0x9a, 0x51, 0xda, 0x8b, 0x5b,
+  0x0d, 0x08, 0x6b, 0x5a, 0x07, 0x03, 0x42, 0xf8, 0xd5, 0x20, 0x40, 0xc3, 0x7a, 0x1a, 0xfa, 0xab,
+  0x52, 0x60, 0x38, 0x3e, 0x45, 0x71, 0xda, 0x52, 0x2e, 0xf4, 0xc6, 0x55, 0x10, 0x27, 0x5e, 0xb6,
+  0x32, 0x04, 0x59, 0xf2, 0x55, 0x03, 0x45, 0x24, 0x54, 0x56, 0x82, 0x22, 0x2b, 0xab, 0xb4, 0xd9,
+  0x6a, 0x16, 0x31, 0x2d, 0x9c, 0xba, 0x66, 0xd3, 0x2a, 0x29, 0xca, 0xf6, 0x2d, 0x25, 0xe4, 0xac,
+  0x64, 0xf4, 0x4a, 0xd5, 0x48, 0x2b, 0x81, 0xe0, 0x4d, 0x0b, 0x18, 0x46, 0xf5, 0xcf, 0x22, 0x08,
+  0x46, 0xc3, 0x4a, 0x7f, 0xac, 0xac, 0x59, 0xa1, 0xb7, 0x56, 0x80, 0x53, 0x01, 0x81, 0x15, 0x29,
+  0x2b, 0x80, 0xc0, 0x66, 0xb5, 0x7d, 0x0f, 0x83, 0x64, 0xc5, 0xee, 0xd0, 0xb2, 0x02, 0x41, 0x14,
+  0xa1, 0xac, 0x00, 0x41, 0xb4, 0x2c, 0x20, 0xa8, 0x92, 0x90, 0x45, 0x9d, 0x55, 0xa3, 0x9a, 0x7e,
+  0xbc, 0x0a, 0x63, 0xa5, 0xde, 0xbc, 0x69, 0x19, 0x06, 0xab, 0xe5, 0x58, 0xde, 0x9f, 0x35, 0xab,
+  0xed, 0xbb, 0x2a, 0x05, 0x5a, 0x63, 0x6d, 0x32, 0xd0, 0xec, 0xa4, 0xac, 0xcb, 0xf6, 0x28, 0x1d,
+  0x68, 0xd1, 0x8c, 0xa9, 0xc1, 0x4e, 0x49, 0xf7, 0x4b, 0xab, 0x18, 0x74, 0x95, 0x81, 0xab, 0x32,
+  0xa5, 0x4f, 0x8f, 0x7f, 0x75, 0x74, 0xf8, 0xfe, 0xfc, 0xf8, 0xf9, 0xd1, 0xaf, 0x5f, 0x9c, 0x1e,
+  0xa1, 0x63, 0x71, 0x94, 0x27, 0xf1, 0x98, 0xb6, 0x55, 0x69, 0xaa, 0x8a, 0x2f, 0x69, 0xda, 0xf7,
+  0xc6, 0xf4, 0x1b, 0x3c, 0x5c, 0x02, 0x74, 0xa4, 0x8c, 0x0a, 0x3b, 0xe5, 0x10, 0x1d, 0x37, 0xa1,
+  0xac, 0xc4, 0xd1, 0x6e, 0x3f, 0x68, 0x43, 0xec, 0x69, 0x3d, 0xf0, 0x46, 0xe3, 0x1d, 0xfd, 0xf1,
+  0x2e, 0x7f, 0x1c, 0x66, 0xc6, 0xd3, 0x3d, 0xfe, 0x74, 0x80, 0x4f, 0x77, 0x1a, 0x21, 0x55, 0x6a,
+  0x73, 0x8c, 0xf9, 0x21, 0x58, 0x25, 0x30, 0xcf, 0x07, 0xcb, 0xbe, 0x26, 0x12, 0x51, 0xaf, 0x83,
+  0xa2, 0x00, 0xb7, 0x70, 0x8d, 0xb0, 0xf8, 0x7c, 0x8d, 0xf8, 0x52, 0xd2, 0x40, 0x4c, 0x21, 0x1f,
+  0x6c, 0xc2, 0xdd, 0x92, 0x8c, 0x8f, 0x91, 0x78, 0xae, 0x49, 0xdd, 0xd1, 0xc7, 0xab, 0x24, 0x31,
+  0x06, 0x7b, 0xa7, 0xdc, 0x83, 0x8f, 0x93, 0x53, 0x1d, 0xe7, 0x52, 0x6f, 0x4e, 0x12, 0x3a, 0x7c,
+  0x34, 0x4c, 0xa9, 0x81, 0x19, 0x34, 0xce, 0x29, 0xf4, 0x74, 0x19, 0x56, 0xa5, 0x9f, 0x4e, 0x59,
+  0xb7, 0xe7, 0x61, 0x2c, 0x06, 0xb8, 0x0f, 0x71, 0x7f, 0xc2, 0x65, 0xc6, 0xf5, 0x07, 0x96, 0x10,
+  0x4c, 0x4e, 0x68, 0x82, 0x52, 0x42, 0xb5, 0xad, 0x08, 0xe6, 0x11, 0x0c, 0x48, 0x0b, 0xfe, 0x88,
+  0x86, 0x30, 0x2c, 0xda, 0x7b, 0x2e, 0xc5, 0x4a, 0x0b, 0x13, 0xdb, 0x1b, 0x3e, 0x84, 0x73, 0xb0,
+  0x21, 0x5b, 0x9a, 0xd5, 0x72, 0x74, 0x4b, 0x57, 0x76, 0x72, 0x5b, 0xd6, 0x8e, 0xde, 0x1e, 0x6d,
+  0x8c, 0xa3, 0x9b, 0xa6, 0x15, 0xda, 0x83, 0x4d, 0x72, 0x4a, 0xd6, 0x6c, 0x49, 0x2f, 0x61, 0x87,
+  0x9c, 0x92, 0x05, 0x5b, 0xd2, 0x4b, 0xce, 0x40, 0xe3, 0x67, 0x79, 0x02, 0x0a, 0x69, 0xe0, 0x94,
+  0x59, 0x54, 0xeb, 0x89, 0x53, 0x4e, 0x1b, 0x36, 0xdb, 0x14, 0xb4, 0x26, 0xe2, 0xc2, 0x0d, 0xcf,
+  0xe2, 0x31, 0x0b, 0x33, 0x70, 0x8c, 0x61, 0x44, 0xf1, 0xb4, 0xd0, 0xfb, 0x34, 0xa4, 0x10, 0x93,
+  0x6c, 0x63, 0xd8, 0x99, 0x64, 0x94, 0x8c, 0xe2, 0x7c, 0x0a, 0x51, 0xe6, 0x1a, 0x04, 0x92, 0xd1,
+  0xa0, 0x78, 0x79, 0x82, 0x81, 0xa1, 0x7c, 0xa9, 0xf9, 0x58, 0x71, 0x96, 0xc5, 0xa3, 0x32, 0xcc,
+  0x54, 0x41, 0xeb, 0x25, 0x31, 0xbd, 0x92, 0xc0, 0xc6, 0x18, 0x8f, 0x2a, 0x58, 0xfc, 0x55, 0x01,
+  0x8a, 0x07, 0x43, 0x9c, 0x19, 0x95, 0x92, 0x03, 0x82, 0xd7, 0x04, 0x12, 0xc3, 0x51, 0x84, 0xe7,
+  0xe8, 0x8e, 0x63, 0x0a, 0x41, 0xb2, 0xf4, 0x16, 0xbe, 0xbd, 0x43, 0xa1, 0xc1, 0x27, 0x93, 0x5d,
+  0xcb, 0x32, 0xa9, 0x14, 0x1d, 0x74, 0x92, 0xdf, 0xf2, 0x1f, 0xac, 0x1b, 0xff, 0xaa, 0x7a, 0x8a,
+  0xbc, 0xd7, 0xc5, 0xfd, 0x5b, 0x81, 0x6b, 0x46, 0x1e, 0x40, 0xc8, 0x56, 0x80, 0x62, 0x41, 0x5a,
+  0x1d, 0xf1, 0xca, 0x9a, 0xdb, 0x63, 0xef, 0x06, 0xc3, 0x71, 0x3d, 0xaf, 0xa4, 0x1e, 0x55, 0x12,
+  0x8a, 0x23, 0xb6, 0xfc, 0x9d, 0xb2, 0x0d, 0x28, 0x37, 0x48, 0x9f, 0xe2, 0xe1, 0x39, 0x2a, 0x41,
+  0x80, 0x8a, 0x8c, 0xc6, 0xef, 0xb1, 0x3e, 0xdd, 0x8b, 0x1c, 0x9e, 0x85, 0xab, 0x79, 0xe3, 0x66,
+  0xf1, 0xd3, 0xe0, 0x9a, 0xfa, 0xe0, 0x28, 0xcf, 0xfe, 0xf8, 0x9f, 0x07, 0x2c, 0x2f, 0x51, 0x48,
+  0x61, 0x14, 0x44, 0x4b, 0x11, 0x04, 0xf5, 0xd0, 0x83, 0x25, 0xa0, 0x13, 0x6f, 0x21, 0x6c, 0x7c,
+  0xfd, 0x7e, 0x9c, 0xc4, 0x3d, 0xaf, 0x17, 0x84, 0x41, 0x76, 0x23, 0x70, 0x3c, 0x07, 0xed, 0x74,
+  0x59, 0xd8, 0x36, 0xbf, 0xe5, 0xec, 0xaf, 0x4b, 0xa8, 0x86, 0x71, 0x9e, 0xa0, 0xaa, 0xc9, 0x1e,
+  0xfc, 0xb7, 0x41, 0x33, 0x7b, 0x34, 0xcb, 0x2f, 0x8c, 0xbc, 0x27, 0x56, 0x1c, 0x60, 0xbf, 0xb7,
+  0x17, 0xe7, 0x28, 0x2d, 0x18, 0x4a, 0xf8, 0x3b, 0xbb, 0x58, 0x23, 0xf8, 0x1b, 0xa8, 0x87, 0xdf,
+  0x41, 0xc4, 0x7e, 0xbf, 0xa2, 0x78, 0x04, 0xe5, 0xfe, 0x2d, 0xd2, 0x32, 0xbb, 0x78, 0xc7, 0xe7,
+  0x2f, 0x83, 0xe9, 0x70, 0x28, 0xee, 0x38, 0x4f, 0x87, 0xe2, 0x89, 0x52, 0x14, 0xfe, 0x46, 0x24,
+  0x4e, 0xff, 0xf8, 0xdf, 0x2c, 0x77, 0xaa, 0xd4, 0x23, 0xa1, 0x98, 0xc7, 0x2e, 0xaf, 0x49, 0x8b,
+  0xd4, 0x43, 0xb7, 0xb7, 0xbc, 0x35, 0x33, 0xa6, 0x56, 0x91, 0x92, 0x2d, 0x82, 0xf8, 0x50, 0xcc,
+  0x96, 0xca, 0x0c, 0x2a, 0x06, 0x17, 0xa7, 0x91, 0xfc, 0x21, 0xa6, 0x93, 0xa4, 0x4d, 0x2d, 0x89,
+  0x55, 0x1d, 0x56, 0x0a, 0xbc, 0x53, 0xa1, 0xc6, 0x58, 0x4f, 0x75, 0x56, 0xb1, 0xbd, 0x62, 0x54,
+  0xe4, 0x13, 0x78, 0x97, 0x5b, 0xb6, 0x9b, 0xac, 0x7c, 0x94, 0x4b, 0x0f, 0x97, 0xbb, 0x19, 0x5a,
+  0x8d, 0x99, 0x10, 0xc1, 0xb2, 0xbc, 0x8f, 0x37, 0x0e, 0xda, 0x7c, 0x69, 0xdb, 0x47, 0x90, 0xf5,
+  0x59, 0x1f, 0x7c, 0xc3, 0xf3, 0x3e, 0x82, 0x3f, 0xb4, 0x9a, 0xf3, 0x72, 0x38, 0x22, 0x2d, 0x84,
+  0xb3, 0xfe, 0x1e, 0x36, 0x64, 0x29, 0x22, 0x49, 0x02, 0x7a, 0x42, 0x5d, 0xde, 0xff, 0xc1, 0x03,
+  0xf6, 0xe9, 0x4a, 0xdb, 0xbc, 0x6f, 0xfe, 0x04, 0x45, 0x7b, 0x46, 0xd5, 0x69, 0x49, 0xcf, 0x9f,
+  0x04, 0x00, 0xd6, 0xda, 0xa9, 0x1f, 0x43, 0x4d, 0x0a, 0xfb, 0x0c, 0xc7, 0x76, 0x79, 0x58, 0x75,
+  0x75, 0x11, 0x3d, 0x11, 0x9d, 0x53, 0xcd, 0x0a, 0x2d, 0x47, 0x60, 0x3d, 0x66, 0xd4, 0xc0, 0xba,
+  0x31, 0xf4, 0x42, 0xaa, 0x32, 0x41, 0xae, 0x25, 0xd1, 0xce, 0xca, 0x6a, 0xaa, 0x2d, 0xcc, 0x55,
+  0x0d, 0xc5, 0xed, 0xdc, 0xf8, 0x92, 0xe8, 0xe6, 0x41, 0x44, 0x14, 0xdc, 0x81, 0xe2, 0x1b, 0xe8,
+  0x16, 0x0a, 0xcc, 0x58, 0xbe, 0x6f, 0x1b, 0xf3, 0x17, 0xf0, 0x92, 0xb9, 0x11, 0xf0, 0x74, 0x8b,
+  0x43, 0xd0, 0xe4, 0x28, 0x17, 0xa9, 0xe2, 0x1b, 0x2c, 0x02, 0xce, 0x4c, 0xc7, 0xac, 0x8e, 0x76,
+  0x3c, 0x17, 0x9c, 0x8e, 0x29, 0x9a, 0xdd, 0x7a, 0xca, 0xb9, 0x23, 0xa1, 0x80, 0xd7, 0xb8, 0x12,
+  0x1a, 0xe5, 0x0a, 0x9a, 0x41, 0xf7, 0xd5, 0xa8, 0x3d, 0xac, 0x25, 0x7c, 0x39, 0xec, 0xc5, 0x84,
+  0xfb, 0x41, 0x22, 0x36, 0x66, 0x17, 0x10, 0xcf, 0xbc, 0x1a, 0x03, 0x47, 0xd5, 0xaf, 0xa9, 0xb7,
+  0xc3, 0x06, 0x0a, 0xb4, 0xf8, 0x73, 0x99, 0x58, 0x05, 0x87, 0xc6, 0x8a, 0x1a, 0xe8, 0x60, 0x44,
+  0x35, 0x6a, 0x95, 0x37, 0xa5, 0x20, 0xd5, 0xfb, 0x53, 0x7a, 0xf7, 0x3a, 0x8a, 0x56, 0x85, 0xa3,
+  0x51, 0x54, 0xf2, 0xcc, 0x6e, 0x0d, 0x32, 0xe5, 0x04, 0x07, 0x4a, 0xcb, 0x8f, 0xee, 0xa1, 0xdc,
+  0x5f, 0xfc, 0xd2, 0xd2, 0x70, 0xd5, 0xba, 0x73, 0xa5, 0x7e, 0x9a, 0xa3, 0xbf, 0xa8, 0x97, 0xf5,
+  0x46, 0x3a, 0x7c, 0xbd, 0xe0, 0xc3, 0x80, 0x4e, 0x69, 0x22, 0xb3, 0xb7, 0xa6, 0xa9, 0x2d, 0x26,
+  0xab, 0xb0, 0xb5, 0x25, 0x2b, 0x8b, 0x3b, 0x2c, 0xa6, 0x91, 0x65, 0x66, 0xaf, 0xc4, 0xb4, 0x34,
+  0x3d, 0x2c, 0xb5, 0xa9, 0xba, 0x2f, 0x76, 0x53, 0x0b, 0x0a, 0x85, 0x69, 0x59, 0x25, 0x77, 0x6f,
+  0x31, 0x1b, 0x2e, 0xc0, 0x5a, 0x9f, 0x66, 0xa3, 0x75, 0x0f, 0xd7, 0xb0, 0xc6, 0xe8, 0xc2, 0x95,
+  0x89, 0x53, 0x19, 0xf0, 0x1a, 0x43, 0xab, 0x03, 0x81, 0xd7, 0x9c, 0x8a, 0x97, 0x49, 0x0c, 0x5d,
+  0xa8, 0xeb, 0x85, 0xa1, 0xfd, 0xb6, 0x51, 0xac, 0x6a, 0x32, 0xfa, 0xd1, 0xe5, 0xbc, 0x2d, 0x17,
+  0x33, 0x67, 0xcd, 0x68, 0x29, 0xe3, 0xa0, 0xfa, 0xb6, 0x8d, 0x77, 0x35, 0x06, 0xdd, 0xe0, 0x6a,
+  0x21, 0x17, 0x9a, 0x22, 0xb0, 0xbd, 0x6f, 0xd1, 0xe9, 0x65, 0x1c, 0x86, 0x01, 0xdb, 0x69, 0xb6,
+  0xab, 0xa1, 0x94, 0x8c, 0x97, 0x1d, 0x1e, 0x82, 0xc9, 0x9f, 0x95, 0xd7, 0x3b, 0x8d, 0x6a, 0x80,
+  0x0d, 0x4b, 0x8d, 0x6a, 0xcf, 0x41, 0x6b, 0xfa, 0x67, 0xcf, 0x11, 0x07, 0xd9, 0x22, 0x7f, 0x43,
+  0x1e, 0x75, 0xe0, 0xcf, 0x7a, 0xa7, 0xd3, 0xa9, 0xba, 0x44, 0x27, 0x95, 0x1c, 0x1a, 0x26, 0x2b,
+  0x74, 0x4d, 0x2d, 0xa5, 0xce, 0x4c, 0x5d, 0xc5, 0xb7, 0x38, 0xdc, 0xec, 0x8b, 0x1b, 0x8a, 0x7c,
+  0x23, 0xce, 0x56, 0xfe, 0x40, 0xa6, 0x0e, 0x1d, 0xbe, 0x33, 0x66, 0x40, 0x2a, 0xab, 0x33, 0x5b,
+  0xc0, 0x43, 0x75, 0x94, 0x71, 0x40, 0xd3, 0x10, 0x94, 0x29, 0x52, 0x61, 0x96, 0x16, 0x4c, 0x95,
+  0x1d, 0x30, 0xe5, 0x5b, 0x0a, 0x67, 0x11, 0x71, 0x63, 0xad, 0x2a, 0x62, 0xd5, 0x3c, 0xc6, 0x0b,
+  0x59, 0x35, 0x09, 0x7e, 0x8b, 0xca, 0x92, 0x14, 0x8d, 0x67, 0xaa, 0x8e, 0x92, 0xa5, 0xb1, 0x8d,
+  0x9e, 0x27, 0x5e, 0x86, 0x1b, 0x46, 0xa5, 0x6e, 0x92, 0x61, 0xee, 0xee, 0x18, 0xed, 0xe3, 0xa8,
+  0xae, 0xbd, 0x92, 0x07, 0xeb, 0x50, 0x16, 0x88, 0xbe, 0x7b, 0xac, 0xbb, 0xb3, 0xbb, 0xbd, 0x64,
+  0xcf, 0x32, 0x7d, 0xbc, 0xf8, 0x2a, 0x1f, 0xab, 0xb4, 0xea, 0x0d, 0xdf, 0x97, 0x91, 0x16, 0xe8,
+  0xfb, 0x9c, 0x26, 0x37, 0x15, 0x77, 0xaf, 0x6a, 0x88, 0x38, 0xac, 0x88, 0xf7, 0xe5, 0xbd, 0x64,
+  0x9a, 0x28, 0x4b, 0x82, 0x91, 0x9a, 0xfe, 0x5c, 0x92, 0xc2, 0xcd, 0xe6, 0x69, 0x1e, 0x6e, 0x64,
+  0xca, 0xd6, 0xaa, 0x92, 0x09, 0xb3, 0xad, 0x5f, 0x43, 0x8c, 0x89, 0xdb, 0xa7, 0x9e, 0x97, 0x18,
+  0x07, 0xce, 0x5d, 0xd7, 0xd5, 0x8a, 0x0c, 0x68, 0xfc, 0x3a, 0x41, 0x15, 0xbf, 0x90, 0x77, 0x8c,
+  0x44, 0x30, 0xf7, 0xa1, 0x5d, 0x30, 0x72, 0xe3, 0x31, 0x85, 0x26, 0x09, 0xa5, 0xd9, 0xc8, 0x1b,
+  0xbb, 0x71, 0x32, 0x68, 0xa7, 0xa0, 0x0b, 0xfd, 0xe1, 0xfe, 0xf7, 0xf5, 0xde, 0x27, 0x1f, 0xc9,
+  0x07, 0xdc, 0x97, 0xee, 0xa2, 0x19, 0x7b, 0x10, 0x06, 0xa3, 0x20, 0xeb, 0xae, 0x5f, 0x68, 0xe8,
+  0x5e, 0x55, 0x0c, 0x23, 0xa7, 0x01, 0xa5, 0xc6, 0x6f, 0x90, 0x80, 0x49, 0x74, 0x0b, 0xbe, 0x1b,
+  0x2b, 0x6e, 0xb6, 0xc0, 0x53, 0xf3, 0xc6, 0xe3, 0x30, 0xe0, 0xbc, 0xb5, 0x11, 0xaa, 0x05, 0xb2,
+  0x94, 0x9b, 0xe2, 0xf7, 0x38, 0xc4, 0xfa, 0xed, 0xcd, 0x53, 0xc9, 0x0a, 0x51, 0x1b, 0x9d, 0xa2,
+  0x79, 0x69, 0xaf, 0x13, 0x9e, 0x1e, 0xea, 0x66, 0x58, 0xb4, 0x32, 0x2c, 0xf1, 0xe3, 0x24, 0xf1,
+  0x40, 0x4f, 0x52, 0xf6, 0x69, 0x8b, 0x1e, 0x0e, 0x8e, 0x9a, 0xf8, 0xee, 0x82, 0x91, 0x1a, 0x64,
+  0x43, 0xe6, 0x94, 0x74, 0x9c, 0xd5, 0xc6, 0xc8, 0x98, 0x78, 0x03, 0x3a, 0x89, 0xc1, 0x30, 0xa8,
+  0x2b, 0x00, 0x7e, 0x03, 0xcb, 0x7b, 0x34, 0x89, 0x21, 0xaa, 0xd4, 0x8a, 0x51, 0xb8, 0x12, 0x14,
+  0xe1, 0x4f, 0xf6, 0x2d, 0xb3, 0x50, 0x22, 0xfc, 0x1c, 0xe3, 0xd5, 0x35, 0x4f, 0xc1, 0x38, 0x65,
+  0x92, 0xc2, 0xb7, 0x9d, 0x77, 0x38, 0x57, 0xb4, 0xcc, 0x7d, 0xb4, 0x4a, 0x0f, 0xf0, 0x7c, 0x38,
+  0xdf, 0x2a, 0xae, 0x3d, 0xf5, 0x4e, 0x6d, 0x8e, 0x8e, 0x31, 0x6d, 0x3e, 0x67, 0x40, 0x9d, 0x15,
+  0x99, 0xc6, 0x3d, 0x7e, 0x70, 0xda, 0x68, 0x12, 0x80, 0x82, 0x9a, 0x77, 0x21, 0xb0, 0xbd, 0xfe,
+  0x1e, 0x1d, 0xa3, 0xc1, 0x5f, 0xc8, 0x35, 0x4b, 0x02, 0x22, 0x31, 0xca, 0xe5, 0xdc, 0xd2, 0x59,
+  0xc4, 0xd7, 0x8c, 0xa6, 0x9a, 0xd7, 0xb0, 0xa4, 0xc6, 0xe1, 0x84, 0xfa, 0x62, 0xe6, 0x6a, 0x5c,
+  0xb3, 0xf9, 0x08, 0xbc, 0xe1, 0xe7, 0x8e, 0x91, 0x3d, 0x96, 0x5b, 0x3f, 0x4e, 0x65, 0x33, 0x48,
+  0xd5, 0x86, 0x00, 0x39, 0xa5, 0x3e, 0x62, 0xa3, 0xc7, 0xa9, 0x6c, 0xfd, 0x14, 0x7d, 0xe2, 0xc8,
+  0xec, 0xa3, 0x76, 0xa9, 0x9c, 0xea, 0xc6, 0x95, 0xea, 0xa5, 0x33, 0xb0, 0xb3, 0x8a, 0xc0, 0x35,
+  0x41, 0xde, 0x22, 0x9d, 0x6b, 0x88, 0x78, 0x8d, 0xb1, 0xb9, 0x6d, 0x8a, 0x63, 0x56, 0xbf, 0xf9,
+  0xbe, 0x04, 0xbe, 0x3c, 0x04, 0xcf, 0x6d, 0xa3, 0x0a, 0xb3, 0x08, 0xae, 0x30, 0x49, 0x1c, 0xc2,
+  0x42, 0x8e, 0x17, 0x5a, 0xc0, 0xca, 0x4c, 0x51, 0x9b, 0xe1, 0x2b, 0x5e, 0x28, 0x51, 0x37, 0xbc,
+  0x86, 0x7b, 0x27, 0xb1, 0x54, 0xf6, 0xe6, 0x57, 0x71, 0xb3, 0xa4, 0xf4, 0x3e, 0xad, 0x02, 0x09,
+  0x97, 0xd8, 0x79, 0xae, 0xd9, 0x47, 0x0d, 0x99, 0x5c, 0xe8, 0xe4, 0xee, 0xc2, 0xc7, 0xea, 0x96,
+  0xbe, 0xc2, 0xd7, 0x81, 0x58, 0x45, 0xd5, 0xb4, 0x35, 0x50, 0xc2, 0xa8, 0x75, 0x44, 0x98, 0x17,
+  0xa2, 0xe0, 0xa3, 0x43, 0x51, 0x76, 0x30, 0xcc, 0xf5, 0x14, 0xc6, 0x82, 0x4b, 0x68, 0xb9, 0x4f,
+  0xa4, 0x05, 0x00, 0x65, 0xbf, 0x62, 0x56, 0x17, 0xdf, 0xd7, 0x59, 0x0e, 0x69, 0x2d, 0xb5, 0xb2,
+  0x20, 0x67, 0x1e, 0x27, 0xa8, 0x57, 0x4e, 0xc9, 0x87, 0x31, 0x6d, 0x6e, 0x0f, 0xdc, 0x84, 0x61,
+  0x70, 0xd5, 0x83, 0x45, 0xd2, 0x55, 0x9e, 0xe5, 0x9c, 0xe1, 0x55, 0x09, 0xd8, 0x24, 0x18, 0x0c,
+  0x10, 0x19, 0xd3, 0xf6, 0xfa, 0xca, 0x11, 0xbe, 0xa4, 0x77, 0xe7, 0xa9, 0x84, 0xb9, 0xca, 0xb3,
+  0xc6, 0x85, 0x77, 0x27, 0xa5, 0x59, 0x75, 0x34, 0xea, 0xfc, 0x8b, 0x6d, 0xe1, 0x5e, 0x70, 0x27,
+  0xa5, 0x8a, 0xaf, 0x5a, 0xe9, 0xd4, 0x0b, 0xf3, 0x04, 0x3c, 0x73, 0x83, 0x0d, 0x67, 0xb5, 0xae,
+  0xaa, 0x48, 0xaa, 0xdc, 0x99, 0xc7, 0x93, 0xa5, 0x1d, 0x67, 0x36, 0x8a, 0xe6, 0xa3, 0x3a, 0x98,
+  0x58, 0x7a, 0x31, 0xa7, 0xee, 0x4a, 0x78, 0x48, 0xd5, 0x4d, 0xfc, 0xfd, 0x25, 0x92, 0x15, 0xf9,
+  0x4f, 0xcd, 0x89, 0xaa, 0x55, 0xa8, 0x6f, 0xf3, 0x90, 0x80, 0x79, 0xc2, 0xbd, 0xbb, 0xca, 0x8d,
+  0x3d, 0x81, 0xbe, 0x02, 0x21, 0x87, 0x21, 0x55, 0x4b, 0x4f, 0xb9, 0x22, 0x60, 0x7f, 0xce, 0xdc,
+  0x35, 0xa9, 0x61, 0x00, 0xc4, 0xe2, 0x54, 0x2a, 0x06, 0xd8, 0x9f, 0x33, 0x73, 0xab, 0x00, 0x7c,
+  0x7e, 0x9a, 0x47, 0xac, 0x5e, 0xc5, 0x52, 0x75, 0x0f, 0x49, 0xc3, 0x38, 0x11, 0xd7, 0x6e, 0x25,
+  0xc0, 0x50, 0x29, 0xe9, 0x7c, 0xa5, 0x42, 0x18, 0x73, 0x75, 0x4a, 0x84, 0x1a, 0x6c, 0x98, 0x95,
+  0x86, 0x4a, 0x29, 0xe0, 0x53, 0x97, 0x2d, 0x7c, 0x92, 0x2d, 0xfe, 0x04, 0x97, 0x35, 0x93, 0x4e,
+  0xf1, 0x86, 0x93, 0x3b, 0x33, 0x4b, 0xcc, 0xd0, 0x18, 0xbf, 0x7e, 0x75, 0x72, 0xc6, 0x9c, 0xcb,
+  0x97, 0x5e, 0xe2, 0x8d, 0x52, 0xfb, 0xb6, 0xc1, 0x57, 0x27, 0x0d, 0xca, 0x5a, 0x43, 0xda, 0xa0,
+  0x6d, 0xb6, 0x88, 0x35, 0x94, 0x09, 0xda, 0x46, 0xa9, 0xb2, 0xda, 0x2e, 0xbe, 0x34, 0x2c, 0x58,
+  0xa2, 0x44, 0xad, 0x9d, 0xe1, 0x03, 0x2f, 0x5d, 0x43, 0x40, 0x38, 0x0d, 0x7e, 0xa2, 0x0f, 0x86,
+  0x01, 0x8f, 0xf4, 0x59, 0x6b, 0x0d, 0xdd, 0x55, 0x15, 0x91, 0x54, 0xeb, 0xfc, 0x66, 0x4c, 0xcb,
+  0x0e, 0xeb, 0x75, 0x6b, 0x3a, 0x9d, 0xb6, 0xd8, 0x41, 0xa3, 0x3c, 0x09, 0xb9, 0xd7, 0xec, 0x83,
+  0x07, 0xbb, 0xd6, 0x40, 0xee, 0xb7, 0x99, 0x0c, 0xc0, 0x49, 0x39, 0xe3, 0x55, 0x3e, 0x8e, 0xaa,
+  0xf6, 0x54, 0x0b, 0x96, 0x99, 0x91, 0xad, 0x16, 0x99, 0x95, 0x17, 0x34, 0xb1, 0x87, 0x5d, 0xbf,
+  0xb0, 0xb1, 0x99, 0x5a, 0x5d, 0xcf, 0x0a, 0xfb, 0x2d, 0xe5, 0x66, 0xf3, 0xbc, 0xf7, 0x7c, 0x31,
+  0x16, 0x31, 0x62, 0x7d, 0x6a, 0xb6, 0xdc, 0xb3, 0x54, 0x8d, 0xb7, 0xcd, 0x28, 0x83, 0xe6, 0xae,
+  0xb6, 0x75, 0x27, 0xca, 0xf3, 0x50, 0xcb, 0x8b, 0x6a, 0x9e, 0xf3, 0x60, 0xc4, 0x72, 0x3c, 0xe6,
+  0x26, 0x77, 0xe4, 0x3f, 0xd1, 0xea, 0x85, 0x7a, 0x71, 0x1e, 0xf5, 0xd9, 0x1e, 0x92, 0xcd, 0x22,
+  0x7c, 0x15, 0x42, 0x97, 0xc0, 0x88, 0xd8, 0x1f, 0xbf, 0xc7, 0x79, 0x56, 0x79, 0xbb, 0xd3, 0xa8,
+  0xa2, 0x05, 0x56, 0x64, 0x73, 0xb3, 0x36, 0x8c, 0x95, 0x61, 0x15, 0x44, 0xec, 0xb3, 0x23, 0x17,
+  0x10, 0x18, 0x01, 0x01, 0x2c, 0xc2, 0x9c, 0xc7, 0xc1, 0x6c, 0x8d, 0x6c, 0xc8, 0x74, 0x40, 0xb9,
+  0xf4, 0x6a, 0x7e, 0x75, 0xd8, 0xa4, 0x52, 0x1b, 0xa6, 0x7c, 0x94, 0x5e, 0xb8, 0x5a, 0x59, 0x14,
+  0x3f, 0x44, 0x26, 0x1d, 0x22, 0xe8, 0xe6, 0x60, 0xdf, 0x52, 0x2a, 0x60, 0xb2, 0x53, 0x92, 0x9b,
+  0x58, 0xfb, 0x4a, 0x0f, 0x8a, 0x8a, 0x68, 0x54, 0x93, 0xda, 0xc1, 0x60, 0x15, 0xd0, 0xb3, 0x39,
+  0xe0, 0x6e, 0x1b, 0x65, 0x80, 0x0b, 0xd6, 0x1a, 0x29, 0x77, 0xd4, 0x8b, 0x09, 0x8f, 0xcf, 0x53,
+  0x30, 0xf9, 0x99, 0x5d, 0x4b, 0xd4, 0x1a, 0x59, 0xef, 0x08, 0x1e, 0x79, 0x70, 0x32, 0x81, 0xb8,
+  0x04, 0xbb, 0x75, 0x76, 0xd8, 0x07, 0xcb, 0xf8, 0x8e, 0xbc, 0x6b, 0xbb, 0xb3, 0x26, 0xbe, 0x43,
+  0x9c, 0xbf, 0xb1, 0xb5, 0xb5, 0x46, 0x26, 0x8e, 0x31, 0x6c, 0x15, 0x46, 0x2b, 0xa3, 0xa5, 0xbd,
+  0xfb, 0x89, 0xc6, 0x62, 0xa1, 0x6c, 0xd5, 0xb2, 0x6b, 0x94, 0xce, 0x99, 0xc2, 0x85, 0x07, 0x0b,
+  0x96, 0xdc, 0x15, 0x24, 0x6b, 0xb0, 0x8a, 0x6e, 0x63, 0xc7, 0x62, 0x12, 0x26, 0x2d, 0xf8, 0xbb,
+  0xd3, 0x28, 0x4b, 0x74, 0xe2, 0x2c, 0x96, 0xd3, 0xc7, 0x2a, 0xd7, 0x5f, 0x88, 0x5c, 0x8f, 0xa3,
+  0x7e, 0x59, 0x69, 0x7f, 0x2a, 0xb9, 0x7e, 0x55, 0x92, 0x6b, 0xa1, 0x9d, 0xff, 0x4f, 0x24, 0x3b,
+  0x17, 0x59, 0x71, 0x75, 0x47, 0x6d, 0x49, 0x2e, 0xe2, 0x05, 0xa2, 0xf1, 0x08, 0xbc, 0x6d, 0x89,
+  0x3b, 0x39, 0xaa, 0x17, 0xc0, 0xee, 0x5b, 0x30, 0xdd, 0xe5, 0x2a, 0x2e, 0x20, 0x5a, 0x4b, 0x2a,
+  0x74, 0xf5, 0x3b, 0x3c, 0x56, 0x42, 0x2d, 0x2e, 0xe8, 0x28, 0xe3, 0xa2, 0xd9, 0x14, 0x80, 0x2c,
+  0xc3, 0x56, 0xbe, 0xc0, 0xa3, 0x06, 0xa3, 0x56, 0x6b, 0x5e, 0x34, 0x2d, 0x1c, 0x16, 0x76, 0x62,
+  0x79, 0x49, 0xf1, 0xa7, 0x79, 0x49, 0x43, 0xd1, 0x57, 0x2f, 0x5c, 0x3e, 0x5a, 0x38, 0xf6, 0x7a,
+  0x4b, 0xad, 0x68, 0x11, 0x3c, 0x85, 0xa7, 0x71, 0xf2, 0xb7, 0x71, 0xaf, 0x88, 0x7c, 0x02, 0x1f,
+  0x02, 0x02, 0xbe, 0x48, 0x3e, 0x47, 0x57, 0x6a, 0xb3, 0x83, 0x09, 0x6f, 0x7d, 0xf9, 0xf2, 0xc1,
+  0x5b, 0xc2, 0xba, 0x75, 0x78, 0x79, 0x08, 0x40, 0xdd, 0x28, 0x9e, 0xda, 0xa8, 0xea, 0xaa, 0xd7,
+  0x4e, 0x63, 0x3a, 0x0c, 0x42, 0x4a, 0x6c, 0xed, 0xf5, 0xae, 0xea, 0x56, 0xc4, 0x98, 0xe8, 0xe7,
+  0x88, 0xed, 0x09, 0x3b, 0x41, 0x0c, 0xda, 0xfa, 0x9c, 0xac, 0x91, 0xaf, 0x01, 0x6f, 0xe1, 0xd7,
+  0xd5, 0x6e, 0xa2, 0x7f, 0x88, 0x7b, 0x29, 0x3f, 0x36, 0x11, 0xf8, 0xda, 0x11, 0x09, 0xe6, 0x6b,
+  0xf5, 0x12, 0xea, 0x5d, 0xc9, 0xee, 0x1f, 0x38, 0x8b, 0xdc, 0x59, 0x32, 0x42, 0x7f, 0x78, 0xc3,
+  0x1c, 0x2a, 0xb1, 0xef, 0xeb, 0xc7, 0x11, 0xb5, 0x70, 0x0e, 0x97, 0x9e, 0x5f, 0x7a, 0xc0, 0x91,
+  0x6f, 0xa9, 0xfc, 0x2d, 0xbc, 0xe6, 0x1b, 0x2f, 0x7a, 0xce, 0x83, 0x43, 0x94, 0x23, 0xca, 0xdc,
+  0x3d, 0xf1, 0x7d, 0xe5, 0x50, 0xc9, 0x1c, 0xd2, 0x72, 0x6e, 0x9f, 0xdd, 0xaa, 0x81, 0xbb, 0x22,
+  0xc5, 0xc5, 0x1a, 0x29, 0xba, 0xbf, 0xa5, 0xed, 0xaa, 0x8a, 0x07, 0xcc, 0xc8, 0x80, 0x91, 0xe6,
+  0x3a, 0x64, 0x99, 0x82, 0x5a, 0x86, 0x94, 0x77, 0xe2, 0x8a, 0x4a, 0x84, 0x1c, 0xaa, 0x7b, 0x07,
+  0xb7, 0x4c, 0xc6, 0xb3, 0x1a, 0x29, 0x2b, 0xc7, 0x3c, 0x0f, 0x33, 0xf5, 0xba, 0x50, 0x3d, 0x1c,
+  0x01, 0xb0, 0x96, 0x1b, 0x1d, 0xbe, 0xb1, 0xb2, 0x90, 0x16, 0x01, 0x64, 0x5f, 0x7c, 0xd1, 0xeb,
+  0x16, 0x0c, 0x2a, 0xd3, 0x2c, 0x08, 0x43, 0x92, 0xe4, 0x11, 0xb8, 0x60, 0x83, 0x1d, 0xd0, 0x2b,
+  0x4a, 0xb2, 0x21, 0xe6, 0xb4, 0x06, 0x96, 0xee, 0xe0, 0x2e, 0xe7, 0x5d, 0x1c, 0x79, 0x08, 0xd4,
+  0xc9, 0x4c, 0x80, 0xc7, 0x05, 0x5e, 0xf1, 0x25, 0x65, 0x84, 0xe1, 0x26, 0x14, 0x9d, 0x6f, 0xdb,
+  0x59, 0x63, 0x7b, 0x45, 0x9d, 0x92, 0x33, 0x0c, 0x34, 0x9c, 0x02, 0x0e, 0x30, 0x04, 0x25, 0x3f,
+  0xf8, 0xe4, 0xc5, 0xb3, 0xf7, 0xdf, 0x1e, 0x1f, 0xbd, 0x79, 0xff, 0xfc, 0xf1, 0xaf, 0xde, 0x9f,
+  0x1c, 0x9f, 0x1e, 0x9d, 0x41, 0x83, 0xad, 0x4e, 0x47, 0x86, 0x9a, 0x83, 0x13, 0x80, 0xca, 0x77,
+  0xc4, 0x58, 0x0a, 0x46, 0x3d, 0xc7, 0x9d, 0xb2, 0x3a, 0xc7, 0x9a, 0xa6, 0x7d, 0x3c, 0x3e, 0xac,
+  0xaa, 0x57, 0xd3, 0xc6, 0x9c, 0xb2, 0xd5, 0x46, 0x7d, 0xdd, 0x6a, 0x63, 0x5e, 0xe1, 0xaa, 0x8c,
+  0x46, 0x07, 0x07, 0x78, 0x98, 0x85, 0xed, 0x75, 0x4d, 0xa4, 0xa3, 0x9e, 0x4e, 0x03, 0x26, 0x5b,
+  0xf6, 0x04, 0x14, 0x12, 0x4f, 0x97, 0x5a, 0xec, 0x48, 0xb1, 0xb5, 0xad, 0x6a, 0xc5, 0xd8, 0x09,
+  0x59, 0x3c, 0xbb, 0xf2, 0xb5, 0xba, 0x87, 0x5c, 0x1c, 0xaa, 0xc6, 0x4d, 0x2a, 0xd6, 0x05, 0x4f,
+  0x18, 0x43, 0x0f, 0xb3, 0x8b, 0xb8, 0xcd, 0x69, 0x7e, 0x2f, 0x76, 0xa0, 0xb8, 0x8c, 0x48, 0x1e,
+  0x0d, 0x56, 0xad, 0xf0, 0x68, 0xb2, 0xb5, 0xdd, 0xf0, 0xe9, 0xa5, 0x07, 0x4a, 0x04, 0x48, 0xf0,
+  0xbf, 0x6a, 0x97, 0xaf, 0x59, 0x97, 0x59, 0x75, 0xab, 0x6f, 0x70, 0xc2, 0xad, 0x9f, 0xcd, 0xcd,
+  0x99, 0x66, 0x1a, 0x47, 0x18, 0x1d, 0xc3, 0x43, 0xf0, 0xa0, 0x70, 0xe2, 0xb5, 0xbf, 0x7b, 0x6b,
+  0x33, 0x92, 0x7e, 0x40, 0x94, 0x3f, 0x20, 0x4f, 0x3f, 0x30, 0x59, 0x38, 0xdf, 0xbd, 0x6b, 0x17,
+  0x82, 0xc4, 0x60, 0x03, 0xeb, 0x25, 0xb1, 0x8c, 0xe6, 0xed, 0xfa, 0x3b, 0xd4, 0x66, 0x46, 0x62,
+  0x51, 0xbc, 0x67, 0xdc, 0x5c, 0x72, 0xff, 0x56, 0x8a, 0xde, 0x66, 0x5d, 0x9d, 0x59, 0x93, 0xef,
+  0xc4, 0x01, 0x65, 0x9c, 0xa4, 0xd9, 0x77, 0xf2, 0x1a, 0x8e, 0x8b, 0x9a, 0x9d, 0xca, 0xc1, 0x33,
+  0x0f, 0x93, 0x08, 0xb0, 0x08, 0xe6, 0xfc, 0x90, 0x70, 0xc3, 0x84, 0x5f, 0x48, 0x80, 0x5d, 0x78,
+  0xfd, 0xe3, 0x6f, 0x7f, 0x4f, 0xee, 0xdf, 0xb2, 0xc6, 0x33, 0xc2, 0xae, 0x74, 0x65, 0x2c, 0xa6,
+  0x64, 0x4a, 0x13, 0xca, 0xce, 0x4c, 0x4f, 0x93, 0x20, 0xc3, 0x84, 0x3f, 0xb4, 0xd4, 0x11, 0x8b,
+  0xf0, 0x6e, 0x18, 0x4f, 0x85, 0x1a, 0xe2, 0x2d, 0xe7, 0x6b, 0x72, 0x22, 0x19, 0x72, 0xa3, 0xe1,
+  0xe2, 0x53, 0x07, 0xe2, 0xf8, 0xb6, 0x32, 0x5c, 0xc0, 0xb4, 0xca, 0x5f, 0x88, 0x63, 0x93, 0xd9,
+  0x13, 0x5e, 0xf7, 0x88, 0xd1, 0x56, 0xe8, 0xa6, 0xfd, 0x04, 0x67, 0x45, 0x3c, 0xc6, 0xc0, 0x34,
+  0x74, 0xc1, 0xd6, 0x02, 0xb4, 0x6f, 0x28, 0xba, 0x32, 0x0e, 0xd9, 0xd3, 0xdb, 0xf0, 0x87, 0xe0,
+  0x01, 0x3f, 0x14, 0xc0, 0x15, 0x7d, 0xb7, 0x0d, 0x68, 0xa4, 0xef, 0x25, 0x22, 0xfd, 0x46, 0xb1,
+  0x06, 0x3e, 0x50, 0xed, 0x52, 0x9a, 0x64, 0x8f, 0xfd, 0x0f, 0x1e, 0x1e, 0xf6, 0xc7, 0x0e, 0xe0,
+  0x70, 0x51, 0x30, 0xd3, 0x14, 0xa4, 0x0e, 0x56, 0x9e, 0x35, 0x45, 0x6d, 0x12, 0x4b, 0x23, 0x12,
+  0x85, 0xe7, 0x42, 0x05, 0xa3, 0x07, 0x28, 0x5e, 0xb2, 0x57, 0x63, 0x04, 0x1c, 0xa4, 0x1f, 0x9c,
+  0x95, 0x54, 0xca, 0x84, 0x1d, 0x27, 0x85, 0xa9, 0x39, 0x02, 0xd1, 0xcb, 0x45, 0x4c, 0x72, 0x2f,
+  0x88, 0x29, 0xb8, 0xef, 0x92, 0x12, 0xa3, 0x35, 0x99, 0xf9, 0x41, 0xed, 0xc9, 0xe1, 0xc2, 0xe0,
+  0x28, 0x51, 0x13, 0xd2, 0x6e, 0x13, 0x8f, 0xa4, 0x30, 0x07, 0xc9, 0x18, 0x20, 0x92, 0x51, 0x8e,
+  0x69, 0xbd, 0x18, 0x77, 0x79, 0x88, 0x17, 0xa5, 0xa8, 0x10, 0x3e, 0x01, 0xbf, 0xa9, 0x4f, 0x1b,
+  0x86, 0xbd, 0xe2, 0xc7, 0x63, 0xf9, 0x12, 0xa5, 0x2d, 0x4c, 0xa8, 0xaf, 0x4e, 0xd9, 0x1e, 0xcf,
+  0xc8, 0x65, 0x10, 0x79, 0x61, 0x78, 0xc3, 0x76, 0xba, 0xab, 0x46, 0x4f, 0x23, 0x5f, 0x02, 0x59,
+  0xf9, 0xc0, 0x9f, 0x6e, 0x7b, 0xbb, 0xdc, 0x58, 0x62, 0x65, 0x19, 0x1e, 0xe7, 0xc7, 0x32, 0xb2,
+  0x0b, 0xfc, 0xb2, 0x9f, 0x06, 0xe0, 0x9f, 0x75, 0xd9, 0x24, 0x13, 0x8d, 0xab, 0x87, 0x2f, 0x4d,
+  0xdd, 0x8b, 0x78, 0x41, 0xae, 0x0a, 0x0c, 0xb0, 0x95, 0x48, 0x29, 0xa1, 0x2e, 0xdb, 0xd6, 0xaf,
+  0x5a, 0x40, 0x65, 0xeb, 0x94, 0x9d, 0xbb, 0x13, 0x21, 0xad, 0xe0, 0x00, 0xc7, 0x75, 0x85, 0xae,
+  0x4f, 0xb1, 0x5d, 0xa9, 0x6f, 0xc6, 0xb1, 0x16, 0x09, 0x21, 0xc6, 0xd3, 0x46, 0xe7, 0x21, 0xb2,
+  0x84, 0xec, 0xcc, 0x3b, 0xc3, 0x98, 0x78, 0xd3, 0x13, 0x36, 0x81, 0xbb, 0x0c, 0x86, 0x9b, 0x8e,
+  0xc3, 0x20, 0x03, 0x5b, 0x95, 0xec, 0x7f, 0x17, 0xb5, 0x1d, 0x79, 0x86, 0x3e, 0x64, 0x6b, 0x9a,
+  0xdc, 0x07, 0xdd, 0x23, 0x9d, 0xba, 0x3d, 0x44, 0xe4, 0xdc, 0x29, 0x8b, 0x43, 0x4c, 0x20, 0x96,
+  0x28, 0xac, 0xca, 0x1b, 0xb7, 0xe4, 0x90, 0xf2, 0x5d, 0xed, 0x2d, 0x5f, 0xca, 0x86, 0xfc, 0xac,
+  0x85, 0x24, 0x0f, 0x6c, 0xe8, 0xd8, 0x36, 0x4c, 0xae, 0x3c, 0xcf, 0xaf, 0xef, 0x03, 0x31, 0x4c,
+  0x0f, 0x1e, 0x14, 0xbd, 0x0a, 0x82, 0xf1, 0x31, 0x17, 0xf0, 0x9e, 0x86, 0x0b, 0x75, 0x4c, 0x62,
+  0xd2, 0x0c, 0xa2, 0xcd, 0x5b, 0xb6, 0x8c, 0x96, 0x5f, 0xc9, 0x29, 0xdf, 0x10, 0x56, 0xac, 0x64,
+  0xc2, 0x30, 0x55, 0xaa, 0xaf, 0xe6, 0xf0, 0x4d, 0xb3, 0xb7, 0x38, 0x45, 0x84, 0xe5, 0x33, 0xe7,
+  0x95, 0xb6, 0x60, 0x0b, 0xa9, 0x38, 0xe5, 0x75, 0x5c, 0x2f, 0x52, 0x11, 0xb3, 0x74, 0x0d, 0x9d,
+  0x01, 0xa3, 0xf4, 0x04, 0xf7, 0xf3, 0xbd, 0x51, 0x15, 0xc5, 0x3d, 0xac, 0x7a, 0x8b, 0xa7, 0x2e,
+  0x73, 0x38, 0xcf, 0xe2, 0x3c, 0xe9, 0xb3, 0xa8, 0xb4, 0x66, 0x34, 0x58, 0x61, 0x07, 0x27, 0xb3,
+  0xae, 0x1e, 0x24, 0xe5, 0x7d, 0x79, 0x56, 0x57, 0x83, 0x66, 0xb3, 0x99, 0xd2, 0xe6, 0xf8, 0xe7,
+  0x4d, 0x18, 0xde, 0x19, 0xc2, 0xa1, 0xe2, 0x54, 0x84, 0xca, 0x83, 0x49, 0x71, 0x1a, 0xc3, 0x6b,
+  0x53, 0x97, 0x55, 0x2e, 0xad, 0xf1, 0xa9, 0xae, 0x1d, 0x0c, 0xfa, 0x5e, 0x9f, 0x22, 0xd4, 0x85,
+  0x65, 0x2a, 0x63, 0xd4, 0x1c, 0xfb, 0x5a, 0x82, 0xe8, 0x9e, 0xa1, 0x99, 0xd0, 0xc9, 0x71, 0x4c,
+  0x67, 0x0b, 0xe1, 0x40, 0x40, 0xce, 0x04, 0x28, 0x88, 0xab, 0x7a, 0xe5, 0x10, 0x8c, 0xa4, 0x14,
+  0x0d, 0xb6, 0xa0, 0xb5, 0x42, 0x29, 0xea, 0x4a, 0x89, 0x50, 0x9d, 0x59, 0x8a, 0x79, 0xdb, 0xd2,
+  0x78, 0x88, 0x97, 0x20, 0x2c, 0xff, 0xe6, 0x4c, 0x85, 0x14, 0x9a, 0x3c, 0xdd, 0x83, 0x93, 0x17,
+  0x67, 0x47, 0x87, 0x0e, 0xd1, 0xc6, 0x62, 0xc6, 0xfe, 0xd7, 0xbd, 0x53, 0x9b, 0xe9, 0x1b, 0xd3,
+  0x05, 0x5b, 0x9c, 0x5c, 0x55, 0x1a, 0xa0, 0x0e, 0x94, 0x5a, 0xed, 0x81, 0x9e, 0xc9, 0x44, 0x2f,
+  0x8e, 0xb5, 0x04, 0x95, 0x1d, 0x23, 0x45, 0xf8, 0x29, 0xec, 0x81, 0x7c, 0xc5, 0xca, 0xa2, 0x0a,
+  0xb3, 0x99, 0xde, 0xed, 0x7c, 0x69, 0x70, 0xa7, 0x13, 0xa5, 0x77, 0x4c, 0x59, 0xe0, 0xd6, 0x75,
+  0x91, 0xff, 0xf0, 0xc4, 0xf1, 0xa1, 0xc0, 0x21, 0x41, 0xf5, 0xe9, 0xbc, 0xf4, 0x06, 0xbe, 0x9f,
+  0x29, 0x91, 0x6a, 0x99, 0xf2, 0x6a, 0x11, 0x9a, 0xad, 0x89, 0x57, 0xdc, 0x4c, 0x22, 0xcf, 0x0e,
+  0xb3, 0xb8, 0x35, 0x91, 0x12, 0x15, 0x02, 0x5d, 0xdd, 0xb5, 0x51, 0xd0, 0x38, 0xad, 0xe8, 0xd7,
+  0xd0, 0x9a, 0x44, 0xcc, 0x4c, 0x23, 0x20, 0x0f, 0x3e, 0x2f, 0x09, 0xea, 0xc2, 0xbc, 0x8f, 0x21,
+  0x62, 0x60, 0xdc, 0x5c, 0x50, 0x68, 0x19, 0x27, 0x85, 0x47, 0x7e, 0x4a, 0xbf, 0x56, 0xa7, 0xa5,
+  0x7c, 0xdb, 0xde, 0x62, 0x92, 0xb4, 0xcb, 0x6a, 0xe4, 0x35, 0x35, 0xb6, 0x75, 0x7c, 0xc8, 0x76,
+  0x23, 0xf0, 0x76, 0x0f, 0x96, 0xa5, 0x6a, 0xb8, 0xcc, 0xbb, 0xb0, 0x6d, 0xe7, 0x27, 0x22, 0xc3,
+  0x8a, 0xdc, 0x89, 0x9b, 0x61, 0x48, 0x58, 0x12, 0x10, 0x3b, 0xd6, 0x5d, 0x16, 0x8d, 0x39, 0xf5,
+  0xd8, 0x39, 0xf1, 0x82, 0xaa, 0xfe, 0xc2, 0xc3, 0xaf, 0xc6, 0xd9, 0x73, 0x91, 0x6a, 0x18, 0xe3,
+  0x22, 0x87, 0x50, 0xf8, 0x87, 0x5e, 0xb6, 0xf4, 0x88, 0xc5, 0x5f, 0x63, 0x35, 0x21, 0xac, 0xbf,
+  0x42, 0xb9, 0x40, 0x23, 0x19, 0x8f, 0x8a, 0x6c, 0x4e, 0x9e, 0xf0, 0xa9, 0xbc, 0xb1, 0x08, 0xb7,
+  0x79, 0x9d, 0x99, 0xa5, 0xf7, 0xe6, 0x33, 0x73, 0xe5, 0xce, 0xc5, 0x44, 0x16, 0x8e, 0x3b, 0xbb,
+  0xa0, 0xef, 0xa0, 0xb7, 0x1c, 0x82, 0xb8, 0xf0, 0x4f, 0xeb, 0xca, 0xef, 0x2a, 0x3c, 0xe8, 0x2d,
+  0xea, 0xaa, 0x5f, 0x68, 0x68, 0xd0, 0xbd, 0xf4, 0xe0, 0x76, 0xf5, 0xde, 0xbc, 0xa2, 0xbf, 0xbc,
+  0xc7, 0x6e, 0x79, 0x7f, 0xfd, 0xfc, 0xbb, 0xbc, 0xa0, 0x6e, 0x69, 0x2f, 0xe3, 0xd4, 0xbb, 0xb8,
+  0x84, 0x76, 0x09, 0x9b, 0xea, 0xa6, 0x5a, 0xcb, 0xd4, 0xc2, 0xc7, 0xda, 0x8b, 0x45, 0xaa, 0xc8,
+  0x67, 0x69, 0x81, 0xcc, 0x65, 0x99, 0x14, 0xb1, 0x0f, 0x27, 0x77, 0xae, 0xe5, 0x95, 0x17, 0xce,
+  0x0e, 0xa9, 0xcc, 0xac, 0xda, 0xae, 0xcc, 0xf3, 0x67, 0x7b, 0xcf, 0xc5, 0xdb, 0x15, 0x76, 0x87,
+  0x54, 0xce, 0x54, 0xa7, 0x5f, 0x5c, 0xdc, 0xc0, 0xae, 0xc4, 0xa8, 0xe2, 0xda, 0x67, 0x84, 0x61,
+  0xec, 0xcc, 0x6e, 0x76, 0x70, 0x2a, 0xd3, 0xf1, 0x31, 0x57, 0x84, 0xd5, 0xa4, 0x20, 0x35, 0xeb,
+  0x0e, 0x52, 0xa8, 0xe9, 0xca, 0x43, 0x17, 0x2e, 0x06, 0xf5, 0xfa, 0x23, 0xc5, 0xc0, 0xfb, 0x19,
+  0x32, 0xa8, 0x60, 0x5a, 0x2a, 0x83, 0x6f, 0x74, 0x95, 0x5e, 0x2c, 0x89, 0x94, 0xf6, 0xcf, 0xb2,
+  0xc4, 0x70, 0x0c, 0x98, 0xba, 0x2b, 0x3f, 0x8c, 0x37, 0xe0, 0xfb, 0x1c, 0x60, 0x79, 0x37, 0x3b,
+  0x3b, 0x8d, 0xc2, 0x96, 0x28, 0xab, 0x03, 0xad, 0xd8, 0x73, 0x3e, 0xed, 0x4b, 0xa6, 0x93, 0xbd,
+  0x44, 0x3b, 0x26, 0xa7, 0xa3, 0xa3, 0x26, 0xa6, 0x09, 0x40, 0x19, 0x09, 0x4d, 0xa8, 0x48, 0x0e,
+  0x44, 0xf2, 0x9b, 0x8f, 0x4c, 0xc4, 0x7e, 0x90, 0x7a, 0xbd, 0x90, 0xb5, 0xa8, 0xf4, 0x9a, 0x8b,
+  0x6c, 0x71, 0x27, 0x14, 0xa2, 0x86, 0xa1, 0x3a, 0x70, 0x6c, 0x9f, 0x57, 0x1b, 0xb7, 0x5a, 0x79,
+  0x95, 0x85, 0x23, 0x5c, 0xd7, 0x4f, 0x96, 0xcd, 0x52, 0xea, 0x2a, 0x6a, 0xf5, 0x31, 0xe4, 0x69,
+  0xfb, 0xe3, 0x86, 0xf2, 0xec, 0x8b, 0x7b, 0x4e, 0xc1, 0xef, 0x87, 0x6f, 0xcc, 0xe1, 0xff, 0xf3,
+  0x0f, 0x52, 0xf1, 0x78, 0x05, 0x29, 0xb0, 0xbc, 0x49, 0x19, 0x0e, 0xae, 0x99, 0xf5, 0x74, 0xf2,
+  0x1c, 0x46, 0x8d, 0x86, 0x4b, 0xde, 0x6a, 0x47, 0x91, 0xbd, 0x34, 0xf9, 0xb9, 0xad, 0xe5, 0x88,
+  0x1b, 0xca, 0xca, 0x08, 0x63, 0x7f, 0x32, 0xd3, 0x0d, 0x41, 0xfd, 0x28, 0x40, 0x3b, 0x4b, 0xaf,
+  0xc8, 0xab, 0xe7, 0x41, 0xa4, 0x50, 0x96, 0xcb, 0x57, 0x34, 0xac, 0xe3, 0x76, 0x11, 0xb3, 0x9d,
+  0xa5, 0x1a, 0x8b, 0x4d, 0x96, 0x33, 0xd3, 0xb1, 0x54, 0xd2, 0xbc, 0x24, 0xbb, 0x86, 0x82, 0xb8,
+  0x62, 0x8d, 0x41, 0x55, 0xcb, 0x17, 0x95, 0x17, 0x40, 0x6b, 0xc7, 0x11, 0x7d, 0x3a, 0x3b, 0xe2,
+  0x4b, 0x6d, 0x91, 0x01, 0x08, 0x7c, 0x8d, 0xb0, 0xe6, 0x3b, 0x8d, 0xfa, 0x79, 0x79, 0x27, 0x63,
+  0xf8, 0xe7, 0x98, 0x6e, 0x1f, 0x31, 0xc1, 0x40, 0x13, 0xf3, 0x88, 0x1f, 0xd7, 0x93, 0x14, 0x9e,
+  0x71, 0xc2, 0x98, 0xe8, 0x58, 0xb5, 0xd0, 0xaa, 0x22, 0xab, 0x15, 0xce, 0x2a, 0x06, 0xef, 0x2f,
+  0x4e, 0x80, 0x77, 0xb3, 0x57, 0xfc, 0x38, 0xb6, 0xf0, 0x11, 0x59, 0x56, 0x4a, 0x7c, 0x5f, 0xa1,
+  0x16, 0x61, 0x9e, 0xed, 0x22, 0x75, 0x3c, 0x09, 0xef, 0x63, 0x91, 0x49, 0x20, 0xab, 0x9a, 0x04,
+  0x32, 0x9b, 0x33, 0xab, 0xcc, 0xd1, 0x34, 0x6b, 0x4b, 0xb6, 0xd8, 0x6e, 0x59, 0x45, 0x5b, 0xf4,
+  0xea, 0x0c, 0xe9, 0xf5, 0x2a, 0x39, 0xac, 0x56, 0x93, 0xf1, 0x7f, 0x49, 0x0e, 0x5f, 0x2d, 0x93,
+  0x83, 0xda, 0x56, 0xe3, 0x97, 0xdd, 0x2e, 0xdd, 0x13, 0x61, 0xcd, 0x8c, 0xfd, 0x38, 0xed, 0x96,
+  0xdc, 0x55, 0xfa, 0x16, 0xe5, 0x00, 0xfa, 0xac, 0x3e, 0x11, 0x6f, 0x5f, 0x1f, 0xcb, 0x4d, 0x3c,
+  0xb9, 0x1d, 0x20, 0xc8, 0x72, 0x74, 0x1a, 0x8b, 0x9a, 0xf4, 0x89, 0xcc, 0xb7, 0x18, 0xd0, 0x9d,
+  0x12, 0x5d, 0xe5, 0x53, 0xbb, 0x07, 0x79, 0x92, 0xe0, 0xd7, 0x50, 0x5e, 0x74, 0x8c, 0xc7, 0xbd,
+  0x00, 0x16, 0xbb, 0x95, 0x42, 0x77, 0x5d, 0x4f, 0x14, 0xc3, 0x8b, 0xbc, 0x56, 0xe8, 0x29, 0x0a,
+  0x09, 0x4c, 0x36, 0xd8, 0x48, 0xb0, 0x4d, 0x35, 0xa7, 0xec, 0xb1, 0xcf, 0x9c, 0x9d, 0x2a, 0x87,
+  0x7c, 0xef, 0x41, 0xf2, 0xb8, 0xb2, 0x4f, 0xc5, 0xd0, 0x57, 0xc5, 0x63, 0xac, 0x79, 0x8a, 0x91,
+  0x9f, 0xb2, 0x12, 0xf5, 0x42, 0x56, 0x30, 0xd6, 0x1c, 0xed, 0xc2, 0x51, 0x9d, 0x5d, 0xb0, 0xd4,
+  0xc8, 0x7c, 0x41, 0x72, 0xbe, 0xaa, 0xea, 0x50, 0x92, 0x9e, 0x17, 0xd2, 0x24, 0xb3, 0xad, 0xa7,
+  0xac, 0x2a, 0x80, 0x64, 0x31, 0xe1, 0x82, 0x29, 0x86, 0x53, 0x45, 0x21, 0x33, 0xbc, 0xcd, 0x58,
+  0x5c, 0x5e, 0xbc, 0xdb, 0x46, 0x2a, 0xd9, 0x3f, 0x33, 0xcc, 0xfe, 0x0d, 0xef, 0xff, 0x05, 0xb1,
+  0xd9, 0x8c, 0x95, 0xd4, 0x7b, 0x00, 0x00,
+};
+
+// /forgot.html: 2198 bytes, 949 gzipped
+static const uint8_t ASSET_3[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x95, 0x51, 0x73, 0xdb, 0x36,
+  0x0c, 0xc7, 0xdf, 0xfd, 0x29, 0x50, 0xdd, 0xee, 0x24, 0xdf, 0x2c, 0xc9, 0x4e, 0x7b, 0x5d, 0x97,
+  0x44, 0xde, 0xda, 0xac, 0xb9, 0xcb, 0x4b, 0x9b, 0xeb, 0x92, 0xeb, 0xed, 0xad, 0xb4, 0x04, 0x5b,
+  0x5c, 0x24, 0x52, 0x23, 0x21, 0xcb, 0xba, 0x34, 0xdf, 0x7d, 0xa0, 0x28, 0xb9, 0x49, 0x9b, 0x3e,
+  0x49, 0x22, 0x09, 0xe0, 0xf7, 0x07, 0x01, 0xe8, 0xfc, 0xc5, 0x5f, 0x1f, 0x2f, 0x6e, 0xfe, 0xb9,
+  0x7e, 0x0f, 0x25, 0xd5, 0xd5, 0x7a, 0x76, 0xee, 0x1e, 0x50, 0x09, 0xb5, 0xcb, 0x02, 0x54, 0x81,
+  0x5b, 0x40, 0x51, 0xf0, 0xa3, 0x46, 0x12, 0x90, 0x97, 0xc2, 0x58, 0xa4, 0x2c, 0xb8, 0xbd, 0xb9,
+  0x8c, 0xdf, 0x04, 0x90, 0x4e, 0x1b, 0x4a, 0xd4, 0x98, 0x05, 0x7b, 0x89, 0x5d, 0xa3, 0x0d, 0x05,
+  0x90, 0x6b, 0x45, 0xa8, 0xf8, 0x60, 0x27, 0x0b, 0x2a, 0xb3, 0x02, 0xf7, 0x32, 0xc7, 0x78, 0xf8,
+  0x58, 0x80, 0x54, 0x92, 0xa4, 0xa8, 0x62, 0x9b, 0x8b, 0x0a, 0xb3, 0x55, 0xb2, 0xf4, 0x8e, 0x48,
+  0x52, 0x85, 0xeb, 0x4b, 0x6d, 0x76, 0x9a, 0xe0, 0x5a, 0x58, 0xdb, 0x69, 0x53, 0x9c, 0xa7, 0x7e,
+  0x79, 0x76, 0x5e, 0x49, 0x75, 0x07, 0xa5, 0xc1, 0x6d, 0x16, 0x94, 0x44, 0x8d, 0x3d, 0x4d, 0xd3,
+  0xbc, 0x50, 0xc9, 0xbf, 0xb6, 0xc0, 0x4a, 0xee, 0x4d, 0xa2, 0x90, 0x52, 0xd5, 0xd4, 0x29, 0x09,
+  0x59, 0x75, 0x52, 0x15, 0xb9, 0xb5, 0x7f, 0x9e, 0x24, 0x27, 0xc9, 0xea, 0xf7, 0xb4, 0x90, 0x96,
+  0x8e, 0xeb, 0x49, 0x2d, 0x55, 0xc2, 0x9b, 0x01, 0x18, 0xac, 0xb2, 0xc0, 0x52, 0x5f, 0xa1, 0x2d,
+  0x11, 0xc9, 0x89, 0x4d, 0x47, 0xb5, 0x1b, 0x5d, 0xf4, 0x90, 0x57, 0x0c, 0x91, 0x05, 0x9b, 0x5d,
+  0xbc, 0x33, 0xa2, 0x8f, 0x57, 0xcb, 0x25, 0x10, 0x1e, 0xc8, 0x7f, 0xbd, 0xe1, 0xaf, 0x2d, 0xab,
+  0x8c, 0xad, 0x50, 0xd6, 0x99, 0x16, 0x72, 0x3f, 0x59, 0xd4, 0xe2, 0x10, 0x77, 0x71, 0x5d, 0x40,
+  0x7d, 0x88, 0x45, 0x4b, 0x1a, 0x9a, 0xf8, 0xd5, 0x90, 0xca, 0xd5, 0x74, 0x62, 0xf0, 0x73, 0x72,
+  0xa8, 0xbc, 0x8b, 0x8d, 0xae, 0xf8, 0xec, 0xc6, 0x1d, 0xfa, 0x41, 0x7e, 0xb9, 0x62, 0xc3, 0xe6,
+  0x89, 0x9d, 0xad, 0x1f, 0x71, 0xfc, 0xc6, 0x1c, 0xde, 0x74, 0x36, 0x19, 0xb1, 0xb0, 0x5c, 0xef,
+  0xd1, 0xf4, 0x20, 0x2d, 0x28, 0xf6, 0x66, 0xdb, 0xc6, 0x5d, 0x0b, 0x16, 0x09, 0xdc, 0x94, 0x08,
+  0x5a, 0x55, 0x3d, 0x74, 0xa2, 0x07, 0x26, 0x33, 0xb8, 0x13, 0x52, 0x81, 0xc8, 0x73, 0xb4, 0xd6,
+  0x9d, 0x77, 0xb4, 0x68, 0xb6, 0xda, 0xd4, 0x20, 0x60, 0xdb, 0x56, 0x8c, 0x28, 0x72, 0xd2, 0xec,
+  0xcc, 0x20, 0x5f, 0x7d, 0xc2, 0x39, 0x6a, 0x9e, 0xaa, 0xe5, 0xfc, 0x74, 0xa5, 0x24, 0x74, 0x2a,
+  0xc1, 0xe8, 0x56, 0x15, 0x58, 0x0c, 0xda, 0x6c, 0x29, 0x0a, 0xdd, 0x05, 0x3f, 0xe5, 0x37, 0x7c,
+  0x6e, 0xc4, 0x7f, 0x19, 0xac, 0x3f, 0x0b, 0xa3, 0xa4, 0xda, 0x9d, 0x02, 0x95, 0x8c, 0x81, 0x46,
+  0x58, 0xb4, 0x20, 0x38, 0x3e, 0x47, 0x25, 0xde, 0xb0, 0x10, 0x7d, 0x96, 0x97, 0x72, 0xc1, 0xb5,
+  0x55, 0x69, 0xb3, 0x80, 0x8d, 0x91, 0xbb, 0x92, 0x14, 0x63, 0x2f, 0xe0, 0xf6, 0x0a, 0x9a, 0x51,
+  0xfc, 0x02, 0x90, 0xf2, 0x64, 0x0e, 0x42, 0xb9, 0x3c, 0x58, 0x12, 0x86, 0x58, 0x14, 0xab, 0xf6,
+  0x35, 0x98, 0x78, 0xfc, 0x4d, 0x4b, 0xa4, 0x15, 0xc8, 0x22, 0x0b, 0x06, 0x59, 0xef, 0x48, 0x05,
+  0x13, 0x63, 0xd3, 0xc7, 0x27, 0xd0, 0x1c, 0xe2, 0x97, 0x93, 0x18, 0x60, 0x85, 0x8e, 0xf5, 0xf5,
+  0x54, 0x00, 0x5e, 0x6e, 0xe9, 0x72, 0x7c, 0x3a, 0xee, 0xb1, 0x8e, 0x60, 0x7d, 0x3d, 0x26, 0xee,
+  0x49, 0xc6, 0xce, 0x53, 0x1f, 0x6c, 0x48, 0x83, 0x0b, 0xc8, 0x4c, 0xd4, 0xda, 0xe0, 0x49, 0x4a,
+  0x0e, 0xf6, 0xd1, 0x95, 0xba, 0x38, 0x35, 0x97, 0x47, 0xb0, 0xf6, 0xb0, 0x5c, 0xbf, 0xfb, 0x6f,
+  0x0f, 0x9b, 0x1b, 0xd9, 0xd0, 0x7a, 0x56, 0xe8, 0xbc, 0xad, 0xb9, 0xc7, 0x92, 0x1d, 0xd2, 0xfb,
+  0x0a, 0xdd, 0xeb, 0xbb, 0xfe, 0xaa, 0x88, 0xc2, 0x49, 0x50, 0x38, 0x4f, 0xb4, 0xca, 0x2b, 0x99,
+  0xdf, 0x41, 0x06, 0xc2, 0xf6, 0x2a, 0x87, 0x68, 0x0e, 0xd9, 0x1a, 0xee, 0x67, 0x72, 0x0b, 0xd1,
+  0x0b, 0xee, 0xd1, 0xad, 0x34, 0x75, 0x14, 0xbe, 0x35, 0x08, 0xbd, 0x6e, 0xb9, 0x4c, 0xc6, 0x97,
+  0x4e, 0x28, 0xfa, 0xae, 0x10, 0x1e, 0x2b, 0xfa, 0x23, 0x9c, 0xcf, 0xf9, 0x8d, 0x5a, 0xa3, 0xce,
+  0x66, 0xec, 0xc5, 0x72, 0x85, 0x71, 0x88, 0x9f, 0x02, 0x79, 0xc1, 0xe1, 0xfc, 0x6c, 0x46, 0xec,
+  0xe2, 0x7e, 0x34, 0x21, 0x7d, 0xf7, 0x09, 0x9d, 0x9d, 0xe8, 0x84, 0x24, 0xd8, 0xf2, 0xb5, 0x95,
+  0x51, 0x98, 0x8e, 0x91, 0x78, 0x17, 0x95, 0x33, 0x19, 0x50, 0xfd, 0xd9, 0x44, 0xdf, 0xcd, 0xe1,
+  0x1e, 0x6c, 0xe2, 0x52, 0x75, 0xe1, 0x27, 0x0c, 0xdb, 0x87, 0x17, 0xba, 0xe5, 0xfe, 0x71, 0x85,
+  0xce, 0x91, 0x3d, 0x22, 0x78, 0xfb, 0xb3, 0x09, 0x13, 0x1e, 0xbe, 0x45, 0x45, 0x75, 0x0c, 0x3a,
+  0xfa, 0x75, 0xfe, 0xa2, 0xf9, 0xa4, 0xc5, 0x7c, 0xc7, 0xf4, 0x65, 0x62, 0xf2, 0xe2, 0x07, 0x0f,
+  0xd9, 0x2f, 0xf7, 0xa8, 0x72, 0x5d, 0xe0, 0xed, 0xa7, 0xab, 0x0b, 0x5d, 0x37, 0x5a, 0x31, 0x4b,
+  0x34, 0x6c, 0xcd, 0x1f, 0xbe, 0x2c, 0x98, 0x92, 0xc7, 0x62, 0xa9, 0x8b, 0x53, 0x08, 0xaf, 0x3f,
+  0xfe, 0x7d, 0x13, 0xc2, 0xc3, 0x28, 0xc5, 0x78, 0x11, 0xb3, 0x1f, 0x44, 0x5c, 0x3e, 0xce, 0x30,
+  0x0c, 0x75, 0x3b, 0xf5, 0xab, 0xaf, 0x5c, 0xe8, 0x24, 0x37, 0xc3, 0x58, 0xd2, 0xdc, 0x5b, 0xdc,
+  0xd0, 0x55, 0x9f, 0x24, 0x49, 0x78, 0x36, 0x63, 0x8b, 0x1b, 0x59, 0xa3, 0x6e, 0x29, 0xf2, 0x37,
+  0x5c, 0xe9, 0x5c, 0x90, 0xd4, 0x2a, 0x71, 0xf3, 0xd2, 0x79, 0x4f, 0xc3, 0x05, 0xf0, 0xfc, 0x5a,
+  0x2e, 0x19, 0xe3, 0x01, 0xb0, 0xb2, 0x08, 0x9e, 0xc6, 0xdf, 0x0d, 0x64, 0x59, 0x06, 0xaf, 0x96,
+  0xab, 0x67, 0xc9, 0xde, 0x16, 0xb5, 0x9b, 0x10, 0x2d, 0x37, 0x91, 0x22, 0xe9, 0x1d, 0x33, 0xc7,
+  0x7f, 0xad, 0xe4, 0xc2, 0xf7, 0x33, 0x84, 0x01, 0xc2, 0xa3, 0xe3, 0xe3, 0x05, 0x1f, 0xf3, 0x68,
+  0x8e, 0x19, 0x7e, 0x46, 0xb6, 0xac, 0xbc, 0x17, 0xaf, 0xeb, 0x49, 0xa1, 0x71, 0xf6, 0xe0, 0x57,
+  0x88, 0x08, 0xbe, 0x7e, 0x85, 0x09, 0xd5, 0x09, 0xe0, 0x48, 0x8c, 0x91, 0x97, 0x10, 0xe1, 0xb3,
+  0xc4, 0x1f, 0x90, 0x78, 0x14, 0xdc, 0xf1, 0x10, 0x31, 0xda, 0x84, 0x83, 0xc1, 0x19, 0xf7, 0xcf,
+  0xd4, 0x39, 0xdc, 0x91, 0x3c, 0xde, 0x87, 0x69, 0x3f, 0xfc, 0xf3, 0xfe, 0x07, 0x96, 0xab, 0x05,
+  0x57, 0x04, 0x07, 0x00, 0x00,
+};
+
+// /login.html: 1045 bytes, 529 gzipped
+static const uint8_t ASSET_4[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x53, 0x4d, 0x6b, 0xdc, 0x30,
+  0x10, 0xbd, 0xe7, 0x57, 0x4c, 0x75, 0x8e, 0xec, 0xb5, 0x93, 0xa6, 0xe9, 0x62, 0x2f, 0x85, 0xb4,
+  0x81, 0x42, 0x21, 0x81, 0x6c, 0x29, 0x3d, 0xca, 0xd6, 0xd8, 0x56, 0x2b, 0x4b, 0x46, 0x92, 0xbf,
+  0xfe, 0x7d, 0xe5, 0xaf, 0xcd, 0x2e, 0x7b, 0xea, 0x49, 0x8c, 0x66, 0xf4, 0xde, 0xbc, 0x37, 0xa3,
+  0xe4, 0xc3, 0xd7, 0x97, 0xa7, 0xe3, 0xef, 0xd7, 0x6f, 0x50, 0xb9, 0x5a, 0x1e, 0x6e, 0x92, 0xe9,
+  0x00, 0xc9, 0x54, 0x99, 0x12, 0x54, 0x64, 0xba, 0x40, 0xc6, 0xfd, 0x51, 0xa3, 0x63, 0x90, 0x57,
+  0xcc, 0x58, 0x74, 0x29, 0xf9, 0x79, 0x7c, 0xa6, 0x8f, 0x04, 0xc2, 0x2d, 0xa1, 0x58, 0x8d, 0x29,
+  0xe9, 0x04, 0xf6, 0x8d, 0x36, 0x8e, 0x40, 0xae, 0x95, 0x43, 0xe5, 0x0b, 0x7b, 0xc1, 0x5d, 0x95,
+  0x72, 0xec, 0x44, 0x8e, 0x74, 0x0e, 0x6e, 0x41, 0x28, 0xe1, 0x04, 0x93, 0xd4, 0xe6, 0x4c, 0x62,
+  0x1a, 0x05, 0xbb, 0x05, 0xc8, 0x09, 0x27, 0xf1, 0xf0, 0xc4, 0x14, 0x7c, 0x87, 0x5f, 0xc8, 0x0c,
+  0xbc, 0x55, 0x1e, 0xcb, 0xc2, 0x0f, 0x5d, 0x0a, 0x95, 0x84, 0x4b, 0xfa, 0x26, 0x91, 0x42, 0xfd,
+  0x85, 0xca, 0x60, 0x91, 0x92, 0xca, 0xb9, 0xc6, 0xee, 0xc3, 0x30, 0xe7, 0x2a, 0xf8, 0x63, 0x39,
+  0x4a, 0xd1, 0x99, 0x40, 0xa1, 0x0b, 0x55, 0x53, 0x87, 0x8e, 0x09, 0xd9, 0x0b, 0xc5, 0x73, 0x6b,
+  0xbf, 0xc4, 0x41, 0x1c, 0x44, 0x9f, 0x43, 0x2e, 0xac, 0x3b, 0xdd, 0x07, 0xb5, 0x50, 0x81, 0x4f,
+  0x12, 0x30, 0x28, 0x53, 0x62, 0xdd, 0x28, 0xd1, 0x56, 0x88, 0x6e, 0x12, 0x1d, 0xae, 0xaa, 0x33,
+  0xcd, 0x47, 0xc8, 0x25, 0xb3, 0x36, 0x25, 0x59, 0x49, 0x4b, 0xc3, 0x46, 0x1a, 0xed, 0x76, 0xe0,
+  0x70, 0x70, 0x4b, 0xf4, 0xe8, 0xa3, 0xc2, 0xab, 0xa5, 0x96, 0x29, 0x3b, 0x3d, 0xe5, 0xa2, 0xdb,
+  0x5e, 0xd4, 0x6c, 0xa0, 0x3d, 0xad, 0x39, 0xd4, 0x03, 0x65, 0xad, 0xd3, 0xd0, 0xd0, 0x87, 0xd9,
+  0xd2, 0x68, 0xab, 0x98, 0x71, 0xe2, 0x41, 0x2e, 0x10, 0x99, 0x96, 0xbe, 0x36, 0xa3, 0xf7, 0xe4,
+  0xda, 0x06, 0xdf, 0x52, 0x74, 0x89, 0xee, 0xfb, 0xe9, 0x2b, 0xe1, 0xd0, 0xa3, 0xde, 0x83, 0xd1,
+  0xad, 0xe2, 0xc8, 0x67, 0x2c, 0x5b, 0x31, 0xae, 0x7b, 0xb0, 0x0d, 0xf3, 0x9e, 0x8f, 0xf4, 0x6e,
+  0xa2, 0x6c, 0x2e, 0x18, 0x6d, 0x7d, 0xa6, 0xe0, 0x61, 0xb7, 0x23, 0x07, 0x6f, 0xb2, 0x9f, 0x0b,
+  0xf8, 0x1e, 0x75, 0x83, 0xfe, 0xac, 0x10, 0x38, 0xb3, 0x55, 0xa6, 0x99, 0xe1, 0xb7, 0xa0, 0x8d,
+  0x1f, 0xbd, 0xd6, 0x16, 0xe1, 0x59, 0x9b, 0x52, 0x3b, 0x78, 0xf5, 0x58, 0xbd, 0x36, 0x3c, 0x48,
+  0xc2, 0xe6, 0xb2, 0xab, 0x42, 0xe2, 0x00, 0x25, 0x6b, 0x68, 0x3c, 0xd1, 0xb2, 0x75, 0x52, 0xe1,
+  0x09, 0x2c, 0x98, 0x16, 0x8c, 0x9c, 0x57, 0xd3, 0x08, 0x9a, 0x91, 0xc6, 0x4b, 0x47, 0xb9, 0xdf,
+  0x1a, 0x34, 0x9b, 0x1c, 0xf0, 0x1a, 0x33, 0xd9, 0xe2, 0xd4, 0xe3, 0x92, 0x5f, 0x14, 0x57, 0xba,
+  0x43, 0xb3, 0xdf, 0x92, 0x9f, 0xde, 0x05, 0x24, 0x21, 0x3b, 0x67, 0x2d, 0xe6, 0x6e, 0xff, 0x9b,
+  0x72, 0xb6, 0x25, 0xbe, 0x1a, 0xf3, 0x89, 0x75, 0xbe, 0xb9, 0x9b, 0x58, 0x57, 0x3b, 0x9a, 0xd5,
+  0x8e, 0x85, 0xde, 0xef, 0x59, 0x77, 0x65, 0xf9, 0x60, 0xcf, 0xd0, 0x3e, 0x4e, 0x6f, 0x8f, 0xa2,
+  0xd9, 0xc3, 0x8b, 0x82, 0x42, 0x18, 0xeb, 0xa0, 0xf5, 0xe6, 0x8e, 0xba, 0x85, 0xba, 0xf5, 0x81,
+  0xff, 0x67, 0xaa, 0xc4, 0x65, 0x0a, 0x58, 0xb0, 0x56, 0xbe, 0x53, 0xac, 0x8e, 0xaf, 0x1c, 0xdb,
+  0x31, 0xed, 0xe9, 0xbc, 0xb6, 0xf3, 0x27, 0xfe, 0x07, 0xbb, 0xaa, 0x87, 0x4f, 0xd5, 0x03, 0x00,
+  0x00,
+};
+
+// /mqtt.html: 12159 bytes, 2874 gzipped
+static const uint8_t ASSET_5[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5a, 0xeb, 0x52, 0x1b, 0xc9,
+  0x15, 0xfe, 0xef, 0xa7, 0x68, 0x4f, 0xb6, 0x4a, 0xa2, 0x16, 0x8d, 0x10, 0x17, 0x87, 0x05, 0x49,
+  0xce, 0x1a, 0xe3, 0xd8, 0x89, 0x2f, 0x04, 0x70, 0xa5, 0xf2, 0xcb, 0x6e, 0xcd, 0x34, 0xd2, 0xc0,
+  0xdc, 0x76, 0xba, 0x85, 0x50, 0x58, 0xaa, 0xf2, 0x0e, 0x79, 0x80, 0x54, 0xf2, 0x68, 0x79, 0x82,
+  0x3c, 0x42, 0xbe, 0xd3, 0xdd, 0x73, 0x93, 0x46, 0x16, 0xb0, 0x8e, 0xb7, 0x2a, 0x55, 0x46, 0x62,
+  0xba, 0x4f, 0x9f, 0x39, 0x97, 0xaf, 0xcf, 0xcd, 0xf4, 0x9f, 0xbe, 0xfc, 0x70, 0x74, 0xfe, 0x97,
+  0x93, 0x63, 0x36, 0x51, 0x51, 0x38, 0x7c, 0xd2, 0xa7, 0x2f, 0x16, 0xf2, 0x78, 0x3c, 0x70, 0x44,
+  0xec, 0xd0, 0x82, 0xe0, 0x3e, 0xbe, 0x22, 0xa1, 0x38, 0xf3, 0x26, 0x3c, 0x93, 0x42, 0x0d, 0x9c,
+  0x8f, 0xe7, 0xaf, 0x3a, 0xfb, 0x0e, 0xeb, 0xe6, 0x1b, 0x31, 0x8f, 0xc4, 0xc0, 0xb9, 0x0e, 0xc4,
+  0x2c, 0x4d, 0x32, 0xe5, 0x30, 0x2f, 0x89, 0x95, 0x88, 0x41, 0x38, 0x0b, 0x7c, 0x35, 0x19, 0xf8,
+  0xe2, 0x3a, 0xf0, 0x44, 0x47, 0x3f, 0x6c, 0xb2, 0x20, 0x0e, 0x54, 0xc0, 0xc3, 0x8e, 0xf4, 0x78,
+  0x28, 0x06, 0x3d, 0x77, 0xcb, 0x30, 0x52, 0x81, 0x0a, 0xc5, 0xf0, 0xdd, 0x9f, 0xce, 0xcf, 0x3b,
+  0x41, 0x2c, 0x95, 0x08, 0xc3, 0x20, 0x1e, 0x8b, 0xb8, 0xdf, 0x35, 0x1b, 0x4f, 0xfa, 0x78, 0xbe,
+  0x62, 0x93, 0x4c, 0x5c, 0x0c, 0x9c, 0x89, 0x52, 0xa9, 0x3c, 0xe8, 0x76, 0x3d, 0x3f, 0x76, 0x2f,
+  0xa5, 0x2f, 0xc2, 0xe0, 0x3a, 0x73, 0x63, 0xa1, 0xba, 0x71, 0x1a, 0x75, 0x15, 0x0f, 0xc2, 0x59,
+  0x10, 0xfb, 0x9e, 0x94, 0xbf, 0xdb, 0x76, 0xb7, 0xdd, 0xde, 0x0f, 0x5d, 0x3f, 0x90, 0xaa, 0x58,
+  0x77, 0xa3, 0x20, 0x76, 0xb1, 0xe9, 0xb0, 0x4c, 0x84, 0x03, 0x47, 0xaa, 0x79, 0x28, 0xe4, 0x44,
+  0x08, 0x45, 0xea, 0xea, 0xa7, 0xa1, 0x3b, 0x11, 0x61, 0x7a, 0x7b, 0x01, 0x2d, 0x3a, 0x32, 0xf8,
+  0xab, 0x38, 0x70, 0xf7, 0x33, 0x11, 0x1d, 0x7a, 0x49, 0x98, 0x64, 0x07, 0xbf, 0xd9, 0x7d, 0xb1,
+  0xb7, 0xf7, 0x6c, 0xe7, 0xae, 0xdf, 0x35, 0xb4, 0x4f, 0xfa, 0x5d, 0x6b, 0xa3, 0x51, 0xe2, 0xcf,
+  0x99, 0x17, 0x72, 0x29, 0x07, 0xce, 0x68, 0xdc, 0x19, 0x67, 0x7c, 0xde, 0xe9, 0x6d, 0x6d, 0x31,
+  0x25, 0x6e, 0x94, 0x79, 0xda, 0xc7, 0x93, 0xe1, 0xca, 0x63, 0x49, 0xaf, 0xf3, 0x83, 0xeb, 0xfc,
+  0x44, 0xc4, 0x6f, 0x3a, 0xb3, 0xce, 0x4d, 0xc8, 0xa2, 0x9b, 0x0e, 0x9f, 0xaa, 0x84, 0xa5, 0x9d,
+  0xdd, 0xdc, 0x01, 0x22, 0xcb, 0xa9, 0x2e, 0x42, 0x71, 0xc3, 0x02, 0x25, 0x22, 0xd9, 0xf1, 0x60,
+  0x61, 0x6c, 0x5c, 0x4e, 0xa5, 0x0a, 0x2e, 0xe6, 0x9d, 0x91, 0x50, 0x33, 0x21, 0x62, 0x16, 0x8d,
+  0x3a, 0xcf, 0x2c, 0x6b, 0x3a, 0xdd, 0xcb, 0x4f, 0x6a, 0x29, 0x76, 0xc0, 0x5f, 0x0b, 0x30, 0x4a,
+  0x42, 0xdf, 0x19, 0xfe, 0xe7, 0x1f, 0x7f, 0xff, 0x27, 0x23, 0x93, 0x43, 0x87, 0x1e, 0xa8, 0xd3,
+  0x1a, 0xb1, 0x8c, 0x2a, 0xa2, 0x3f, 0xdb, 0xda, 0x72, 0x86, 0x47, 0x49, 0x7c, 0x11, 0x8c, 0xa7,
+  0x99, 0xd0, 0x87, 0xc8, 0xcd, 0xb1, 0xf0, 0x54, 0x90, 0xc4, 0x8c, 0xc7, 0x3e, 0x53, 0x49, 0x1a,
+  0x78, 0xb2, 0xdf, 0x4d, 0xc9, 0x26, 0xe6, 0xf5, 0x15, 0xfd, 0x96, 0x25, 0x1f, 0x73, 0xab, 0x22,
+  0xb7, 0x6e, 0xed, 0xfa, 0x5c, 0x4e, 0x46, 0x09, 0xcf, 0x7c, 0x97, 0x70, 0xe8, 0x34, 0x4a, 0x33,
+  0x0a, 0xa7, 0x82, 0xa4, 0x61, 0x93, 0xe4, 0x5a, 0x64, 0x07, 0xd3, 0x18, 0xd6, 0x01, 0x34, 0x84,
+  0x33, 0x7c, 0xc1, 0xbd, 0xab, 0x7e, 0x97, 0x57, 0x19, 0x86, 0xc9, 0x38, 0x99, 0x2a, 0xe7, 0x8b,
+  0x6a, 0x2d, 0x33, 0x7a, 0xab, 0x4f, 0x19, 0x56, 0x56, 0x91, 0xae, 0x71, 0x03, 0x21, 0xc4, 0x6a,
+  0x5c, 0x3a, 0x7a, 0x36, 0x81, 0x5a, 0xe4, 0x2e, 0x96, 0x25, 0xc4, 0xc5, 0xef, 0x6c, 0xc3, 0xcc,
+  0x72, 0xc2, 0xfd, 0x64, 0x46, 0xee, 0xd8, 0x75, 0x1a, 0x2c, 0xb1, 0xe8, 0xb6, 0x9a, 0x65, 0x70,
+  0x68, 0x5b, 0xfb, 0x7e, 0xbb, 0x26, 0x79, 0xee, 0x3c, 0x29, 0xa2, 0xc0, 0x38, 0xf0, 0x4c, 0x71,
+  0x35, 0x85, 0xc9, 0x27, 0xdb, 0xf7, 0x31, 0xb6, 0xe6, 0x29, 0x53, 0x8e, 0xb7, 0xf9, 0x00, 0xdc,
+  0x4f, 0x4a, 0xbd, 0x89, 0xfd, 0xc0, 0xe3, 0x2a, 0xc9, 0x0a, 0x13, 0x05, 0x31, 0xd9, 0x00, 0x56,
+  0x4e, 0xbc, 0x2b, 0x36, 0xeb, 0xec, 0xb0, 0x09, 0x7e, 0x72, 0xbd, 0x2e, 0xa6, 0x61, 0xc8, 0x72,
+  0x68, 0xef, 0x12, 0x22, 0x70, 0x0b, 0xc0, 0x6f, 0x91, 0xad, 0x11, 0xcb, 0x59, 0x83, 0xa6, 0x4e,
+  0x71, 0x38, 0x37, 0xb2, 0xf9, 0x4a, 0x0b, 0x3e, 0xc7, 0x59, 0x56, 0x11, 0xcd, 0xd8, 0x40, 0x1a,
+  0x36, 0x19, 0xc4, 0x79, 0x66, 0x24, 0xd0, 0x78, 0xb3, 0x6e, 0x79, 0xbc, 0x83, 0xd6, 0xd8, 0x9a,
+  0xe8, 0x76, 0x80, 0xb1, 0x2c, 0xb9, 0x12, 0xd9, 0xb2, 0xc1, 0xa1, 0x08, 0x22, 0xdc, 0x9c, 0x48,
+  0xf2, 0xab, 0x17, 0xf2, 0x91, 0x08, 0x0b, 0x29, 0xb4, 0x3d, 0x73, 0x43, 0x68, 0xce, 0x91, 0xf0,
+  0x83, 0x69, 0x44, 0x7c, 0x7b, 0x0e, 0x56, 0x32, 0x84, 0xb5, 0x44, 0x22, 0x08, 0xbd, 0xc6, 0x27,
+  0x05, 0x54, 0x96, 0x64, 0xec, 0xcd, 0x49, 0xbf, 0xab, 0xf9, 0x80, 0x5f, 0x10, 0xa7, 0x53, 0xa5,
+  0x4d, 0xa3, 0xe9, 0x98, 0x9a, 0xa7, 0xc2, 0x08, 0xeb, 0xb0, 0x34, 0xc4, 0xeb, 0x27, 0x10, 0x53,
+  0x80, 0x8d, 0x70, 0xc7, 0x2e, 0xeb, 0xfd, 0x80, 0xc8, 0xf7, 0x6c, 0xdf, 0xed, 0xb9, 0xbd, 0x2d,
+  0xe2, 0x44, 0xe6, 0x74, 0x21, 0x04, 0x2f, 0xaf, 0xd5, 0xcc, 0xfa, 0x33, 0xc9, 0x28, 0xc0, 0x58,
+  0xd3, 0x30, 0x82, 0x89, 0x0e, 0xc8, 0x45, 0x30, 0xa0, 0x60, 0xe8, 0x0c, 0x8f, 0x35, 0x8c, 0xd4,
+  0x44, 0xb0, 0x91, 0xb6, 0x81, 0xfe, 0xd5, 0xd3, 0x6a, 0xc9, 0x49, 0x32, 0x85, 0x85, 0x6c, 0x38,
+  0x40, 0x1c, 0x70, 0x17, 0x83, 0xc0, 0xa3, 0xcc, 0xa1, 0x73, 0xc9, 0xf0, 0x04, 0x9f, 0x4d, 0x46,
+  0x30, 0x99, 0xc6, 0x18, 0x21, 0x9e, 0x46, 0x23, 0x01, 0xa0, 0x20, 0xb2, 0x0f, 0x1c, 0x1c, 0x47,
+  0x2c, 0x1d, 0x38, 0xcf, 0xf6, 0xf6, 0x76, 0xf6, 0x16, 0x4c, 0xd3, 0xdb, 0xdf, 0xdf, 0xb9, 0xaf,
+  0xfe, 0xcb, 0x21, 0x6c, 0x9c, 0x05, 0x3e, 0xa3, 0x8f, 0x0e, 0x52, 0x81, 0xec, 0x6c, 0xeb, 0x4b,
+  0xf5, 0x8b, 0x3c, 0x3e, 0x95, 0x10, 0x7b, 0xf8, 0x11, 0x9f, 0xac, 0x9d, 0xa4, 0x04, 0x5b, 0x1e,
+  0x6e, 0x34, 0x69, 0xab, 0x09, 0x57, 0xbb, 0x9c, 0xbc, 0xfb, 0xc9, 0xd0, 0x3c, 0x54, 0xb9, 0xc7,
+  0xb9, 0x06, 0xa4, 0x70, 0x0d, 0x3e, 0x67, 0x78, 0xc1, 0x1a, 0xd9, 0x35, 0xb1, 0x95, 0x3d, 0xb5,
+  0x47, 0x16, 0xe4, 0xff, 0xf7, 0xdf, 0xfe, 0xd5, 0xf8, 0xef, 0x81, 0xea, 0x2c, 0x7c, 0x7d, 0xa3,
+  0x98, 0xf0, 0x3a, 0xc1, 0x65, 0xfd, 0x51, 0x4a, 0x14, 0x19, 0x3c, 0x56, 0xff, 0xa3, 0xd8, 0x80,
+  0x12, 0xc6, 0xa3, 0x3c, 0x35, 0x77, 0x86, 0x2f, 0xf3, 0x5f, 0x59, 0x8a, 0x2c, 0x17, 0xdc, 0x34,
+  0xd9, 0xbc, 0x24, 0x5f, 0x0d, 0x9a, 0x09, 0xe4, 0xe6, 0xb9, 0xd8, 0x8f, 0x8c, 0x0a, 0x1f, 0xe5,
+  0x94, 0x87, 0xe1, 0x9c, 0xf5, 0xbd, 0xc4, 0x17, 0xc3, 0x1a, 0xc7, 0x7e, 0x57, 0xaf, 0x7d, 0x9d,
+  0x58, 0x30, 0xe2, 0x28, 0x3c, 0xa9, 0xbe, 0xa0, 0x34, 0x2f, 0x85, 0xa9, 0x35, 0x58, 0xdb, 0x54,
+  0x96, 0x8d, 0xa8, 0x2b, 0x4f, 0xac, 0xb6, 0x80, 0xc7, 0xe3, 0x4f, 0xc1, 0xa7, 0x99, 0xe0, 0xd9,
+  0x27, 0xc4, 0xb0, 0x4c, 0xc9, 0x47, 0x5b, 0x01, 0x9b, 0x5c, 0x5a, 0x7f, 0x90, 0xc4, 0x0c, 0x56,
+  0x61, 0x30, 0x83, 0x12, 0x12, 0x66, 0x88, 0x22, 0xd4, 0x47, 0xb2, 0x6e, 0x89, 0xaf, 0x06, 0xd2,
+  0x87, 0x56, 0x16, 0x3b, 0xf7, 0xab, 0x2c, 0xe6, 0x12, 0xc5, 0x93, 0x05, 0x73, 0xcd, 0x5f, 0x2b,
+  0x6a, 0x8b, 0xdc, 0x83, 0xc8, 0xc8, 0xa5, 0x13, 0xa4, 0xe6, 0x72, 0x1c, 0xf3, 0x51, 0x28, 0xfc,
+  0xdc, 0x11, 0xde, 0x44, 0x78, 0x57, 0xa3, 0xe4, 0x86, 0x4c, 0xc9, 0xec, 0x5e, 0xe9, 0xc1, 0xe5,
+  0xb0, 0xbb, 0x78, 0x7f, 0x56, 0x84, 0xe3, 0x9d, 0x5a, 0x38, 0xce, 0x89, 0xb0, 0xd5, 0xa1, 0x2a,
+  0xc3, 0x14, 0x3f, 0x0f, 0x07, 0x9e, 0xd1, 0xe0, 0xb5, 0xce, 0xcc, 0x47, 0x49, 0x18, 0xc2, 0x47,
+  0xf0, 0x2e, 0x65, 0xe0, 0xd5, 0xf9, 0xb9, 0x72, 0xe6, 0xde, 0x59, 0x7a, 0x7b, 0xeb, 0x1b, 0x85,
+  0x6e, 0x23, 0xdc, 0x89, 0xce, 0xad, 0x1f, 0x5f, 0x9e, 0xb0, 0x74, 0x45, 0x7e, 0xad, 0xd0, 0x3d,
+  0x34, 0xcb, 0xee, 0xf5, 0x76, 0x1f, 0x17, 0xb8, 0xef, 0xeb, 0xdc, 0x5f, 0xa0, 0xf8, 0x5b, 0x71,
+  0x2d, 0x42, 0x67, 0xf8, 0x0e, 0x5d, 0x68, 0x84, 0xfd, 0x90, 0x1e, 0x4b, 0xf5, 0xa5, 0x20, 0x07,
+  0x57, 0xf4, 0x37, 0xe4, 0xeb, 0x95, 0xc1, 0x59, 0x93, 0x03, 0xd9, 0x35, 0x47, 0x83, 0x32, 0x70,
+  0x50, 0x99, 0xbe, 0x3c, 0x7e, 0xf1, 0xf1, 0xf7, 0xfd, 0xae, 0x59, 0x5f, 0x22, 0xe8, 0x39, 0xc3,
+  0x37, 0xef, 0x5f, 0x7d, 0x58, 0xb9, 0x0f, 0x9e, 0x7f, 0xfe, 0xf1, 0xf4, 0xfd, 0xca, 0x7d, 0xd8,
+  0xe2, 0xf8, 0xf4, 0xf4, 0xc3, 0x69, 0x85, 0xa0, 0x6b, 0xc4, 0xff, 0x5a, 0x18, 0x79, 0xc1, 0x95,
+  0x37, 0x41, 0x37, 0x84, 0x7e, 0x00, 0xa1, 0x0d, 0x0a, 0xfb, 0x5c, 0x71, 0x94, 0xef, 0xd1, 0x6a,
+  0xb8, 0x98, 0x23, 0x5f, 0xc2, 0xcb, 0xce, 0xf6, 0x37, 0xc5, 0xf9, 0x29, 0x22, 0x30, 0x3c, 0x61,
+  0x05, 0x97, 0x5d, 0xb9, 0x5a, 0x76, 0x4d, 0xfa, 0x25, 0xd1, 0xd1, 0xcb, 0x3f, 0x0e, 0xd6, 0x0b,
+  0xd9, 0xe2, 0xf4, 0xd5, 0x11, 0xdb, 0xdb, 0xdd, 0xde, 0x65, 0x94, 0xa0, 0x19, 0xee, 0xa0, 0xcb,
+  0xce, 0x84, 0x62, 0xe1, 0x92, 0x9d, 0x91, 0xe5, 0x58, 0x4f, 0x67, 0x13, 0x2f, 0x8f, 0x3c, 0xe8,
+  0x7e, 0x26, 0x5c, 0x31, 0x71, 0x93, 0x12, 0x4e, 0x93, 0x58, 0xb0, 0x48, 0x48, 0xc9, 0xc7, 0xa2,
+  0x76, 0xd0, 0x65, 0xc6, 0x69, 0xfa, 0x05, 0x54, 0xa7, 0x67, 0xd0, 0x0d, 0x2f, 0x88, 0x02, 0xc5,
+  0x38, 0xba, 0x77, 0x3f, 0x4b, 0xd2, 0x54, 0xf8, 0x9b, 0x2c, 0x16, 0x44, 0xe1, 0x8b, 0x90, 0xcf,
+  0x85, 0x6f, 0xf3, 0xd3, 0x62, 0x3e, 0x31, 0xd1, 0xbd, 0x1a, 0xf0, 0x09, 0xed, 0xa3, 0xa9, 0x52,
+  0x49, 0x5c, 0x31, 0xdf, 0x19, 0xbf, 0x16, 0x2f, 0x54, 0x5c, 0x58, 0x28, 0x9d, 0xe3, 0x54, 0x7a,
+  0x53, 0x76, 0x8f, 0xd4, 0x38, 0x16, 0xcd, 0xbb, 0x76, 0x9e, 0x49, 0x6f, 0xa6, 0xfd, 0xce, 0x37,
+  0x7f, 0x4b, 0x3d, 0x1d, 0xf1, 0x62, 0xd2, 0x66, 0x20, 0xf3, 0xa6, 0x6a, 0x8b, 0x69, 0x76, 0xde,
+  0xc9, 0xf1, 0xba, 0x0e, 0x73, 0xb1, 0xc1, 0x4c, 0xab, 0xf2, 0x22, 0x39, 0xcb, 0xe6, 0xde, 0x52,
+  0x33, 0xd8, 0xab, 0x34, 0x97, 0xbf, 0x30, 0x55, 0xdf, 0xbf, 0x94, 0x24, 0xc5, 0x6d, 0xce, 0xfd,
+  0xf2, 0x2c, 0xc6, 0xd2, 0x1f, 0x4d, 0x78, 0x0c, 0xdf, 0xa3, 0xd2, 0x51, 0x41, 0x3c, 0x96, 0x7a,
+  0x0c, 0x23, 0xc1, 0xc3, 0x65, 0xe7, 0x45, 0x77, 0x36, 0x0b, 0x00, 0x54, 0x85, 0x6a, 0x11, 0x68,
+  0xca, 0x44, 0xde, 0xa4, 0x05, 0x11, 0x5d, 0x19, 0xc0, 0x22, 0x9c, 0x3f, 0xda, 0xef, 0x5f, 0xd9,
+  0xe3, 0x15, 0x57, 0x57, 0xde, 0x82, 0x0a, 0x4a, 0xad, 0x7d, 0x8b, 0x36, 0xcb, 0xf6, 0xd2, 0xac,
+  0xad, 0x78, 0x91, 0x5e, 0xd9, 0xa1, 0x17, 0x9d, 0x83, 0x5d, 0x65, 0x70, 0xd5, 0x08, 0x2f, 0xc8,
+  0xf2, 0x10, 0x70, 0xad, 0x1b, 0x5f, 0x45, 0xa1, 0x1d, 0xe8, 0x35, 0x49, 0x6e, 0x2c, 0x62, 0xe3,
+  0x48, 0x5d, 0xde, 0x3d, 0x9a, 0xb8, 0xf1, 0xd8, 0xa3, 0x04, 0xc5, 0x1b, 0x61, 0x68, 0x57, 0xa4,
+  0x97, 0x05, 0x29, 0xc2, 0x3e, 0xd4, 0x82, 0x72, 0x3f, 0x49, 0x36, 0x80, 0x1e, 0x6c, 0x30, 0x64,
+  0x7e, 0xe2, 0x4d, 0x23, 0xb8, 0xce, 0x1d, 0x0b, 0x75, 0x1c, 0x0a, 0xfa, 0xf5, 0xc5, 0xfc, 0x8d,
+  0xdf, 0x0e, 0xfc, 0x8d, 0xc3, 0x27, 0x17, 0xd3, 0xd8, 0x80, 0x18, 0xe8, 0x31, 0x03, 0x9b, 0xb6,
+  0xb5, 0x0b, 0x45, 0x06, 0x91, 0x65, 0x1b, 0xec, 0xd6, 0xb2, 0x0c, 0x00, 0xab, 0x01, 0x18, 0xb7,
+  0x5b, 0xb5, 0xa1, 0x51, 0x0b, 0x5c, 0x0c, 0x01, 0xfe, 0x95, 0xfb, 0x86, 0x59, 0xb9, 0x09, 0xc5,
+  0xca, 0x4d, 0x3d, 0xd2, 0xa1, 0xbd, 0xe0, 0x82, 0xb5, 0xc1, 0x77, 0x83, 0x98, 0xbb, 0xda, 0x52,
+  0xef, 0x69, 0xe8, 0x31, 0x60, 0xad, 0xf5, 0x23, 0xa8, 0x16, 0xfb, 0x9e, 0x95, 0xc2, 0xb2, 0xe7,
+  0xac, 0xa5, 0x6d, 0x86, 0x6a, 0x97, 0xae, 0x6d, 0x8b, 0x1d, 0xe8, 0x05, 0x1a, 0x11, 0xd1, 0xa3,
+  0x7d, 0x99, 0x54, 0x1b, 0x90, 0xd3, 0x25, 0x2f, 0x1e, 0x99, 0xf9, 0x34, 0x5e, 0x56, 0x63, 0x72,
+  0x94, 0x3f, 0x68, 0x0e, 0xba, 0xcd, 0xca, 0x17, 0x0c, 0x0b, 0x01, 0x9b, 0x88, 0x6c, 0x81, 0x05,
+  0x2c, 0xc5, 0x7e, 0xfe, 0x99, 0xb5, 0x40, 0x73, 0xf7, 0x84, 0xcb, 0x79, 0xec, 0xb1, 0xc2, 0xb4,
+  0x61, 0xc2, 0xfd, 0xa3, 0x8b, 0x71, 0x9b, 0x4c, 0x49, 0x57, 0x30, 0x37, 0x28, 0x59, 0x84, 0xcf,
+  0x38, 0xc2, 0xf1, 0x85, 0x40, 0xc6, 0x6c, 0xb7, 0xba, 0x3c, 0x0d, 0xba, 0x64, 0x1f, 0x74, 0x0b,
+  0x34, 0x63, 0x2d, 0xad, 0x77, 0x59, 0x90, 0x66, 0xee, 0xa5, 0x4c, 0xe2, 0x36, 0x76, 0xc8, 0x98,
+  0x54, 0x82, 0xb6, 0x36, 0x5c, 0x5d, 0x0d, 0x80, 0xe4, 0xd2, 0xd5, 0x35, 0xa9, 0x15, 0x84, 0x08,
+  0xa8, 0xb0, 0xab, 0x11, 0xd0, 0x02, 0x11, 0xd0, 0x10, 0xc4, 0x90, 0xd0, 0xc4, 0xa0, 0x46, 0x42,
+  0x0b, 0x55, 0x1e, 0x45, 0x1b, 0x59, 0xa3, 0x2a, 0x56, 0x35, 0x69, 0xad, 0xe9, 0xb3, 0xe7, 0x8a,
+  0xe6, 0xab, 0x76, 0x8e, 0x56, 0xf5, 0x91, 0xa5, 0xbe, 0xab, 0x55, 0x00, 0x69, 0xb5, 0x61, 0xe4,
+  0x02, 0xac, 0x64, 0x69, 0x19, 0x59, 0x58, 0xa6, 0xc4, 0xf2, 0xd3, 0xa7, 0xf2, 0xd2, 0xad, 0x00,
+  0x1a, 0x4f, 0x00, 0x99, 0xfa, 0x24, 0x08, 0x80, 0xa0, 0xbc, 0x63, 0x1e, 0x15, 0x2b, 0x70, 0x6a,
+  0x8e, 0xf3, 0x24, 0x14, 0xae, 0xde, 0x6d, 0xb7, 0x5e, 0xf1, 0x00, 0x4d, 0x09, 0x45, 0x4c, 0xf2,
+  0x60, 0x31, 0xed, 0x26, 0xc7, 0xe0, 0x6a, 0xd0, 0xe9, 0x65, 0x5f, 0x53, 0xd8, 0xc8, 0x7d, 0x6d,
+  0x24, 0x8c, 0xe4, 0xd8, 0x22, 0xdf, 0x86, 0x14, 0x12, 0x1e, 0x8b, 0x0b, 0x00, 0x6a, 0x21, 0xf8,
+  0x21, 0x7a, 0xbb, 0xae, 0x5b, 0x98, 0x01, 0x39, 0x3f, 0xc2, 0x4e, 0x2c, 0x66, 0xec, 0xe3, 0xe9,
+  0xdb, 0x33, 0x18, 0xca, 0x9b, 0x9c, 0x70, 0xaa, 0x60, 0x48, 0x49, 0xda, 0x75, 0xa1, 0xa9, 0x05,
+  0xc1, 0x26, 0x5b, 0xc4, 0x83, 0xab, 0xb2, 0x20, 0x6a, 0x6f, 0xd4, 0x48, 0x35, 0x1c, 0x0c, 0x69,
+  0x15, 0x19, 0x4d, 0xa4, 0x1a, 0x16, 0x86, 0xb4, 0x8a, 0x90, 0x92, 0xd4, 0x08, 0x99, 0xce, 0xac,
+  0x76, 0x34, 0xd4, 0xc9, 0x89, 0x0e, 0x59, 0xb7, 0xcb, 0x44, 0x94, 0xaa, 0x39, 0x36, 0xaf, 0x84,
+  0x48, 0x59, 0x3e, 0xf2, 0x61, 0x30, 0x94, 0x4e, 0x57, 0xbe, 0xbe, 0x4b, 0xe9, 0x6c, 0x83, 0x55,
+  0xa4, 0x23, 0x16, 0x9b, 0x60, 0x59, 0x13, 0xa4, 0x84, 0x9f, 0x91, 0x66, 0x09, 0x8e, 0x4d, 0xd2,
+  0x13, 0xca, 0x2c, 0xfd, 0x12, 0x0c, 0x4b, 0xfa, 0x87, 0xdd, 0xc6, 0x4d, 0x76, 0x8b, 0x42, 0x4b,
+  0x4d, 0x12, 0xff, 0xa0, 0x75, 0xf2, 0xe1, 0xec, 0x1c, 0x0b, 0xe6, 0x3f, 0x04, 0xe4, 0xc1, 0x6d,
+  0xcb, 0x7a, 0xb2, 0x73, 0x8e, 0xd2, 0xb1, 0x75, 0xd0, 0xe2, 0x69, 0x1a, 0x52, 0x7c, 0x04, 0x26,
+  0xba, 0x37, 0x9d, 0xd9, 0x0c, 0xa5, 0x22, 0x64, 0xeb, 0x4c, 0xb3, 0x50, 0xc4, 0x34, 0x11, 0xf1,
+  0x5b, 0x77, 0x9b, 0x8c, 0xfe, 0xaf, 0xe8, 0xe0, 0x0c, 0xd2, 0xc4, 0xe3, 0x36, 0x6d, 0x6f, 0xb0,
+  0x3b, 0x1b, 0xa6, 0x32, 0x37, 0xb9, 0x22, 0x08, 0x35, 0xe3, 0x04, 0x55, 0x1a, 0x3b, 0xcd, 0x93,
+  0x78, 0x01, 0x9a, 0x45, 0x27, 0x10, 0x71, 0x4b, 0x5f, 0x86, 0xf3, 0x20, 0x12, 0xc9, 0x54, 0xb5,
+  0x81, 0x4a, 0xe4, 0x83, 0x06, 0x9e, 0xd0, 0x04, 0x31, 0x72, 0x4b, 0x5f, 0x08, 0x11, 0xe2, 0x7e,
+  0xe6, 0x46, 0x51, 0x95, 0xb8, 0x43, 0x67, 0xda, 0xcd, 0xd8, 0x35, 0x37, 0xe5, 0x40, 0x87, 0x64,
+  0xa5, 0xef, 0x45, 0xed, 0x5e, 0x35, 0x9c, 0x78, 0x2f, 0x14, 0xe0, 0x70, 0xc5, 0xf4, 0x55, 0x6b,
+  0x99, 0xab, 0x94, 0xdf, 0x11, 0x24, 0x7a, 0xe8, 0xc0, 0x7d, 0xff, 0xf8, 0x1a, 0xd4, 0x6f, 0x11,
+  0x53, 0x44, 0x2c, 0x70, 0x1f, 0x3d, 0x58, 0xf4, 0x0a, 0xa2, 0xda, 0x3b, 0x56, 0x40, 0x90, 0xe4,
+  0x7b, 0x95, 0x64, 0x7f, 0x48, 0x46, 0x24, 0xad, 0xbe, 0x8f, 0x48, 0x6e, 0x9b, 0x4c, 0x19, 0xb5,
+  0xdf, 0x51, 0x38, 0x41, 0xda, 0x87, 0x7e, 0xa4, 0x7e, 0xae, 0x9a, 0x0f, 0xd7, 0x51, 0x8a, 0xc1,
+  0x26, 0x3a, 0x03, 0xe1, 0xc6, 0xc9, 0x0c, 0xf6, 0xf9, 0xbe, 0x3c, 0x75, 0xf8, 0x04, 0x69, 0x39,
+  0x14, 0xac, 0x5d, 0xd9, 0xee, 0x17, 0xc7, 0x48, 0x2f, 0x63, 0x19, 0xba, 0x9f, 0x27, 0x59, 0x12,
+  0x05, 0x52, 0xb4, 0x33, 0x7a, 0x43, 0xc5, 0xe2, 0xd9, 0x26, 0x43, 0x65, 0x53, 0xde, 0x96, 0x45,
+  0x90, 0x7d, 0xd6, 0x20, 0xbb, 0x4c, 0x46, 0xf2, 0x39, 0x8a, 0x8e, 0xef, 0x6e, 0x03, 0xff, 0xee,
+  0xb3, 0x85, 0xc0, 0x53, 0x83, 0x81, 0x51, 0x26, 0xf8, 0x55, 0x91, 0x06, 0x8c, 0x8a, 0x0b, 0x89,
+  0x80, 0xa8, 0xb1, 0xe3, 0xea, 0x49, 0x13, 0x1b, 0x0c, 0x60, 0x5e, 0x1f, 0x4d, 0x41, 0x8b, 0xa2,
+  0xec, 0xc2, 0xfa, 0x85, 0x76, 0x54, 0x6b, 0x03, 0x35, 0xa0, 0x9a, 0x66, 0x31, 0x6d, 0x93, 0xed,
+  0xed, 0x53, 0x8c, 0xb4, 0x8a, 0x47, 0x03, 0x25, 0x5b, 0x72, 0x7d, 0xd1, 0x13, 0xd6, 0xd8, 0x35,
+  0xbb, 0xde, 0x37, 0xde, 0x51, 0x0d, 0xf6, 0xff, 0x13, 0xf0, 0xd6, 0x44, 0xb3, 0x7b, 0x06, 0x1a,
+  0xb2, 0xf9, 0xaf, 0x11, 0x66, 0x8c, 0x60, 0xb7, 0x1a, 0x5f, 0x77, 0x0d, 0x08, 0xb3, 0x82, 0x0b,
+  0x39, 0x0d, 0xcb, 0x88, 0x50, 0x5e, 0x3b, 0x42, 0x5f, 0x81, 0x5a, 0x4d, 0xb4, 0xc1, 0x56, 0x78,
+  0x5c, 0x5f, 0x2f, 0x9f, 0xe1, 0x6e, 0xc0, 0xeb, 0x3a, 0xd4, 0x2c, 0x13, 0x1a, 0x16, 0xcb, 0x70,
+  0x2e, 0x8b, 0x33, 0xca, 0xb4, 0x1f, 0xfe, 0xa8, 0x0b, 0xb4, 0x6a, 0xe8, 0xb1, 0x07, 0x6d, 0x33,
+  0xfc, 0x6b, 0x06, 0xb3, 0x4a, 0x08, 0xa8, 0xdf, 0x11, 0x0d, 0x04, 0x76, 0xff, 0x32, 0x87, 0xad,
+  0x2e, 0x73, 0xd8, 0xbd, 0xcb, 0x1c, 0x96, 0x6b, 0x70, 0x0b, 0x65, 0x36, 0xd9, 0xbe, 0x89, 0xf4,
+  0xf8, 0x29, 0x2a, 0xd3, 0xc3, 0xa6, 0x9a, 0xd5, 0x4c, 0x7f, 0x97, 0xca, 0xd6, 0x52, 0x94, 0xf6,
+  0xb2, 0xf4, 0xa6, 0xad, 0x2e, 0xea, 0xd7, 0x8d, 0x5a, 0xb5, 0x5a, 0x1b, 0x04, 0xe3, 0xea, 0xe8,
+  0x19, 0xb0, 0xa0, 0xae, 0xe2, 0xe9, 0xd3, 0x4b, 0x57, 0x98, 0xf5, 0x2a, 0xe9, 0xeb, 0x75, 0xe5,
+  0x6d, 0x39, 0x9f, 0x6c, 0x2c, 0x72, 0xf7, 0x7a, 0xbb, 0x55, 0x3a, 0x3d, 0xc7, 0xab, 0x10, 0xda,
+  0x3b, 0x71, 0x49, 0x7f, 0x0c, 0xf2, 0x49, 0x0f, 0x01, 0xd9, 0xf3, 0xe7, 0xac, 0x57, 0x93, 0x56,
+  0x0f, 0xb3, 0x16, 0x0a, 0x58, 0x32, 0x25, 0xb8, 0xef, 0x57, 0xe9, 0x68, 0x70, 0x54, 0x23, 0xd3,
+  0xd3, 0x16, 0x2a, 0xb4, 0xb7, 0x6a, 0xfd, 0xd1, 0x3a, 0xcb, 0xe5, 0x9e, 0x6f, 0xb2, 0x9c, 0x9e,
+  0x56, 0xe0, 0x25, 0x75, 0xf8, 0x7d, 0x3e, 0xa3, 0xef, 0xef, 0x6e, 0xd1, 0xd6, 0x50, 0x67, 0x9f,
+  0xf9, 0xf2, 0xce, 0x8e, 0x91, 0x82, 0xd8, 0x2c, 0xe7, 0x13, 0x21, 0x6c, 0x14, 0xbf, 0x1e, 0xe6,
+  0xf3, 0x1f, 0x4b, 0x62, 0x1e, 0x80, 0x0e, 0x29, 0xd0, 0xe7, 0x69, 0xe0, 0x48, 0xb3, 0x45, 0x0b,
+  0x06, 0x49, 0xf2, 0xee, 0xf3, 0xc3, 0x4a, 0x66, 0x23, 0xf6, 0x72, 0xd1, 0x5c, 0x51, 0xe9, 0x1e,
+  0xf9, 0x7e, 0x4d, 0x96, 0xc9, 0xe7, 0x40, 0x5f, 0xbd, 0xae, 0xb6, 0x80, 0xb4, 0x39, 0x61, 0x15,
+  0x78, 0x11, 0x95, 0x7a, 0x3a, 0x12, 0xe9, 0x1e, 0xb3, 0x31, 0x49, 0x2d, 0x83, 0x79, 0x4d, 0xaa,
+  0x5a, 0x86, 0x75, 0xd3, 0x81, 0x02, 0xb5, 0xb5, 0x53, 0x35, 0x90, 0x2f, 0xd4, 0xc4, 0x04, 0xe5,
+  0x2a, 0x6d, 0x0d, 0xdc, 0x4d, 0xaf, 0x20, 0x10, 0xd7, 0x4e, 0x54, 0x61, 0xfe, 0x90, 0x3a, 0xba,
+  0x1e, 0x17, 0xbe, 0x51, 0x8a, 0x6b, 0x48, 0x2d, 0x48, 0x78, 0xe4, 0x31, 0x5d, 0x44, 0x2f, 0xe5,
+  0x8f, 0xc5, 0xe4, 0x50, 0xa6, 0xc8, 0x87, 0x16, 0xd1, 0x0f, 0xaf, 0x7e, 0x6d, 0x34, 0xce, 0x63,
+  0xee, 0x21, 0x8d, 0x78, 0xec, 0x44, 0xa7, 0xdf, 0x25, 0xf5, 0xf4, 0xdf, 0x1f, 0xe9, 0xbf, 0xcf,
+  0xfb, 0x2f, 0xce, 0x7e, 0x7b, 0xeb, 0xb0, 0x27, 0x00, 0x00,
+};
+
+// /update.html: 2718 bytes, 1009 gzipped
+static const uint8_t ASSET_6[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x56, 0xdd, 0x6f, 0xdb, 0x36,
+  0x10, 0x7f, 0xcf, 0x5f, 0x71, 0xd3, 0x1e, 0x62, 0x03, 0x93, 0x14, 0x7b, 0x43, 0xdb, 0x39, 0x96,
+  0x31, 0xb4, 0x6b, 0x80, 0xbc, 0xac, 0x01, 0x9c, 0x0c, 0xd8, 0x23, 0x25, 0x9e, 0x22, 0x36, 0x24,
+  0xc5, 0x89, 0x27, 0xcb, 0x46, 0xb1, 0xff, 0x7d, 0x47, 0x7d, 0x25, 0xe9, 0xba, 0xa1, 0x1d, 0x56,
+  0x60, 0x4f, 0x96, 0x49, 0xdd, 0xf1, 0x77, 0xbf, 0x0f, 0x49, 0xdb, 0x6f, 0x7e, 0x7e, 0xf7, 0xe6,
+  0xf6, 0xb7, 0x9b, 0xb7, 0x50, 0x91, 0xd1, 0xbb, 0xb3, 0x6d, 0xf8, 0x01, 0x2d, 0xec, 0x7d, 0x16,
+  0xa1, 0x8d, 0xc2, 0x02, 0x0a, 0xc9, 0x3f, 0x06, 0x49, 0x40, 0x51, 0x89, 0xc6, 0x23, 0x65, 0xd1,
+  0xdd, 0xed, 0x55, 0xfc, 0x2a, 0x82, 0x74, 0xda, 0xb0, 0xc2, 0x60, 0x16, 0x1d, 0x14, 0x76, 0xae,
+  0x6e, 0x28, 0x82, 0xa2, 0xb6, 0x84, 0x96, 0x6f, 0xec, 0x94, 0xa4, 0x2a, 0x93, 0x78, 0x50, 0x05,
+  0xc6, 0xfd, 0x9f, 0xef, 0x40, 0x59, 0x45, 0x4a, 0xe8, 0xd8, 0x17, 0x42, 0x63, 0xb6, 0x4a, 0x2e,
+  0x86, 0x46, 0xa4, 0x48, 0xe3, 0xee, 0x4a, 0x35, 0xa6, 0x13, 0x0d, 0xa6, 0x77, 0xd7, 0x70, 0xe7,
+  0xa4, 0x20, 0xdc, 0xa6, 0xc3, 0xce, 0xd9, 0x56, 0x2b, 0xfb, 0x00, 0x55, 0x83, 0x65, 0x16, 0x55,
+  0x44, 0xce, 0x6f, 0xd2, 0xb4, 0x90, 0x36, 0x79, 0xef, 0x25, 0x6a, 0x75, 0x68, 0x12, 0x8b, 0x94,
+  0x5a, 0x67, 0x52, 0x12, 0x4a, 0x77, 0xca, 0xca, 0xc2, 0xfb, 0x9f, 0xd6, 0xc9, 0x3a, 0x59, 0xfd,
+  0x98, 0x4a, 0xe5, 0x69, 0x5e, 0x4f, 0x8c, 0xb2, 0x09, 0x6f, 0x46, 0xd0, 0xa0, 0xce, 0x22, 0x4f,
+  0x27, 0x8d, 0xbe, 0x42, 0xa4, 0x30, 0x6f, 0x3a, 0x0e, 0x9c, 0xd7, 0xf2, 0x04, 0x85, 0x16, 0xde,
+  0x67, 0x51, 0x7e, 0x1f, 0xdf, 0x37, 0xe2, 0x14, 0xaf, 0x2e, 0x2e, 0x80, 0xf0, 0x48, 0xc3, 0xbf,
+  0x57, 0xfc, 0xaf, 0xe4, 0x41, 0x63, 0x2f, 0xac, 0x0f, 0xa5, 0x52, 0x1d, 0xa6, 0x0a, 0x23, 0x8e,
+  0x71, 0x17, 0x1f, 0x35, 0x98, 0x63, 0x2c, 0x5a, 0xaa, 0xc1, 0xc5, 0x3f, 0x4c, 0x6c, 0x62, 0x33,
+  0xdd, 0x55, 0x6a, 0x3c, 0x82, 0x22, 0x34, 0x3e, 0x2e, 0x98, 0x2e, 0xde, 0x78, 0xdf, 0x7a, 0x52,
+  0xe5, 0x29, 0xce, 0x91, 0x3a, 0x44, 0x0b, 0x26, 0x8f, 0x5f, 0xf4, 0x75, 0xab, 0xa9, 0xa6, 0x3f,
+  0x7f, 0xcd, 0x9d, 0xfb, 0xa3, 0xf3, 0x5a, 0xcb, 0x68, 0x37, 0x11, 0x55, 0xad, 0xf8, 0x56, 0x31,
+  0x52, 0x94, 0x4a, 0xe1, 0xab, 0xbc, 0x16, 0x8d, 0x4c, 0x82, 0xa8, 0xd1, 0xb3, 0x06, 0xde, 0x0c,
+  0x83, 0xe4, 0xba, 0xc5, 0xf8, 0x05, 0x0f, 0x52, 0xd5, 0x07, 0x6c, 0x36, 0xad, 0x65, 0x74, 0x4c,
+  0x33, 0x46, 0xbb, 0xd7, 0xa2, 0x78, 0xd8, 0xa6, 0x62, 0x62, 0x04, 0x1b, 0xbe, 0xf2, 0x58, 0x90,
+  0xaa, 0xed, 0x13, 0x5a, 0xba, 0x8a, 0xe1, 0x87, 0xe1, 0xa0, 0xa9, 0x43, 0xb1, 0xec, 0xa1, 0xf9,
+  0x4a, 0xc8, 0xba, 0x0b, 0xe0, 0x87, 0xa1, 0xd7, 0xcf, 0xce, 0x9e, 0xb0, 0x7b, 0x34, 0x2a, 0xe0,
+  0x0f, 0xf7, 0xad, 0xa3, 0xdd, 0x9e, 0xd0, 0xc1, 0x6a, 0x03, 0x93, 0x03, 0x60, 0x21, 0x9c, 0x5b,
+  0xf2, 0xe9, 0x6b, 0x6e, 0xe1, 0x3e, 0x89, 0xbe, 0x97, 0xe1, 0x25, 0xa3, 0x1f, 0x3a, 0xdc, 0x39,
+  0x5d, 0x0b, 0x09, 0x54, 0x21, 0x94, 0x73, 0x93, 0xe9, 0x2a, 0xc9, 0x95, 0x5d, 0x26, 0x70, 0xcb,
+  0x9b, 0x83, 0x1d, 0xa1, 0x53, 0x5a, 0xb3, 0x03, 0xf2, 0xba, 0x26, 0x08, 0x1a, 0x19, 0x41, 0x8a,
+  0x2d, 0xa9, 0x4f, 0x20, 0xca, 0xa0, 0x85, 0x00, 0xdf, 0x16, 0x05, 0x7a, 0x5f, 0xb6, 0x1a, 0xda,
+  0xbe, 0x77, 0xb2, 0x4d, 0x1d, 0xa3, 0x29, 0xeb, 0xc6, 0x80, 0xe8, 0xb9, 0x60, 0x9e, 0x87, 0xad,
+  0x09, 0x76, 0x04, 0x9c, 0x88, 0xaa, 0x96, 0x59, 0x74, 0xf3, 0x6e, 0x7f, 0x1b, 0x01, 0xda, 0x82,
+  0x4e, 0x8e, 0xd3, 0x61, 0x5a, 0x4d, 0xca, 0x89, 0x86, 0xd2, 0x50, 0x1e, 0xb3, 0x62, 0x62, 0xd6,
+  0xc4, 0x3b, 0xc1, 0xf9, 0x38, 0x85, 0x21, 0xce, 0xb6, 0xca, 0xba, 0x96, 0x60, 0x28, 0x2a, 0x95,
+  0xe6, 0x8e, 0x43, 0xbc, 0xa6, 0x49, 0xae, 0xfa, 0x35, 0xc1, 0xd0, 0x1c, 0x27, 0x2c, 0xcc, 0x15,
+  0x8c, 0xfc, 0x7b, 0xab, 0x1a, 0x94, 0xb3, 0x34, 0xba, 0x2e, 0x1e, 0xa0, 0x8b, 0x19, 0xba, 0x86,
+  0x91, 0xb3, 0x21, 0x66, 0x79, 0x4b, 0xc4, 0x12, 0x0e, 0xed, 0x7d, 0x9b, 0x1b, 0x45, 0x33, 0x0c,
+  0xc7, 0x08, 0xc0, 0x1d, 0xe3, 0xef, 0x27, 0x35, 0x61, 0x72, 0xfe, 0xcb, 0xc9, 0xf9, 0x83, 0xe0,
+  0x83, 0x5b, 0xa6, 0x4d, 0x0e, 0xc2, 0x4c, 0xfe, 0x04, 0x72, 0x9b, 0x0e, 0x07, 0x3d, 0x31, 0xe4,
+  0xb7, 0x9e, 0x15, 0x5e, 0xcf, 0x87, 0x19, 0xcd, 0x87, 0x7d, 0xa6, 0x19, 0xf7, 0x0f, 0xca, 0x01,
+  0xa7, 0x28, 0x74, 0x80, 0xf5, 0x68, 0xcb, 0x40, 0xe3, 0x5f, 0xac, 0x71, 0xf4, 0x4f, 0xac, 0x11,
+  0x7a, 0x19, 0x0a, 0xac, 0xde, 0x2a, 0xb7, 0x61, 0x0d, 0x43, 0x4c, 0x1e, 0xbd, 0xc1, 0x17, 0x9e,
+  0x40, 0x95, 0xbd, 0x63, 0x2c, 0x76, 0xc0, 0xcf, 0x1c, 0x89, 0x0e, 0xad, 0xf4, 0xc0, 0x14, 0x29,
+  0x1a, 0xe5, 0x4e, 0x47, 0xdf, 0x3f, 0x49, 0x80, 0x92, 0xe1, 0xb9, 0xf1, 0x74, 0x9c, 0xaf, 0x10,
+  0x86, 0xf5, 0x26, 0x20, 0x5a, 0xec, 0x6f, 0xae, 0xaf, 0xae, 0xf6, 0xff, 0x36, 0x09, 0xdc, 0x41,
+  0x19, 0x71, 0xcf, 0x49, 0xf0, 0x4e, 0x95, 0xa5, 0xff, 0xf2, 0x1c, 0x50, 0xa5, 0xfc, 0xc0, 0xbc,
+  0xf0, 0xd0, 0xa1, 0xd6, 0xff, 0x90, 0x82, 0x7d, 0x7f, 0xc6, 0xd7, 0xcb, 0xc0, 0x30, 0xc3, 0xff,
+  0x3a, 0x01, 0xcf, 0x24, 0x9b, 0x43, 0xf0, 0x45, 0x6e, 0xfd, 0xa5, 0x26, 0x9c, 0xec, 0xea, 0x21,
+  0x58, 0x95, 0x1f, 0x85, 0x5a, 0x31, 0x1a, 0x65, 0x0c, 0x4a, 0xc5, 0xcb, 0xac, 0x8e, 0x63, 0x6d,
+  0x82, 0x2c, 0x97, 0xa3, 0x4e, 0xa3, 0x84, 0xa7, 0xba, 0x9d, 0x24, 0xa5, 0xb6, 0xb1, 0x21, 0x36,
+  0xc1, 0x07, 0x8f, 0x6f, 0x83, 0xbf, 0x35, 0xf5, 0xc4, 0xc1, 0x94, 0xcb, 0x8f, 0xd1, 0x05, 0x61,
+  0xdc, 0xfc, 0x86, 0x06, 0x26, 0xc0, 0x73, 0xd9, 0x06, 0xb6, 0x2c, 0xdd, 0x10, 0x89, 0x71, 0x29,
+  0xda, 0xc5, 0xdc, 0x9f, 0x17, 0x43, 0xf3, 0xb0, 0xf7, 0x18, 0x79, 0xce, 0x00, 0x13, 0xf4, 0x89,
+  0xd2, 0x56, 0xfd, 0xfa, 0x71, 0xf1, 0xfc, 0xf3, 0x11, 0x5e, 0x7e, 0x9b, 0x1f, 0x42, 0xe7, 0xa2,
+  0x51, 0x8e, 0x76, 0x67, 0x25, 0x52, 0x51, 0x2d, 0xce, 0xd3, 0xb1, 0xe9, 0xf9, 0x32, 0xe1, 0x79,
+  0xed, 0xa2, 0x81, 0x6c, 0x07, 0x4d, 0x12, 0x26, 0x58, 0x2c, 0xc7, 0xb5, 0x43, 0x58, 0xfb, 0x10,
+  0x3e, 0x4f, 0x38, 0xf8, 0xa8, 0x21, 0x03, 0x59, 0x17, 0xad, 0xe1, 0x77, 0x6f, 0x72, 0x8f, 0xf4,
+  0x56, 0x63, 0xb8, 0x7c, 0x7d, 0xba, 0x96, 0x8b, 0xf3, 0xb9, 0xdb, 0x65, 0x78, 0x42, 0x2c, 0x50,
+  0x2f, 0xb9, 0xa0, 0xef, 0xf6, 0x66, 0xf8, 0xb8, 0xe1, 0xe2, 0xc3, 0x25, 0xfc, 0xb1, 0xbc, 0x9c,
+  0x01, 0xb4, 0xea, 0xbf, 0x85, 0x30, 0x53, 0xf2, 0x39, 0x20, 0x98, 0xa0, 0x91, 0x0f, 0x76, 0x1d,
+  0x7f, 0xbb, 0xf4, 0x2f, 0xee, 0xfe, 0x9b, 0xee, 0x4f, 0x9b, 0xba, 0x21, 0x6a, 0xe4, 0x09, 0x00,
+  0x00,
+};
+
+const WebAsset WEB_ASSETS[] = {
+  {"/admin.html", "text/html", ASSET_0, 2579, "\"ef3712a28b1f7992\""},
+  {"/changepw.html", "text/html", ASSET_1, 967, "\"0550c0866bdff5c8\""},
+  {"/dashboard.html", "text/html", ASSET_2, 7895, "\"dc8efd003253e46d\""},
+  {"/forgot.html", "text/html", ASSET_3, 949, "\"f7af68d1a6cd4b5d\""},
+  {"/login.html", "text/html", ASSET_4, 529, "\"1229beeb2361e0ab\""},
+  {"/mqtt.html", "text/html", ASSET_5, 2874, "\"fdf6630d34c545d9\""},
+  {"/update.html", "text/html", ASSET_6, 1009, "\"0b71af60ce0346ca\""},
+};
+const size_t WEB_ASSET_COUNT = 7;
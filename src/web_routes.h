@@ -11,6 +11,11 @@
 #include "sequence_controller.h"
 #include "led_state.h"
 #include "log.h"
+#include "log_file.h"
+#include "log_stream.h"
+#include "file_stream.h"
+#include "web_assets.h"
+#include "background_jobs.h"
 #include "time_mapper.h"
 #include "ota_updater.h"
 #include "led_controller.h"
@@ -20,7 +25,12 @@
 #include "clothing_display.h"
 #include "mqtt_settings.h"
 #include "mqtt_client.h"
+#include "syslog_settings.h"
+#include "syslog_client.h"
 #include "weather_settings.h"
+#include "palette_settings.h"
+#include "night_dimming.h"
+#include "virtual_clock.h"
 #include "weather_client.h"
 #include "clothing_advisor.h"
 #include <math.h>
@@ -31,28 +41,92 @@ static constexpr const char* kFixedTimezone = "Europe/Amsterdam";
 
 // References to global variables
 extern WebServer server;
-extern String logBuffer[];
-extern int logIndex;
 extern bool clockEnabled;
 
-// Serve file, preferring a .gz variant if client accepts gzip
+// Built-in page straight from flash. The embedded copy is gzip; the rare
+// client without gzip support gets a copy inflated on the heap.
+static void serveEmbedded(const WebAsset& asset) {
+  const bool gzip = server.header("Accept-Encoding").indexOf("gzip") >= 0;
+  // The inflated copy is a different representation, so it gets its own tag
+  String etag = asset.etag;
+  if (!gzip) etag = etag.substring(0, etag.length() - 1) + "-plain\"";
+  server.sendHeader("Cache-Control", "private, no-cache");
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("If-None-Match") == etag) {
+    server.sendHeader("ETag", etag);
+    server.send(304);
+    return;
+  }
+  if (!gzip) {
+    size_t size = 0;
+    uint8_t* plain = webAssetInflate(asset, size);
+    if (!plain) {
+      server.sendHeader("Retry-After", "10");
+      server.send(503, "text/plain", "Out of memory, try again");
+      return;
+    }
+    server.sendHeader("ETag", etag);
+    server.send_P(200, asset.mime, (PGM_P)plain, size);
+    free(plain);
+    return;
+  }
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.mime, (PGM_P)asset.data, asset.size);
+}
+
+// Serve a UI page: the built-in copy unless the filesystem overrides it.
+// Files prefer a .gz variant if client accepts gzip. Pages are revalidated
+// on every visit; an unchanged page is answered with 304. A file is sent
+// from loop() by fileStreamLoop() and keeps an fsLock() hold until then,
+// so a UI sync job cannot replace it halfway.
 static void serveFile(const char* path, const char* mime) {
-  // Gzip temporarily disabled; always serve plain files
-  bool acceptGzip = false;
-  String gzPath = String(path) + ".gz";
-  if (acceptGzip) {
-    File gz = FS_IMPL.open(gzPath, "r");
-    if (gz) {
-      server.sendHeader("Content-Encoding", "gzip");
-      server.streamFile(gz, mime);
-      gz.close();
+  FsLock lock;
+  String filePath = path;
+  const WebAsset* asset = webAssetFind(path);
+  if (asset) {
+    if (!webAssetOverridden(path)) {
+      serveEmbedded(*asset);
       return;
     }
+    filePath = String(WEB_ASSET_OVERRIDE_DIR) + path;
   }
-  File f = FS_IMPL.open(path, "r");
+  const String gzPath = filePath + ".gz";
+  if (server.header("Accept-Encoding").indexOf("gzip") >= 0 && FS_IMPL.exists(gzPath)) {
+    filePath = gzPath;
+  }
+
+  const String cached = webAssetCachedEtag(filePath);
+  if (cached.length() && server.header("If-None-Match") == cached) {
+    server.sendHeader("Cache-Control", "private, no-cache");
+    server.sendHeader("Vary", "Accept-Encoding");
+    server.sendHeader("ETag", cached);
+    server.send(304);
+    return;
+  }
+  File f = FS_IMPL.open(filePath, "r");
   if (!f) { server.send(404, "text/plain", String(path) + " not found"); return; }
-  server.streamFile(f, mime);
-  f.close();
+  const String etag = webAssetEtag(filePath, f);
+  if (server.header("If-None-Match") == etag) {
+    f.close();
+    server.sendHeader("Cache-Control", "private, no-cache");
+    server.sendHeader("Vary", "Accept-Encoding");
+    server.sendHeader("ETag", etag);
+    server.send(304);
+    return;
+  }
+
+  String head = String("HTTP/1.1 200 OK\r\nContent-Type: ") + mime +
+                "\r\nCache-Control: private, no-cache\r\nVary: Accept-Encoding\r\nETag: " + etag + "\r\n";
+  if (filePath.endsWith(".gz")) head += "Content-Encoding: gzip\r\n";
+  fsLock();  // released by fsUnlock() once the page is sent
+  WiFiClient client = server.client();
+  if (!fileStreamAttach(client, head, &f, 1, fsUnlock)) {
+    fsUnlock();
+    f.close();
+    server.sendHeader("Retry-After", "5");
+    server.send(503, "text/plain", "Busy, try again");
+  }
 }
 // Simple Basic-Auth guard for admin resources
 static bool ensureAdminAuth() {
@@ -110,11 +184,63 @@ static String generateFactoryToken(unsigned long ttl_ms = 60000) {
   return g_factoryToken;
 }
 
+// Buffers small writes into ~1 KB chunks of a chunked response
+// (start with server.setContentLength(CONTENT_LENGTH_UNKNOWN))
+class ChunkedResponse {
+ public:
+  void write(const char* data, size_t len) {
+    while (len > 0) {
+      const size_t n = len < sizeof(buffer) - used ? len : sizeof(buffer) - used;
+      memcpy(buffer + used, data, n);
+      used += n;
+      data += n;
+      len -= n;
+      if (used == sizeof(buffer)) flush();
+    }
+  }
+  void write(const char* text) { write(text, strlen(text)); }
+  void flush() {
+    if (used > 0) server.sendContent(buffer, used);
+    used = 0;
+  }
+  // Sends the rest and the terminating empty chunk
+  void end() {
+    flush();
+    server.sendContent("");
+  }
+
+ private:
+  char buffer[1024];
+  size_t used = 0;
+};
+
+// 202 with the id of a started background job; its outcome is at /api/jobs?id=
+static void sendJobAccepted(uint32_t id) {
+  if (id == 0) {
+    server.sendHeader("Retry-After", "5");
+    server.send(503, "text/plain", "Too many background jobs");
+    return;
+  }
+  server.sendHeader("Location", String("/api/jobs?id=") + id);
+  server.send(202, "application/json", String("{\"job\":") + id + "}");
+}
+
+static void jobToJson(const JobStatus& job, JsonObject obj) {
+  obj["id"] = job.id;
+  obj["name"] = job.name;
+  obj["state"] = jobStateName(job.state);
+  obj["message"] = job.message;
+  const uint32_t end = job.finishedMs ? job.finishedMs : millis();
+  obj["elapsed_ms"] = end - job.startedMs;
+}
+
 // Function to register all routes
 void setupWebRoutes() {
-  // Capture Accept-Encoding so we can serve gzip if available
-  static const char* headerKeys[] = { "Accept-Encoding" };
-  server.collectHeaders(headerKeys, 1);
+  // Capture Accept-Encoding so we can serve gzip if available,
+  // If-None-Match for 304 revalidation of pages and
+  // Last-Event-ID so a reconnecting log tail resumes where it stopped
+  static const char* headerKeys[] = { "Accept-Encoding", "If-None-Match", "Last-Event-ID" };
+  server.collectHeaders(headerKeys, 3);
 
   // Helper defined at file scope: serveFile()
   // Main pages
@@ -223,14 +349,12 @@ void setupWebRoutes() {
 
   // Public landing page with links to Login (protected) and Forgot
   server.on("/", HTTP_GET, []() {
-    File f = FS_IMPL.open("/login.html", "r");
-    if (!f) {
+    if (!webAssetFind("/login.html") && !FS_IMPL.exists("/login.html")) {
       // Fallback: redirect to protected dashboard
       server.sendHeader("Location", "/dashboard.html", true);
       server.send(302, "text/plain", "");
       return;
     }
-    f.close();
     serveFile("/login.html", "text/html");
   });
 
@@ -416,6 +540,7 @@ void setupWebRoutes() {
   });
 
   // MQTT connection test (does not save). Accepts form-encoded: host, port, user?, pass?
+  // Broker reachability/credentials check, run as a background job (202 + job id)
   server.on("/api/mqtt/test", HTTP_POST, []() {
     if (!ensureUiAuth()) return;
     if (!server.hasArg("host") || !server.hasArg("port")) {
@@ -427,33 +552,89 @@ void setupWebRoutes() {
     String user = server.arg("user");
     String pass = server.arg("pass");
 
-    // Quick TCP reachability test
-    WiFiClient testClient;
-    testClient.setTimeout(3000);
-    if (!testClient.connect(host.c_str(), port)) {
-      server.send(502, "text/plain", "TCP connect failed");
+    const uint32_t id = jobStart("mqtt-test", [host, port, user, pass](String& message) {
+      // Quick TCP reachability test
+      WiFiClient testClient;
+      testClient.setTimeout(3000);
+      if (!testClient.connect(host.c_str(), port)) {
+        message = "TCP connect failed";
+        return false;
+      }
+      testClient.stop();
+
+      // Optional MQTT handshake if user provided
+      if (user.length() > 0 || pass.length() > 0) {
+        WiFiClient mc;
+        PubSubClient tmp(mc);
+        tmp.setServer(host.c_str(), port);
+        String cid = String("ciws_test_") + String(millis());
+        bool ok = tmp.connect(cid.c_str(), user.c_str(), pass.c_str());
+        if (!ok) {
+          message = String("MQTT auth failed (state ") + tmp.state() + ")";
+          return false;
+        }
+        tmp.disconnect();
+      }
+      message = "OK";
+      return true;
+    });
+    sendJobAccepted(id);
+  });
+
+  // Remote syslog (UDP), configured on the MQTT page
+  server.on("/api/syslog/config", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    SyslogSettings cfg;
+    syslog_settings_load(cfg);
+    JsonDocument doc;
+    doc["enabled"] = cfg.enabled;
+    doc["host"] = cfg.host;
+    doc["port"] = cfg.port;
+    doc["min_level"] = cfg.minLevel;
+    doc["batch"] = cfg.maxPerDatagram;
+    doc["rate"] = cfg.maxDatagramsPerSec;
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+  server.on("/api/syslog/config", HTTP_POST, []() {
+    if (!ensureUiAuth()) return;
+    SyslogSettings next;
+    syslog_settings_load(next);
+    if (server.hasArg("enabled")) next.enabled = server.arg("enabled") == "1" || server.arg("enabled") == "true";
+    if (server.hasArg("host")) next.host = server.arg("host");
+    if (server.hasArg("port")) next.port = (uint16_t)server.arg("port").toInt();
+    if (server.hasArg("min_level")) next.minLevel = (uint8_t)server.arg("min_level").toInt();
+    if (server.hasArg("batch")) next.maxPerDatagram = (uint8_t)server.arg("batch").toInt();
+    if (server.hasArg("rate")) next.maxDatagramsPerSec = (uint16_t)server.arg("rate").toInt();
+    next.host.trim();
+    if (next.enabled && (next.host.length() == 0 || next.port == 0)) {
+      server.send(400, "text/plain", "host/port required");
       return;
     }
-    testClient.stop();
-
-    // Optional MQTT handshake if user provided
-    if (user.length() > 0 || pass.length() > 0) {
-      WiFiClient mc;
-      PubSubClient tmp(mc);
-      tmp.setServer(host.c_str(), port);
-      String cid = String("ciws_test_") + String(millis());
-      bool ok = tmp.connect(cid.c_str(), user.c_str(), pass.c_str());
-      if (!ok) {
-        int st = tmp.state();
-        server.send(401, "text/plain", String("MQTT auth failed (state ") + st + ")");
-        return;
-      }
-      tmp.disconnect();
+    if (next.minLevel > LOG_LEVEL_ERROR || next.maxPerDatagram < 1 || next.maxPerDatagram > 32 ||
+        next.maxDatagramsPerSec < 1 || next.maxDatagramsPerSec > 100) {
+      server.send(400, "text/plain", "min_level 0-3, batch 1-32, rate 1-100");
+      return;
     }
-
+    syslog_apply_settings(next);
     server.send(200, "text/plain", "OK");
   });
 
+  server.on("/api/syslog/status", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    const SyslogStats st = syslog_stats();
+    JsonDocument doc;
+    doc["datagrams"] = st.datagrams;
+    doc["records"] = st.records;
+    doc["dropped"] = st.dropped;
+    doc["send_errors"] = st.sendErrors;
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
   // Auto update toggle
   server.on("/getAutoUpdate", []() {
     if (!ensureUiAuth()) return;
@@ -538,6 +719,7 @@ void setupWebRoutes() {
       server.send(400, "text/plain", "Invalid grid variant");
       return;
     }
+    clothingDisplayRequestRefresh();
 
     if (const GridVariantInfo* info = getGridVariantInfo(displaySettings.getGridVariant())) {
       logInfo(String("🧩 Grid variant updated to ") + info->label + " (" + info->key + ")");
@@ -559,16 +741,94 @@ void setupWebRoutes() {
   });
 
   // Fetch log
+  // Log records from seq `since` on (all when omitted), streamed. X-Log-Next is
+  // the since for the next poll; X-Log-First > since means records were evicted.
+  // 204 when there is nothing new.
   server.on("/log", []() {
     if (!ensureUiAuth()) return;
-    String logContent = "";
-    int i = logIndex;
-    for (int count = 0; count < LOG_BUFFER_SIZE; count++) {
-      String line = logBuffer[i];
-      if (line.length() > 0) logContent += line + "\n";
-      i = (i + 1) % LOG_BUFFER_SIZE;
+    LogCursor cursor;
+    if (server.hasArg("since")) cursor.seq = (uint32_t)strtoul(server.arg("since").c_str(), nullptr, 10);
+    const uint32_t end = logRingNextSeq();
+    if (cursor.seq > end) cursor.seq = 0;  // device restarted since the last poll
+    server.sendHeader("X-Log-First", String(logRingFirstSeq()));
+    server.sendHeader("X-Log-Next", String(end));
+    server.sendHeader("Cache-Control", "no-store");
+    if (cursor.seq == end) {
+      server.send(204);
+      return;
+    }
+
+    const bool binary = server.arg("format") == "bin";
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, binary ? "application/octet-stream" : "text/plain", "");
+    ChunkedResponse out;
+    LogEntry entry;
+    uint8_t payload[LOG_RECORD_MAX];
+    if (binary) {
+      // Raw records for tools/log_decode.py: magic, then per record
+      // seq, seconds, meta (millis | level << 10 | synced << 12 | binary << 13), length, payload
+      out.write("CIWSLOG1", 8);
+      while (logRingRead(cursor, entry, payload, sizeof(payload)) && entry.seq < end) {
+        const uint16_t length = entry.length < sizeof(payload) ? entry.length : sizeof(payload);
+        const uint16_t meta = (uint16_t)(entry.millis | (entry.level << 10) | (entry.synced ? 1u << 12 : 0) |
+                                         (entry.binary ? 1u << 13 : 0));
+        char header[12];
+        memcpy(header, &entry.seq, 4);
+        memcpy(header + 4, &entry.seconds, 4);
+        memcpy(header + 8, &meta, 2);
+        memcpy(header + 10, &length, 2);
+        out.write(header, sizeof(header));
+        out.write((const char*)payload, length);
+      }
+    } else {
+      char text[LOG_RECORD_MAX + 1];
+      char prefix[80];
+      while (logRingRead(cursor, entry, payload, sizeof(payload)) && entry.seq < end) {
+        out.write(prefix, logFormatPrefix(entry, prefix, sizeof(prefix)));
+        out.write(text, logFormatMessage(entry, payload, text, sizeof(text)));
+        out.write("\n", 1);
+      }
+    }
+    out.end();
+  });
+
+  // Live log tail (Server-Sent Events). The connection is handed to
+  // logStreamLoop(); Last-Event-ID or ?since= picks the first record.
+  server.on("/log/stream", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    // A reconnecting EventSource repeats the original URL, so its header wins
+    uint32_t since = 0;
+    if (server.hasHeader("Last-Event-ID")) {
+      since = (uint32_t)strtoul(server.header("Last-Event-ID").c_str(), nullptr, 10) + 1;
+    } else if (server.hasArg("since")) {
+      since = (uint32_t)strtoul(server.arg("since").c_str(), nullptr, 10);
+    }
+    WiFiClient client = server.client();
+    if (!logStreamAttach(client, since)) {
+      server.sendHeader("Retry-After", "10");
+      server.send(503, "text/plain", "Too many log viewers");
+    }
+  });
+
+  // Persisted log files (oldest first) as one text download, sent from
+  // loop() by fileStreamLoop(); rotation waits until it is done
+  server.on("/log/download", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    static_assert(LOG_FILE_COUNT <= FILE_STREAM_MAX_FILES, "one stream sends every log file");
+    logFileFlush();
+    File files[LOG_FILE_COUNT];
+    const uint8_t count = logFileOpenAll(files, LOG_FILE_COUNT);
+    WiFiClient client = server.client();
+    if (!fileStreamAttach(client,
+                          "HTTP/1.1 200 OK\r\n"
+                          "Content-Type: text/plain\r\n"
+                          "Content-Disposition: attachment; filename=\"ciws-log.txt\"\r\n",
+                          files, count, logFileRelease)) {
+      for (uint8_t i = 0; i < count; i++) files[i].close();
+      logFileRelease();
+      server.sendHeader("Retry-After", "10");
+      server.send(503, "text/plain", "Too many downloads");
     }
-    server.send(200, "text/plain", logContent);
   });
 
   // Get status
@@ -582,17 +842,8 @@ void setupWebRoutes() {
     if (!ensureUiAuth()) return;
     String state = server.arg("state");
     clockEnabled = (state == "on");
-    // Apply immediately
-    if (clockEnabled) {
-      struct tm timeinfo;
-      if (getLocalTime(&timeinfo)) {
-        auto indices = get_led_indices_for_time(&timeinfo);
-        showLeds(indices);
-      }
-    } else {
-      // Clear LEDs when turning off
-      showLeds({});
-    }
+    // Display loop redraws (or clears) on its next pass
+    clothingDisplayRequestRefresh();
     server.send(200, "text/plain", "OK");
   });
   
@@ -612,6 +863,7 @@ void setupWebRoutes() {
       </html>
     )rawliteral");
     delay(100);  // Small delay to finish the HTTP response
+    logFileFlush();
     ESP.restart();
   });
 
@@ -660,12 +912,8 @@ void setupWebRoutes() {
   
     ledState.setRGB(r, g, b);
   
-    // Refresh display immediately with new color
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
-      std::vector<uint16_t> indices = get_led_indices_for_time(&timeinfo);
-      showLeds(indices);
-    }
+    // Refresh display with the new color on the next loop pass
+    clothingDisplayRequestRefresh();
   
     server.send(200, "text/plain", "OK");
   });
@@ -682,13 +930,61 @@ void setupWebRoutes() {
   });
   
   
+  // Palette slots for per-word colours (slot 0 is the /setColor colour)
+  server.on("/api/palette", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    server.send(200, "application/json", paletteToJson());
+  });
+
+  server.on("/api/palette", HTTP_POST, []() {
+    if (!ensureUiAuth()) return;
+    if (!server.hasArg("slot") || !server.hasArg("color")) {
+      server.send(400, "text/plain", "slot and color are required");
+      return;
+    }
+    int slot = server.arg("slot").toInt();
+    int white = server.hasArg("white") ? constrain(server.arg("white").toInt(), 0, 255) : 0;
+    String err;
+    if (slot < 0 || !paletteSetFromHex((uint8_t)slot, server.arg("color"), (uint8_t)white, err)) {
+      server.send(400, "text/plain", err.length() ? err : String("Invalid slot"));
+      return;
+    }
+    clothingDisplayRequestRefresh();
+    mqtt_publish_state(true);
+    server.send(200, "application/json", paletteToJson());
+  });
+
+  // Optional ?name=startup|startup_fast|outfit|test; default follows the fast boot setting
   server.on("/startSequence", []() {
     if (!ensureUiAuth()) return;
-  logInfo("✨ Startup sequence started via dashboard");
-    extern StartupSequence startupSequence;
-    startupSequence.start();
+    const Sequence* seq = displaySettings.getFastBoot() ? &SEQUENCE_STARTUP_FAST : &SEQUENCE_STARTUP;
+    if (server.hasArg("name")) {
+      seq = findSequence(server.arg("name"));
+      if (!seq) {
+        server.send(400, "text/plain", "Unknown sequence");
+        return;
+      }
+    }
+    logInfo(String("✨ Sequence '") + seq->name + "' started via dashboard");
+    sequencePlayer.start(*seq);
     server.send(200, "text/plain", "Startup sequence executed");
   });
+
+  server.on("/getFastBoot", []() {
+    if (!ensureUiAuth()) return;
+    server.send(200, "text/plain", displaySettings.getFastBoot() ? "on" : "off");
+  });
+
+  server.on("/setFastBoot", []() {
+    if (!ensureUiAuth()) return;
+    if (!server.hasArg("state")) {
+      server.send(400, "text/plain", "Missing state");
+      return;
+    }
+    String state = server.arg("state");
+    displaySettings.setFastBoot(state == "on" || state == "1" || state == "true");
+    server.send(200, "text/plain", "OK");
+  });
   
   server.on(
     "/uploadFirmware",
@@ -698,6 +994,7 @@ void setupWebRoutes() {
       server.send(200, "text/plain", Update.hasError() ? "Firmware update failed" : "Firmware update successful. Rebooting...");
       if (!Update.hasError()) {
         delay(1000);
+        logFileFlush();
         ESP.restart();
       }
     },
@@ -773,9 +1070,30 @@ void setupWebRoutes() {
   server.on("/checkForUpdate", HTTP_ANY, []() {
     if (!ensureUiAuth()) return;
     logInfo("Firmware update manually started via UI");
-    server.send(200, "text/plain", "Firmware update started");
-    delay(100);
-    checkForFirmwareUpdate();
+    sendJobAccepted(startFirmwareUpdateJob());
+  });
+
+  // Background jobs: ?id= for one job, otherwise the recent ones (newest first)
+  server.on("/api/jobs", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    JsonDocument doc;
+    if (server.hasArg("id")) {
+      JobStatus job;
+      if (!jobGet((uint32_t)strtoul(server.arg("id").c_str(), nullptr, 10), job)) {
+        server.send(404, "text/plain", "Unknown job");
+        return;
+      }
+      jobToJson(job, doc.to<JsonObject>());
+    } else {
+      JobStatus jobs[JOB_SLOTS];
+      const size_t n = jobList(jobs, JOB_SLOTS);
+      JsonArray arr = doc.to<JsonArray>();
+      for (size_t i = 0; i < n; i++) jobToJson(jobs[i], arr.add<JsonObject>());
+    }
+    server.sendHeader("Cache-Control", "no-store");
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
   });
 
   server.on("/getBrightness", []() {
@@ -794,16 +1112,150 @@ void setupWebRoutes() {
     level = constrain(level, 0, 255);
     ledState.setBrightness(level);
   
-      // Apply to active LEDs
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
-      auto indices = get_led_indices_for_time(&timeinfo);
-      showLeds(indices);  // uses current color + new brightness
-    }
+    // Apply to active LEDs on the next loop pass
+    clothingDisplayRequestRefresh();
   
     server.send(200, "text/plain", "OK");
   });
 
+  // Virtual clock for demos and soak tests (runtime only)
+  server.on("/api/clock", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    JsonDocument doc;
+    doc["mode"] = clockModeName(clockMode());
+    doc["factor"] = clockFactor();
+    doc["epoch"] = (long)clockNow();
+    struct tm lt;
+    char buf[24];
+    if (clockLocalTime(&lt) && strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &lt)) doc["local"] = String(buf);
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+  // mode=real | offset (offset_s) | frozen (at?) | accelerated (factor, at?)
+  // at is epoch seconds or HH:MM today; defaults to the current virtual time
+  server.on("/api/clock", HTTP_POST, []() {
+    if (!ensureUiAuth()) return;
+    String mode = server.arg("mode");
+    time_t at = 0;
+    if (server.hasArg("at")) {
+      String a = server.arg("at");
+      int hh, mm;
+      struct tm lt;
+      if (sscanf(a.c_str(), "%d:%d", &hh, &mm) == 2 && clockLocalTime(&lt)) {
+        lt.tm_hour = hh;
+        lt.tm_min = mm;
+        lt.tm_sec = 0;
+        lt.tm_isdst = -1;
+        at = mktime(&lt);
+      } else {
+        at = (time_t)a.toInt();
+      }
+    }
+    if (mode == "real") {
+      clockSetReal();
+    } else if (mode == "offset") {
+      clockSetOffset(server.arg("offset_s").toInt());
+    } else if (mode == "frozen") {
+      clockFreeze(at);
+    } else if (mode == "accelerated") {
+      const long factor = server.hasArg("factor") ? server.arg("factor").toInt() : 1440;
+      clockAccelerate((uint16_t)constrain(factor, 1, 10000), at);
+    } else {
+      server.send(400, "text/plain", "mode must be real, offset, frozen or accelerated");
+      return;
+    }
+    logInfo(String("🕰️ Virtual clock: ") + clockModeName(clockMode()) + " x" + clockFactor());
+    clothingDisplayRequestRefresh();
+    server.send(200, "text/plain", "OK");
+  });
+
+  // Night dimming: day level is /setBrightness, night level and ramp live here
+  server.on("/api/nightdim", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    JsonDocument doc;
+    doc["enabled"] = nightDimSettings.isEnabled();
+    doc["day_brightness"] = ledState.getBrightness();
+    doc["night_brightness"] = nightDimSettings.getNightBrightness();
+    doc["ramp_minutes"] = nightDimSettings.getRampMinutes();
+    doc["current_brightness"] = nightDimBrightness(ledState.getBrightness());
+    time_t sunrise, sunset;
+    if (nightDimSunTimes(sunrise, sunset)) {
+      struct tm lt;
+      char buf[8];
+      if (localtime_r(&sunrise, &lt) && strftime(buf, sizeof(buf), "%H:%M", &lt)) doc["sunrise"] = String(buf);
+      if (localtime_r(&sunset, &lt) && strftime(buf, sizeof(buf), "%H:%M", &lt)) doc["sunset"] = String(buf);
+    }
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
+  server.on("/api/nightdim", HTTP_POST, []() {
+    if (!ensureUiAuth()) return;
+    if (server.hasArg("enabled")) {
+      String v = server.arg("enabled");
+      nightDimSettings.setEnabled(v == "1" || v == "true" || v == "on");
+    }
+    if (server.hasArg("night_brightness")) {
+      nightDimSettings.setNightBrightness(constrain(server.arg("night_brightness").toInt(), 0, 255));
+    }
+    if (server.hasArg("ramp_minutes")) {
+      nightDimSettings.setRampMinutes(constrain(server.arg("ramp_minutes").toInt(), 0, 240));
+    }
+    clothingDisplayRequestRefresh();
+    server.send(200, "text/plain", "OK");
+  });
+
+  server.on("/getPowerBudget", []() {
+    if (!ensureUiAuth()) return;
+    server.send(200, "text/plain", String(ledState.getPowerBudgetMa()));
+  });
+
+  // Supply budget in mA for the LED current limiter (0 = unlimited)
+  server.on("/setPowerBudget", []() {
+    if (!ensureUiAuth()) return;
+    if (!server.hasArg("ma")) {
+      server.send(400, "text/plain", "Missing power budget");
+      return;
+    }
+    int ma = server.arg("ma").toInt();
+    ma = constrain(ma, 0, 10000);
+    ledState.setPowerBudgetMa(ma);
+    clothingDisplayRequestRefresh();
+    server.send(200, "text/plain", "OK");
+  });
+
+  // Runtime metrics: LED current estimate, limiter and display counters
+  server.on("/api/metrics", HTTP_GET, []() {
+    if (!ensureUiAuth()) return;
+    const LedPowerStats power = ledPowerStats();
+    JsonDocument doc;
+    doc["uptime_ms"] = millis();
+    doc["heap_free"] = ESP.getFreeHeap();
+    JsonObject led = doc["led"].to<JsonObject>();
+    led["estimated_ma"] = power.estimatedMa;
+    led["requested_ma"] = power.requestedMa;
+    led["peak_ma"] = power.peakMa;
+    led["budget_ma"] = power.budgetMa;
+    led["limited"] = power.limited;
+    led["throttle_events"] = power.throttleEvents;
+    led["frames_shown"] = ledFramesShown();
+    led["frames_skipped"] = ledFramesSkipped();
+    JsonObject display = doc["display"].to<JsonObject>();
+    display["wakeups_last_minute"] = clothingDisplayWakeupsLastMinute();
+    const LogFileStats files = logFileStats();
+    JsonObject logFile = doc["log_file"].to<JsonObject>();
+    logFile["writes"] = files.writes;
+    logFile["bytes_written"] = files.bytesWritten;
+    logFile["rotations"] = files.rotations;
+    logFile["lost_records"] = files.lostRecords;
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+  });
+
   // Expose firmware version
   server.on("/version", []() {
     if (!ensureUiAuth()) return;
@@ -836,7 +1288,7 @@ void setupWebRoutes() {
       t.tm_hour = 10;
       t.tm_min = 47;
     } else {
-      if (!getLocalTime(&t)) { server.send(200, "text/plain", "OK"); return; }
+      if (!clockLocalTime(&t)) { server.send(200, "text/plain", "OK"); return; }
     }
     clothingDisplayForceAnimationForTime(&t);
   logInfo(String("🛒 Sell time ") + (on ? "ON (10:47)" : "OFF"));
@@ -857,10 +1309,35 @@ void setupWebRoutes() {
     String st = server.arg("state");
     bool on = (st == "on" || st == "1" || st == "true");
     displaySettings.setAnimateWords(on);
+    clothingDisplayRequestRefresh();
   logInfo(String("🎞️ Animation ") + (on ? "ON" : "OFF"));
     server.send(200, "text/plain", "OK");
   });
 
+  // Phrase transition style used when animation is on
+  static const char* const ANIMATION_STYLE_NAMES[ANIMATION_STYLE_COUNT] = { "words", "fade", "crossfade", "wipe" };
+  server.on("/getAnimationStyle", []() {
+    if (!ensureUiAuth()) return;
+    server.send(200, "text/plain", ANIMATION_STYLE_NAMES[static_cast<uint8_t>(displaySettings.getAnimationStyle())]);
+  });
+  server.on("/setAnimationStyle", []() {
+    if (!ensureUiAuth()) return;
+    if (!server.hasArg("style")) {
+      server.send(400, "text/plain", "Missing style");
+      return;
+    }
+    String st = server.arg("style");
+    for (uint8_t i = 0; i < ANIMATION_STYLE_COUNT; ++i) {
+      if (st == ANIMATION_STYLE_NAMES[i]) {
+        displaySettings.setAnimationStyle(static_cast<AnimationStyle>(i));
+  logInfo(String("🎞️ Animation style ") + st);
+        server.send(200, "text/plain", "OK");
+        return;
+      }
+    }
+    server.send(400, "text/plain", "Invalid style");
+  });
+
   // Het Is duration (0..360 seconds; 0=never, 360=always)
   server.on("/getHetIsDuration", []() {
     if (!ensureUiAuth()) return;
@@ -876,6 +1353,7 @@ void setupWebRoutes() {
     int val = server.arg("seconds").toInt();
     if (val < 0) val = 0; if (val > 360) val = 360;
     displaySettings.setHetIsDurationSec((uint16_t)val);
+    clothingDisplayRequestRefresh();
   logInfo("⏱️ HET IS duration set to " + String(val) + "s");
     server.send(200, "text/plain", "OK");
   });
@@ -1,6 +1,18 @@
 #pragma once
 
+#include <stdint.h>
+
 struct WordPosition {
   const char* word;
   int indices[20];
 };
+
+// Phrase programs are generated per grid variant by tools/grid_compiler.py
+// from the language grammar (layouts/lang/*.grammar). Each byte is one word:
+// values below PHRASE_OP_HOUR index the variant's word table,
+// PHRASE_OP_HOUR | n selects the hour word n hours ahead and PHRASE_OP_END
+// terminates the phrase of a 5-minute bucket.
+constexpr uint8_t PHRASE_BUCKET_COUNT = 12;
+constexpr uint8_t PHRASE_OP_HOUR = 0x80;
+constexpr uint8_t PHRASE_OP_HOUR_MASK = 0x0F;
+constexpr uint8_t PHRASE_OP_END = 0xFF;
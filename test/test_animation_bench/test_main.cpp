@@ -0,0 +1,102 @@
+// Per-frame CPU cost of the keyframe transitions at 60 fps for all NUM_LEDS
+// LEDs: Timeline::render(), levels to packed colours and a VirtualLedSink
+// frame, i.e. the render path minus the strip. Prints microseconds per frame
+// and fails only when a frame would take a whole 60 fps budget.
+//
+// Run with: pio test -e native -f test_animation_bench -v
+#include <chrono>
+#include <stdio.h>
+#include <time.h>
+#include <unity.h>
+#include <vector>
+#include "animation.h"
+#include "config.h"
+#include "grid_layout.h"
+#include "time_mapper.h"
+#include "virtual_led_sink.h"
+
+static const uint32_t FRAME_MS = 16;           // ANIMATION_FRAME_MS in clothing_display.cpp
+static const uint32_t FRAME_BUDGET_US = 16667;
+static const int FRAMES = 60 * 60;             // one minute of animation
+
+static std::vector<uint16_t> from;
+static std::vector<uint16_t> to;
+static std::vector<std::vector<uint16_t>> toWords;
+
+static std::vector<uint16_t> ledsForTime(int hour, int minute) {
+  struct tm t = {};
+  t.tm_hour = hour;
+  t.tm_min = minute;
+  return get_led_indices_for_time(&t);
+}
+
+void setUp() {
+  setActiveGridVariant(GridVariant::NL_V1);
+  from = ledsForTime(10, 44);
+  to = ledsForTime(10, 45);
+  struct tm t = {};
+  t.tm_hour = 10;
+  t.tm_min = 45;
+  toWords = get_word_segments_for_time(&t);
+}
+
+void tearDown() {}
+
+// Renders FRAMES frames of `tl` (looping) and returns the mean cost in µs
+static double benchmark(const char* name, const Timeline& tl) {
+  VirtualLedSink sink(0);
+  uint8_t levels[NUM_LEDS];
+  uint32_t pixels[NUM_LEDS];
+  const auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < FRAMES; ++f) {
+    tl.render((f * FRAME_MS) % (tl.durationMs() + 1), levels, NUM_LEDS);
+    for (uint16_t i = 0; i < NUM_LEDS; ++i) {
+      pixels[i] = (uint32_t)levels[i] << 24;  // white channel
+    }
+    sink.show(pixels, NUM_LEDS);
+  }
+  const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / FRAMES;
+  TEST_ASSERT_EQUAL_UINT32(FRAMES, sink.frameCount());
+
+  char line[96];
+  snprintf(line, sizeof(line), "%-14s %6.2f us/frame (%.3f%% of a 60 fps frame, %d LEDs)",
+           name, us, us * 100.0 / FRAME_BUDGET_US, NUM_LEDS);
+  TEST_MESSAGE(line);
+  return us;
+}
+
+void test_word_fade_in() {
+  Timeline tl;
+  buildWordFadeIn(tl, toWords, 500, 400);
+  TEST_ASSERT_LESS_THAN(FRAME_BUDGET_US, benchmark("fade", tl));
+}
+
+void test_crossfade() {
+  Timeline tl;
+  buildCrossfade(tl, from, to, 1200);
+  TEST_ASSERT_LESS_THAN(FRAME_BUDGET_US, benchmark("crossfade", tl));
+}
+
+void test_wipe() {
+  Timeline tl;
+  buildWipe(tl, from, to, 1200);
+  TEST_ASSERT_LESS_THAN(FRAME_BUDGET_US, benchmark("wipe", tl));
+}
+
+// Worst case: every LED has its own fading track
+void test_crossfade_all_leds() {
+  std::vector<uint16_t> all;
+  for (uint16_t i = 0; i < NUM_LEDS; ++i) all.push_back(i);
+  Timeline tl;
+  buildCrossfade(tl, all, std::vector<uint16_t>(), 1200);
+  TEST_ASSERT_LESS_THAN(FRAME_BUDGET_US, benchmark("crossfade-all", tl));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_word_fade_in);
+  RUN_TEST(test_crossfade);
+  RUN_TEST(test_wipe);
+  RUN_TEST(test_crossfade_all_leds);
+  return UNITY_END();
+}
@@ -0,0 +1,274 @@
+// Golden frames: the clock face every grid variant shows at a few times,
+// rendered through the render path's VirtualLedSink. A change in a layout,
+// grammar or the phrase interpreter shows up here as a picture diff.
+//
+// Run with: pio test -e native -f test_golden_frames
+#include <time.h>
+#include <unity.h>
+#include <vector>
+#include "config.h"
+#include "grid_layout.h"
+#include "time_mapper.h"
+#include "virtual_led_sink.h"
+
+struct GoldenFrame {
+  GridVariant variant;
+  int hour;
+  int minute;
+  const char* ascii;
+};
+
+static const GoldenFrame GOLDEN[] = {
+  { GridVariant::NL_V1, 12, 0,
+    "HET.IS.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "TWAALF.....\n"
+    "...........\n"
+    "........UUR\n"
+    "...........\n" },
+  { GridVariant::NL_V1, 14, 25,
+    "HET.IS.....\n"
+    "........H..\n"
+    "VIJF....A..\n"
+    "........L..\n"
+    "...VOOR.F..\n"
+    "DRIE.......\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n" },
+  { GridVariant::NL_V1, 9, 47,
+    "HET.IS.....\n"
+    "...........\n"
+    "......KWART\n"
+    "...........\n"
+    "...VOOR....\n"
+    "...........\n"
+    "..TIEN.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "..o.o......\n" },
+  { GridVariant::NL_V2, 12, 0,
+    "HET.IS.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "TWAALF.....\n"
+    "...........\n"
+    "........UUR\n"
+    "...........\n" },
+  { GridVariant::NL_V2, 14, 25,
+    "HET.IS.....\n"
+    "........H..\n"
+    "VIJF....A..\n"
+    "........L..\n"
+    "...VOOR.F..\n"
+    "DRIE.......\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n" },
+  { GridVariant::NL_V2, 9, 47,
+    "HET.IS.....\n"
+    "...........\n"
+    "......KWART\n"
+    "...........\n"
+    "...VOOR....\n"
+    "...........\n"
+    "..TIEN.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "..o.o......\n" },
+  { GridVariant::NL_V3, 12, 0,
+    "HET.IS.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "TWAALF.....\n"
+    "...........\n"
+    "........UUR\n"
+    "...........\n" },
+  { GridVariant::NL_V3, 14, 25,
+    "HET.IS.....\n"
+    "........H..\n"
+    "VIJF....A..\n"
+    "........L..\n"
+    "...VOOR.F..\n"
+    "DRIE.......\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n" },
+  { GridVariant::NL_V3, 9, 47,
+    "HET.IS.....\n"
+    "...........\n"
+    "......KWART\n"
+    "...........\n"
+    "...VOOR....\n"
+    "...........\n"
+    "..TIEN.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "..o.o......\n" },
+  { GridVariant::NL_V4, 12, 0,
+    "HET.IS.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "TWAALF.....\n"
+    "...........\n"
+    "........UUR\n"
+    "...........\n" },
+  { GridVariant::NL_V4, 14, 25,
+    "HET.IS.....\n"
+    "........H..\n"
+    "VIJF....A..\n"
+    "........L..\n"
+    "...VOOR.F..\n"
+    "DRIE.......\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n" },
+  { GridVariant::NL_V4, 9, 47,
+    "HET.IS.....\n"
+    "...........\n"
+    "......KWART\n"
+    "...........\n"
+    "...VOOR....\n"
+    "...........\n"
+    "..TIEN.....\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "..o.o......\n" },
+  { GridVariant::EN_V1, 12, 0,
+    "IT.IS......\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    ".....TWELVE\n"
+    ".....OCLOCK\n"
+    "...........\n" },
+  { GridVariant::EN_V1, 14, 25,
+    "IT.IS......\n"
+    "...........\n"
+    "TWENTYFIVE.\n"
+    "...........\n"
+    "PAST.......\n"
+    "...........\n"
+    "........TWO\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n" },
+  { GridVariant::EN_V1, 9, 47,
+    "IT.IS......\n"
+    "..QUARTER..\n"
+    "...........\n"
+    ".........TO\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "...........\n"
+    "TEN........\n"
+    "..o.o......\n" },
+};
+
+static uint32_t fakeNowMs = 0;
+
+void setUp() {
+  fakeNowMs = 0;
+  setActiveGridVariant(GridVariant::NL_V1);
+}
+
+void tearDown() {}
+
+// Lights the LEDs of `hour:minute` in white and returns the recorded frame as ASCII
+static std::string renderTime(VirtualLedSink& sink, int hour, int minute) {
+  struct tm t = {};
+  t.tm_hour = hour;
+  t.tm_min = minute;
+  std::vector<uint32_t> pixels(NUM_LEDS, 0);
+  for (uint16_t led : get_led_indices_for_time(&t)) {
+    if (led < NUM_LEDS) pixels[led] = 0xFF000000;
+  }
+  sink.show(pixels.data(), NUM_LEDS);
+  return VirtualLedSink::renderAscii(sink.frames().back());
+}
+
+static void checkVariant(GridVariant variant) {
+  TEST_ASSERT_TRUE(setActiveGridVariant(variant));
+  VirtualLedSink sink;
+  int checked = 0;
+  for (const GoldenFrame& g : GOLDEN) {
+    if (g.variant != variant) continue;
+    char label[32];
+    snprintf(label, sizeof(label), "%s %02d:%02d", getGridVariantInfo(variant)->key, g.hour, g.minute);
+    const std::string ascii = renderTime(sink, g.hour, g.minute);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(g.ascii, ascii.c_str(), label);
+    checked++;
+  }
+  TEST_ASSERT_GREATER_THAN(0, checked);
+}
+
+void test_golden_nl_v1() { checkVariant(GridVariant::NL_V1); }
+void test_golden_nl_v2() { checkVariant(GridVariant::NL_V2); }
+void test_golden_nl_v3() { checkVariant(GridVariant::NL_V3); }
+void test_golden_nl_v4() { checkVariant(GridVariant::NL_V4); }
+void test_golden_en_v1() { checkVariant(GridVariant::EN_V1); }
+
+// Frames carry the injected clock's time and the newest maxFrames are kept
+void test_frames_use_injected_clock() {
+  VirtualLedSink sink(2, [] { return fakeNowMs; });
+  const uint32_t pixels[NUM_LEDS] = {};
+  for (uint32_t t : { 100u, 250u, 400u }) {
+    fakeNowMs = t;
+    sink.show(pixels, NUM_LEDS);
+  }
+  TEST_ASSERT_EQUAL_UINT32(3, sink.frameCount());
+  TEST_ASSERT_EQUAL(2, sink.frames().size());
+  TEST_ASSERT_EQUAL_UINT32(250, sink.frames()[0].atMs);
+  TEST_ASSERT_EQUAL_UINT32(400, sink.frames()[1].atMs);
+
+  VirtualLedSink unclocked;
+  unclocked.show(pixels, NUM_LEDS);
+  TEST_ASSERT_EQUAL_UINT32(0, unclocked.frames()[0].atMs);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_golden_nl_v1);
+  RUN_TEST(test_golden_nl_v2);
+  RUN_TEST(test_golden_nl_v3);
+  RUN_TEST(test_golden_nl_v4);
+  RUN_TEST(test_golden_en_v1);
+  RUN_TEST(test_frames_use_injected_clock);
+  return UNITY_END();
+}
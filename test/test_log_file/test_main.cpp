@@ -0,0 +1,232 @@
+// LogFileSink batching, rotation (and holding it off) and lost-record
+// accounting, with the real log ring and an in-memory LogFileStore instead
+// of flash.
+//
+// Run with: pio test -e native -f test_log_file
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include "config.h"
+#include "log_file.h"
+#include "log_ring.h"
+#include "log_text.h"
+
+// Generation 0 is the current file, like FlashLogFileStore
+class MemoryLogFileStore : public LogFileStore {
+public:
+  std::deque<std::string> files;
+  std::vector<size_t> writes;
+  uint32_t rotations = 0;
+  bool held = false;
+
+  MemoryLogFileStore() { reset(); }
+
+  void reset() {
+    files.assign(1, std::string());
+    writes.clear();
+    rotations = 0;
+    held = false;
+  }
+
+  size_t currentSize() override { return files[0].size(); }
+
+  bool append(const char* data, size_t len) override {
+    files[0].append(data, len);
+    writes.push_back(len);
+    return true;
+  }
+
+  bool rotate() override {
+    if (held) return false;
+    files.push_front(std::string());
+    if (files.size() > LOG_FILE_COUNT) files.pop_back();
+    rotations++;
+    return true;
+  }
+
+  // All files, oldest first
+  std::string all() const {
+    std::string out;
+    for (auto it = files.rbegin(); it != files.rend(); ++it) out += *it;
+    return out;
+  }
+};
+
+static void appendLine(int level, const char* fmt, unsigned n) {
+  char text[LOG_RECORD_MAX];
+  const int len = snprintf(text, sizeof(text), fmt, n);
+  LogEntry entry = {};
+  entry.seconds = n;
+  entry.level = (uint8_t)level;
+  entry.length = (uint16_t)len;
+  logRingAppend(entry, text, (size_t)len);
+}
+
+// The ring is shared by all tests: a new sink first copies what earlier
+// tests left behind, then starts from an empty store
+static void catchUp(LogFileSink& sink, MemoryLogFileStore& store, LogFileStats& base) {
+  sink.poll(0);
+  sink.flush();
+  store.reset();
+  base = sink.stats();
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_small_batches_wait_for_the_flush_interval() {
+  MemoryLogFileStore store;
+  LogFileSink sink(store);
+  LogFileStats base;
+  catchUp(sink, store, base);
+
+  for (unsigned i = 0; i < 10; i++) appendLine(LOG_LEVEL_DEBUG, "display tick %u", i);
+  sink.poll(500);
+  TEST_ASSERT_EQUAL(0, store.writes.size());
+
+  sink.poll(500 + LOG_FILE_FLUSH_MS);
+  TEST_ASSERT_EQUAL(1, store.writes.size());
+  TEST_ASSERT_TRUE(store.files[0].find("display tick 0\n") != std::string::npos);
+  TEST_ASSERT_TRUE(store.files[0].find("display tick 9\n") != std::string::npos);
+
+  // A warning is written at the next poll, together with the debug line before it
+  appendLine(LOG_LEVEL_DEBUG, "before the warning %u", 1);
+  appendLine(LOG_LEVEL_WARN, "MQTT reconnect failed, retry %u", 2);
+  sink.poll(1000 + LOG_FILE_FLUSH_MS);
+  TEST_ASSERT_EQUAL(2, store.writes.size());
+  TEST_ASSERT_TRUE(store.files[0].find("[WARN] MQTT reconnect failed, retry 2\n") != std::string::npos);
+}
+
+void test_bursts_are_written_in_full_chunks() {
+  MemoryLogFileStore store;
+  LogFileSink sink(store);
+  LogFileStats base;
+  catchUp(sink, store, base);
+
+  // About 6 KB of text, well inside the ring
+  const unsigned lines = 100;
+  for (unsigned i = 0; i < lines; i++) appendLine(LOG_LEVEL_DEBUG, "burst line %03u with some padding text", i);
+  sink.poll(100);
+  TEST_ASSERT_GREATER_THAN(1, store.writes.size());
+  for (size_t w : store.writes) {
+    TEST_ASSERT_LESS_OR_EQUAL(LOG_FILE_CHUNK, w);
+    TEST_ASSERT_GREATER_THAN(LOG_FILE_CHUNK - 128, w);  // less than one line short
+  }
+
+  const size_t fullWrites = store.writes.size();
+  sink.flush();
+  TEST_ASSERT_EQUAL(fullWrites + 1, store.writes.size());
+  const LogFileStats stats = sink.stats();
+  TEST_ASSERT_EQUAL_UINT32(store.writes.size(), stats.writes - base.writes);
+  TEST_ASSERT_EQUAL_UINT32(store.files[0].size(), stats.bytesWritten - base.bytesWritten);
+  TEST_ASSERT_EQUAL_UINT32(base.lostRecords, stats.lostRecords);
+}
+
+void test_rotates_at_the_size_limit() {
+  const size_t maxBytes = 3000;
+  MemoryLogFileStore store;
+  LogFileSink sink(store, maxBytes);
+  LogFileStats base;
+  catchUp(sink, store, base);
+
+  unsigned next = 0;
+  for (int round = 0; round < 40; round++) {
+    for (int i = 0; i < 20; i++, next++) appendLine(LOG_LEVEL_INFO, "record %05u", next);
+    sink.poll(0);
+    sink.flush();
+  }
+
+  TEST_ASSERT_GREATER_THAN(LOG_FILE_COUNT, store.rotations);
+  TEST_ASSERT_EQUAL_UINT32(store.rotations, sink.stats().rotations - base.rotations);
+  TEST_ASSERT_EQUAL(LOG_FILE_COUNT, store.files.size());
+  for (const std::string& f : store.files) {
+    TEST_ASSERT_LESS_OR_EQUAL(maxBytes, f.size());
+  }
+
+  // The kept files hold one unbroken run of records ending with the newest
+  const std::string all = store.all();
+  unsigned expected = 0;
+  bool first = true;
+  size_t pos = 0;
+  while ((pos = all.find("record ", pos)) != std::string::npos) {
+    const unsigned n = (unsigned)strtoul(all.c_str() + pos + 7, nullptr, 10);
+    if (!first) TEST_ASSERT_EQUAL_UINT32(expected, n);
+    expected = n + 1;
+    first = false;
+    pos += 7;
+  }
+  TEST_ASSERT_EQUAL_UINT32(next, expected);
+}
+
+void test_held_rotation_appends_to_the_current_file() {
+  const size_t maxBytes = 3000;
+  MemoryLogFileStore store;
+  LogFileSink sink(store, maxBytes);
+  LogFileStats base;
+  catchUp(sink, store, base);
+
+  // A download holds the files: nothing is renamed, nothing is dropped
+  store.held = true;
+  unsigned next = 0;
+  for (int round = 0; round < 10; round++) {
+    for (int i = 0; i < 20; i++, next++) appendLine(LOG_LEVEL_INFO, "held %05u", next);
+    sink.poll(0);
+    sink.flush();
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, store.rotations);
+  TEST_ASSERT_EQUAL_UINT32(base.rotations, sink.stats().rotations);
+  TEST_ASSERT_GREATER_THAN(maxBytes, store.files[0].size());
+  char newest[32];
+  snprintf(newest, sizeof(newest), "held %05u", next - 1);
+  TEST_ASSERT_TRUE(store.files[0].find(newest) != std::string::npos);
+
+  // Released: the next batch starts a new file
+  store.held = false;
+  appendLine(LOG_LEVEL_INFO, "released %u", 1);
+  sink.poll(0);
+  sink.flush();
+  TEST_ASSERT_EQUAL_UINT32(1, store.rotations);
+  TEST_ASSERT_EQUAL_UINT32(1, sink.stats().rotations - base.rotations);
+  TEST_ASSERT_TRUE(store.files[1].find(newest) != std::string::npos);
+  TEST_ASSERT_TRUE(store.files[0].find("released 1") != std::string::npos);
+}
+
+void test_counts_records_lost_from_the_ring() {
+  MemoryLogFileStore store;
+  LogFileSink sink(store);
+  LogFileStats base;
+  catchUp(sink, store, base);
+
+  // Far more than the arena holds between two polls
+  const uint32_t firstNew = logRingNextSeq();
+  for (unsigned i = 0; i < 400; i++) appendLine(LOG_LEVEL_DEBUG, "flood %04u ..................................................", i);
+  const uint32_t lost = logRingFirstSeq() - firstNew;
+  TEST_ASSERT_GREATER_THAN(0, lost);
+
+  sink.poll(0);
+  sink.flush();
+  TEST_ASSERT_EQUAL_UINT32(lost, sink.stats().lostRecords - base.lostRecords);
+  char marker[64];
+  snprintf(marker, sizeof(marker), "... %lu log records lost ...\n", (unsigned long)lost);
+  TEST_ASSERT_TRUE(store.all().find(marker) != std::string::npos);
+  TEST_ASSERT_TRUE(store.all().find("flood 0399") != std::string::npos);
+
+  // Keeping up again adds nothing
+  appendLine(LOG_LEVEL_INFO, "calm %u", 1);
+  sink.poll(0);
+  sink.flush();
+  TEST_ASSERT_EQUAL_UINT32(lost, sink.stats().lostRecords - base.lostRecords);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_small_batches_wait_for_the_flush_interval);
+  RUN_TEST(test_bursts_are_written_in_full_chunks);
+  RUN_TEST(test_rotates_at_the_size_limit);
+  RUN_TEST(test_held_rotation_appends_to_the_current_file);
+  RUN_TEST(test_counts_records_lost_from_the_ring);
+  return UNITY_END();
+}
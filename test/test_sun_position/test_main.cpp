@@ -0,0 +1,85 @@
+// computeSunTimes() against published sunrise/sunset tables (NOAA solar
+// calculator, rounded to the minute, local clock time).
+//
+// Run with: pio test -e native -f test_sun_position
+#include <unity.h>
+#include "sun_position.h"
+
+// Outside the polar circles the approximation is within about a minute
+static const int TOLERANCE_MIN = 2;
+
+struct SunReference {
+  const char* place;
+  float lat;
+  float lon;
+  int year;
+  int dayOfYear;
+  int utcOffsetMin;  // local clock time of the table
+  int sunrise;       // local minutes after midnight
+  int sunset;
+};
+
+static int hm(int h, int m) { return h * 60 + m; }
+
+static const SunReference REFERENCES[] = {
+  { "Amsterdam 2024-06-21", 52.37f, 4.90f, 2024, 173, 120, hm(5, 18), hm(22, 6) },
+  { "Amsterdam 2024-12-21", 52.37f, 4.90f, 2024, 356, 60, hm(8, 48), hm(16, 29) },
+  { "London 2024-06-21", 51.5074f, -0.1278f, 2024, 173, 60, hm(4, 43), hm(21, 21) },
+  { "London 2024-12-21", 51.5074f, -0.1278f, 2024, 356, 0, hm(8, 3), hm(15, 53) },
+  { "New York 2024-06-20", 40.7128f, -74.006f, 2024, 172, -240, hm(5, 25), hm(20, 31) },
+  { "Sydney 2024-12-21", -33.8688f, 151.2093f, 2024, 356, 660, hm(5, 41), hm(20, 5) },
+  { "Tokyo 2024-06-21", 35.6762f, 139.6503f, 2024, 173, 540, hm(4, 25), hm(19, 0) },
+  { "Los Angeles 2024-06-21", 34.0522f, -118.2437f, 2024, 173, -420, hm(5, 42), hm(20, 8) },
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_matches_reference_tables() {
+  for (const SunReference& r : REFERENCES) {
+    const SunTimes t = computeSunTimes(r.lat, r.lon, r.year, r.dayOfYear);
+    TEST_ASSERT_EQUAL_INT_MESSAGE((int)SunState::NORMAL, (int)t.state, r.place);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(TOLERANCE_MIN, r.sunrise, t.sunriseMin + r.utcOffsetMin, r.place);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(TOLERANCE_MIN, r.sunset, t.sunsetMin + r.utcOffsetMin, r.place);
+  }
+}
+
+// East of Greenwich the UTC sunrise falls on the previous day, far west the
+// sunset on the next one; the times are not wrapped into 0..1440
+void test_times_outside_the_utc_day() {
+  const SunTimes tokyo = computeSunTimes(35.6762f, 139.6503f, 2024, 173);
+  TEST_ASSERT_LESS_THAN(0, tokyo.sunriseMin);
+  TEST_ASSERT_GREATER_THAN(tokyo.sunriseMin, tokyo.sunsetMin);
+
+  const SunTimes sydney = computeSunTimes(-33.8688f, 151.2093f, 2024, 356);
+  TEST_ASSERT_LESS_THAN(0, sydney.sunriseMin);
+
+  const SunTimes losAngeles = computeSunTimes(34.0522f, -118.2437f, 2024, 173);
+  TEST_ASSERT_GREATER_THAN(1440, losAngeles.sunsetMin);
+}
+
+// Tromsø (69.65 N) has midnight sun in June and polar night in December;
+// both report solar noon (about 10:44 UTC) as sunrise and sunset
+void test_polar_day_and_night() {
+  const SunTimes june = computeSunTimes(69.6492f, 18.9553f, 2024, 173);
+  TEST_ASSERT_EQUAL_INT((int)SunState::POLAR_DAY, (int)june.state);
+  TEST_ASSERT_EQUAL_INT(june.sunriseMin, june.sunsetMin);
+  TEST_ASSERT_INT_WITHIN(5, hm(10, 46), june.sunriseMin);
+
+  const SunTimes december = computeSunTimes(69.6492f, 18.9553f, 2024, 356);
+  TEST_ASSERT_EQUAL_INT((int)SunState::POLAR_NIGHT, (int)december.state);
+  TEST_ASSERT_EQUAL_INT(december.sunriseMin, december.sunsetMin);
+  TEST_ASSERT_INT_WITHIN(5, hm(10, 44), december.sunriseMin);
+
+  // Around the equinox it has an ordinary day
+  const SunTimes march = computeSunTimes(69.6492f, 18.9553f, 2024, 80);
+  TEST_ASSERT_EQUAL_INT((int)SunState::NORMAL, (int)march.state);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_reference_tables);
+  RUN_TEST(test_times_outside_the_utc_day);
+  RUN_TEST(test_polar_day_and_night);
+  return UNITY_END();
+}
@@ -0,0 +1,21 @@
+Import("env")
+
+import os
+import sys
+
+# Regenerates src/grid_variants/*.cpp/.h from layouts/*.layout before every
+# build. Files are only rewritten when their content changes, so unchanged
+# layouts do not trigger a recompile. Any layout error aborts the build.
+
+sys.path.insert(0, os.path.join(env["PROJECT_DIR"], "tools"))
+import grid_compiler  # noqa: E402
+
+
+def generate_grid_layouts():
+    errors = grid_compiler.run()
+    if errors:
+        print(f"[grid_compiler] {errors} layout error(s); aborting build")
+        env.Exit(1)
+
+
+generate_grid_layouts()
@@ -0,0 +1,21 @@
+Import("env")
+
+import os
+import sys
+
+# Regenerates src/log_formats.cpp (and tools/log_formats.json for
+# tools/log_decode.py) from the log*f() calls in src/ before every build.
+# Unchanged tables are not rewritten; a format hash collision aborts.
+
+sys.path.insert(0, os.path.join(env["PROJECT_DIR"], "tools"))
+import log_formats  # noqa: E402
+
+
+def generate_log_formats():
+    errors = log_formats.run()
+    if errors:
+        print(f"[log_formats] {errors} error(s); aborting build")
+        env.Exit(1)
+
+
+generate_log_formats()
@@ -0,0 +1,19 @@
+Import("env")
+
+import os
+import sys
+
+# Regenerates src/web_assets_embedded.cpp (the UI pages built into the
+# firmware) from data/*.html before every build. The file is only rewritten
+# when a page changed.
+
+sys.path.insert(0, os.path.join(env["PROJECT_DIR"], "tools"))
+import web_embed  # noqa: E402
+
+
+def generate_web_assets():
+    if web_embed.run():
+        env.Exit(1)
+
+
+generate_web_assets()
@@ -0,0 +1,548 @@
+#!/usr/bin/env python3
+"""Grid layout compiler.
+
+Reads the human-readable layout specs in ``layouts/*.layout`` (letter grid,
+wiring order, word list) plus the phrase grammar of their language in
+``layouts/lang/<language>.grammar`` and emits the matching
+``src/grid_variants/<name>.h/.cpp`` tables. LED indices are derived from the
+wiring description, so nobody has to count serpentine turns by hand.
+
+The grammar is compiled into a small phrase program per variant: one byte per
+word, where values below PHRASE_OP_HOUR are word indices, PHRASE_OP_HOUR | n
+is the hour word n hours ahead and PHRASE_OP_END closes a phrase. The runtime
+interpreter in time_mapper.cpp only walks these bytes, so a new language
+needs a grammar file and a layout, not new code.
+
+The compiler refuses to emit tables when
+  - a word cannot be found on the grid (or is ambiguous without a position),
+  - a word or minute LED lands on a cell that is not wired to the strip,
+  - two words of the same phrase share an LED,
+  - the strip plus its declared spare LEDs does not add up to NUM_LEDS in
+    src/config.h (``spare N`` declares LEDs of the NUM_LEDS buffer that this
+    variant's strip does not have).
+
+Usage:
+  python tools/grid_compiler.py            regenerate all layouts
+  python tools/grid_compiler.py --check    fail when generated files are stale
+  python tools/grid_compiler.py FILE...    only compile the given specs
+"""
+
+import glob
+import os
+import re
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+LAYOUT_DIR = os.path.join(ROOT, "layouts")
+GRAMMAR_DIR = os.path.join(LAYOUT_DIR, "lang")
+OUTPUT_DIR = os.path.join(ROOT, "src", "grid_variants")
+CONFIG_H = os.path.join(ROOT, "src", "config.h")
+GRID_LAYOUT_H = os.path.join(ROOT, "src", "grid_layout.h")
+
+WIRINGS = ("serpentine-rows", "serpentine-columns", "rows", "columns")
+CORNERS = ("top-left", "top-right", "bottom-left", "bottom-right")
+DIRECTIONS = {"across": (0, 1), "down": (1, 0)}
+
+BUCKETS = list(range(0, 60, 5))
+HOUR_TOKEN = "{H}"
+MAX_WORD_LEDS = 20     # WordPosition::indices
+MIN_MINUTE_LEDS = 4
+# Phrase program opcodes, keep in sync with wordposition.h
+PHRASE_OP_HOUR = 0x80
+PHRASE_OP_END = 0xFF
+MAX_WORDS = PHRASE_OP_HOUR
+
+
+class LayoutError(Exception):
+    pass
+
+
+class Layout:
+    def __init__(self, path):
+        self.path = path
+        self.name = None
+        self.wiring = "serpentine-rows"
+        self.start = "top-left"
+        self.lead = 0
+        self.bend = 0
+        self.bend_overrides = {}
+        self.strip = None
+        self.spare = 0
+        self.grid = []
+        self.minute_marker = None
+        self.words = []      # (name, text, pos or None, direction or None, line)
+        self.language = None
+        self.grammar = None
+        # Filled in by place()
+        self.cells = {}      # (row, col) -> led index or None when unwired
+        self.total = 0
+        self.word_leds = {}  # name -> [led...]
+        self.word_cells = {} # name -> [(row, col)...]
+        self.minute_leds = []
+        self.grid_leds = 0
+
+    def error(self, msg, line=None):
+        where = os.path.relpath(self.path, ROOT)
+        if line is not None:
+            where += ":%d" % line
+        return LayoutError("%s: %s" % (where, msg))
+
+
+def read_define(path, name):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    m = re.search(r"#define\s+%s\s+(\d+)" % name, text) or \
+        re.search(r"\b%s\s*=\s*(\d+)\s*;" % name, text)
+    if not m:
+        raise LayoutError("%s not found in %s" % (name, os.path.relpath(path, ROOT)))
+    return int(m.group(1))
+
+
+def parse(path):
+    lay = Layout(path)
+    block = None
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().splitlines()
+    for no, raw in enumerate(lines, 1):
+        line = raw.split("#", 1)[0].strip()
+        if not line:
+            continue
+        if block:
+            if line == "end":
+                block = None
+                continue
+            if block == "grid":
+                lay.grid.append(line)
+            elif block == "words":
+                parts = line.split()
+                name = parts[0]
+                text = parts[1] if len(parts) > 1 else name
+                pos = None
+                direction = None
+                if len(parts) > 2:
+                    try:
+                        r, c = parts[2].split(",")
+                        pos = (int(r), int(c))
+                    except ValueError:
+                        raise lay.error("bad position '%s' (expected row,col)" % parts[2], no)
+                    direction = parts[3] if len(parts) > 3 else "across"
+                    if direction not in DIRECTIONS:
+                        raise lay.error("bad direction '%s'" % direction, no)
+                if any(w[0] == name for w in lay.words):
+                    raise lay.error("word %s defined twice" % name, no)
+                lay.words.append((name, text.upper(), pos, direction, no))
+            continue
+
+        key, _, value = line.partition(" ")
+        value = value.strip()
+        if key in ("grid", "words"):
+            block = key
+        elif key == "name":
+            lay.name = value
+        elif key == "wiring":
+            if value not in WIRINGS:
+                raise lay.error("wiring must be one of %s" % ", ".join(WIRINGS), no)
+            lay.wiring = value
+        elif key == "start":
+            if value not in CORNERS:
+                raise lay.error("start must be one of %s" % ", ".join(CORNERS), no)
+            lay.start = value
+        elif key == "lead":
+            lay.lead = int(value)
+        elif key == "bend":
+            parts = value.split()
+            lay.bend = int(parts[0])
+            for override in parts[1:]:
+                after, _, count = override.partition("=")
+                lay.bend_overrides[int(after)] = int(count)
+        elif key == "strip":
+            lay.strip = int(value)
+        elif key == "spare":
+            lay.spare = int(value)
+        elif key == "minutes":
+            lay.minute_marker = value
+        elif key == "language":
+            lay.language = value
+        else:
+            raise lay.error("unknown key '%s'" % key, no)
+    if block:
+        raise lay.error("block '%s' not closed with 'end'" % block)
+    if not lay.name:
+        raise lay.error("missing 'name'")
+    if not lay.language:
+        raise lay.error("missing 'language'")
+    return lay
+
+
+class Grammar:
+    def __init__(self, path):
+        self.path = path
+        self.language = None
+        self.prefix = []
+        self.hours = []
+        self.next_hour_from = 60
+        self.phrases = {}    # bucket -> ([tokens], line)
+
+    def error(self, msg, line=None):
+        where = os.path.relpath(self.path, ROOT)
+        if line is not None:
+            where += ":%d" % line
+        return LayoutError("%s: %s" % (where, msg))
+
+    def hour_offset(self, bucket):
+        return 1 if bucket >= self.next_hour_from else 0
+
+
+def parse_grammar(path):
+    gr = Grammar(path)
+    if not os.path.exists(path):
+        raise LayoutError("%s: no such grammar" % os.path.relpath(path, ROOT))
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().splitlines()
+    for no, raw in enumerate(lines, 1):
+        line = raw.split("#", 1)[0].strip()
+        if not line:
+            continue
+        parts = line.split()
+        key = parts[0]
+        if key.isdigit():
+            bucket = int(key)
+            if bucket not in BUCKETS:
+                raise gr.error("minute bucket %d is not a multiple of 5 below 60" % bucket, no)
+            if bucket in gr.phrases:
+                raise gr.error("phrase %02d defined twice" % bucket, no)
+            gr.phrases[bucket] = (parts[1:], no)
+        elif key == "language":
+            gr.language = parts[1]
+        elif key == "prefix":
+            gr.prefix = parts[1:]
+        elif key == "hours":
+            gr.hours = parts[1:]
+        elif key == "next-hour-from":
+            gr.next_hour_from = int(parts[1])
+        else:
+            raise gr.error("unknown key '%s'" % key, no)
+    if len(gr.hours) != 12:
+        raise gr.error("'hours' must list 12 words (twelve, one, ..., eleven)")
+    missing = [b for b in BUCKETS if b not in gr.phrases]
+    if missing:
+        raise gr.error("phrases missing for minute buckets %s" % ", ".join("%02d" % b for b in missing))
+    return gr
+
+
+def wiring_order(lay):
+    """Yields the grid lines (lists of (row, col)) in the order the strip visits them."""
+    height = len(lay.grid)
+    width = len(lay.grid[0])
+    by_rows = lay.wiring.endswith("rows")
+    serpentine = lay.wiring.startswith("serpentine")
+    top = lay.start.startswith("top")
+    left = lay.start.endswith("left")
+
+    if by_rows:
+        outer = range(height) if top else range(height - 1, -1, -1)
+        forward = left
+        lines = [[(r, c) for c in (range(width) if forward else range(width - 1, -1, -1))] for r in outer]
+    else:
+        outer = range(width) if left else range(width - 1, -1, -1)
+        forward = top
+        lines = [[(r, c) for r in (range(height) if forward else range(height - 1, -1, -1))] for c in outer]
+    if serpentine:
+        lines = [line if i % 2 == 0 else list(reversed(line)) for i, line in enumerate(lines)]
+    return lines
+
+
+def place(lay, num_leds):
+    if not lay.grid:
+        raise lay.error("empty grid")
+    width = len(lay.grid[0])
+    for row in lay.grid:
+        if len(row) != width:
+            raise lay.error("grid rows must all be %d cells wide ('%s')" % (width, row))
+
+    idx = lay.lead
+    lines = wiring_order(lay)
+    for i, line in enumerate(lines):
+        for cell in line:
+            lay.cells[cell] = idx
+            idx += 1
+        if i < len(lines) - 1:
+            idx += lay.bend_overrides.get(i, lay.bend)
+    lay.total = idx
+    if lay.strip is None:
+        lay.strip = lay.total
+    if lay.strip + lay.spare != num_leds:
+        raise lay.error("strip has %d LEDs and %d spare but NUM_LEDS is %d" % (lay.strip, lay.spare, num_leds))
+    for cell, led in lay.cells.items():
+        if led >= lay.strip:
+            lay.cells[cell] = None
+
+    # Minute LEDs: marker cells in reading order
+    if lay.minute_marker:
+        minute_rows = set()
+        for r, row in enumerate(lay.grid):
+            for c, ch in enumerate(row):
+                if ch == lay.minute_marker:
+                    led = lay.cells[(r, c)]
+                    if led is None:
+                        raise lay.error("minute LED at %d,%d is not wired (strip ends at %d)" % (r, c, lay.strip))
+                    lay.minute_leds.append(led)
+                    minute_rows.add(r)
+        if len(lay.minute_leds) < MIN_MINUTE_LEDS:
+            raise lay.error("need at least %d minute LEDs, found %d" % (MIN_MINUTE_LEDS, len(lay.minute_leds)))
+    else:
+        minute_rows = set()
+
+    letter_cells = [lay.cells[(r, c)] for r in range(len(lay.grid)) if r not in minute_rows
+                    for c in range(width) if lay.cells[(r, c)] is not None]
+    lay.grid_leds = max(letter_cells) + 1 if letter_cells else 0
+
+    for name, text, pos, direction, no in lay.words:
+        if pos is None:
+            matches = find_all(lay.grid, text)
+            if not matches:
+                raise lay.error("word %s ('%s') is unreachable: not found on the grid" % (name, text), no)
+            if len(matches) > 1:
+                spots = ", ".join("%d,%d %s" % (r, c, d) for (r, c), d in matches)
+                raise lay.error("word %s ('%s') is ambiguous (%s); add a position" % (name, text, spots), no)
+            pos, direction = matches[0]
+        elif not matches_at(lay.grid, text, pos, direction):
+            raise lay.error("word %s ('%s') does not match the grid at %d,%d %s" % (name, text, pos[0], pos[1], direction), no)
+        dr, dc = DIRECTIONS[direction]
+        cells = [(pos[0] + dr * i, pos[1] + dc * i) for i in range(len(text))]
+        leds = []
+        for cell in cells:
+            led = lay.cells[cell]
+            if led is None:
+                raise lay.error("word %s is unreachable: cell %d,%d is not wired" % (name, cell[0], cell[1]), no)
+            if led == 0:
+                raise lay.error("word %s uses LED 0, which terminates WordPosition::indices" % name, no)
+            leds.append(led)
+        if len(leds) > MAX_WORD_LEDS:
+            raise lay.error("word %s has more than %d letters" % (name, MAX_WORD_LEDS), no)
+        lay.word_leds[name] = leds
+        lay.word_cells[name] = cells
+
+
+def find_all(grid, text):
+    found = []
+    for r in range(len(grid)):
+        for c in range(len(grid[0])):
+            for direction in ("across", "down"):
+                if matches_at(grid, text, (r, c), direction):
+                    found.append(((r, c), direction))
+    return found
+
+
+def matches_at(grid, text, pos, direction):
+    dr, dc = DIRECTIONS[direction]
+    for i, ch in enumerate(text):
+        r = pos[0] + dr * i
+        c = pos[1] + dc * i
+        if r >= len(grid) or c >= len(grid[0]) or grid[r][c] != ch:
+            return False
+    return True
+
+
+def phrase_tokens(gr, bucket):
+    tokens, _ = gr.phrases[bucket]
+    return gr.prefix + tokens
+
+
+def check_phrases(lay):
+    gr = lay.grammar
+    names = [w[0] for w in lay.words]
+    if len(names) > MAX_WORDS:
+        raise lay.error("more than %d words" % MAX_WORDS)
+    for word in gr.prefix + gr.hours:
+        if word not in lay.word_leds:
+            raise gr.error("word %s is not on layout %s" % (word, lay.name))
+
+    for bucket in BUCKETS:
+        _, no = gr.phrases[bucket]
+        tokens = phrase_tokens(gr, bucket)
+        for t in tokens:
+            if t != HOUR_TOKEN and t not in names:
+                raise gr.error("phrase %02d uses word %s, which is not on layout %s" % (bucket, t, lay.name), no)
+        for hour in range(12):
+            owner = {}
+            for led in lay.minute_leds:
+                owner[led] = "minute LEDs"
+            for t in tokens:
+                word = t
+                if t == HOUR_TOKEN:
+                    word = gr.hours[(hour + gr.hour_offset(bucket)) % 12]
+                for led in lay.word_leds[word]:
+                    if led in owner:
+                        raise gr.error("%s, phrase %02d at hour %d: %s and %s overlap on LED %d"
+                                       % (lay.name, bucket, hour, owner[led], word, led), no)
+                    owner[led] = word
+
+
+def compile_phrases(lay):
+    """Returns [(bucket, [opcode literals], comment)] for the phrase program."""
+    gr = lay.grammar
+    names = [w[0] for w in lay.words]
+    program = []
+    for bucket in BUCKETS:
+        ops = []
+        tokens = phrase_tokens(gr, bucket)
+        for t in tokens:
+            if t == HOUR_TOKEN:
+                ops.append("PHRASE_OP_HOUR | %d" % gr.hour_offset(bucket))
+            else:
+                ops.append(str(names.index(t)))
+        ops.append("PHRASE_OP_END")
+        program.append((bucket, ops, " ".join(tokens)))
+    return program
+
+
+def symbol(lay):
+    return lay.name.upper()
+
+
+def render_header(lay, spec):
+    s = symbol(lay)
+    return """// Generated by tools/grid_compiler.py from {spec}. Do not edit by hand.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wordposition.h"
+
+extern const uint16_t LED_COUNT_GRID_{s};
+extern const uint16_t LED_COUNT_EXTRA_{s};
+extern const uint16_t LED_COUNT_TOTAL_{s};
+
+extern const char* const LETTER_GRID_{s}[];
+extern const WordPosition WORDS_{s}[];
+extern const size_t WORDS_{s}_COUNT;
+extern const uint16_t EXTRA_MINUTES_{s}[];
+extern const size_t EXTRA_MINUTES_{s}_COUNT;
+extern const int16_t CELL_LEDS_{s}[];
+extern const uint8_t PHRASE_PROGRAM_{s}[];
+extern const uint8_t PHRASE_ENTRY_{s}[PHRASE_BUCKET_COUNT];
+extern const uint8_t PHRASE_PREFIX_WORDS_{s};
+extern const uint8_t HOUR_WORDS_{s}[12];
+""".format(spec=spec, s=s)
+
+
+def render_source(lay, spec):
+    s = symbol(lay)
+    names = [w[0] for w in lay.words]
+    out = []
+    out.append("// Generated by tools/grid_compiler.py from %s. Do not edit by hand." % spec)
+    out.append('#include "grid_variants/%s.h"' % lay.name.lower())
+    out.append("")
+    out.append("const uint16_t LED_COUNT_GRID_%s = %d;" % (s, lay.grid_leds))
+    out.append("const uint16_t LED_COUNT_EXTRA_%s = %d;" % (s, lay.strip - lay.grid_leds))
+    out.append("const uint16_t LED_COUNT_TOTAL_%s = LED_COUNT_GRID_%s + LED_COUNT_EXTRA_%s;" % (s, s, s))
+    out.append("")
+    out.append("const char* const LETTER_GRID_%s[] = {" % s)
+    out.append(",\n".join('  "%s"' % row for row in lay.grid))
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t EXTRA_MINUTES_%s[] = { %s };" % (s, ", ".join(str(led) for led in lay.minute_leds)))
+    out.append("")
+    out.append("// LED index per grid cell, row by row (-1 = not wired)")
+    out.append("const int16_t CELL_LEDS_%s[] = {" % s)
+    cell_rows = []
+    for r, row in enumerate(lay.grid):
+        leds = [lay.cells[(r, c)] for c in range(len(row))]
+        cell_rows.append("  " + ", ".join(("%d" % (-1 if led is None else led)).rjust(3) for led in leds))
+    out.append(",\n".join(cell_rows))
+    out.append("};")
+    out.append("")
+    out.append("const WordPosition WORDS_%s[] = {" % s)
+    rows = []
+    for name in names:
+        rows.append('  { %s { %s } }' % (('"%s",' % name).ljust(14), ", ".join(str(i) for i in lay.word_leds[name])))
+    out.append(",\n".join(rows))
+    out.append("};")
+    out.append("")
+    out.append("// Phrase program compiled from %s" % os.path.relpath(lay.grammar.path, ROOT).replace(os.sep, "/"))
+    out.append("const uint8_t PHRASE_PROGRAM_%s[] = {" % s)
+    entries = []
+    offset = 0
+    for bucket, ops, text in compile_phrases(lay):
+        entries.append(offset)
+        offset += len(ops)
+        out.append("  %s,  // :%02d %s" % (", ".join(ops), bucket, text))
+    out[-1] = out[-1].replace(",  //", "   //", 1)
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t PHRASE_ENTRY_%s[PHRASE_BUCKET_COUNT] = { %s };" % (s, ", ".join(str(e) for e in entries)))
+    out.append("const uint8_t PHRASE_PREFIX_WORDS_%s = %d;" % (s, len(lay.grammar.prefix)))
+    out.append("const uint8_t HOUR_WORDS_%s[12] = { %s };" % (s, ", ".join(str(names.index(h)) for h in lay.grammar.hours)))
+    out.append("")
+    out.append("const size_t WORDS_%s_COUNT = sizeof(WORDS_%s) / sizeof(WORDS_%s[0]);" % (s, s, s))
+    out.append("const size_t EXTRA_MINUTES_%s_COUNT = sizeof(EXTRA_MINUTES_%s) / sizeof(EXTRA_MINUTES_%s[0]);" % (s, s, s))
+    return "\n".join(out) + "\n"
+
+
+def compile_layout(path, num_leds, grid_w=None, grid_h=None):
+    lay = parse(path)
+    # CELL_LEDS_* and LETTER_GRID are indexed with GRID_WIDTH/GRID_HEIGHT at runtime
+    if grid_h is not None and len(lay.grid) != grid_h:
+        raise lay.error("grid has %d rows, GRID_HEIGHT is %d" % (len(lay.grid), grid_h))
+    if grid_w is not None and lay.grid and len(lay.grid[0]) != grid_w:
+        raise lay.error("grid is %d cells wide, GRID_WIDTH is %d" % (len(lay.grid[0]), grid_w))
+    place(lay, num_leds)
+    lay.grammar = parse_grammar(os.path.join(GRAMMAR_DIR, lay.language + ".grammar"))
+    check_phrases(lay)
+    spec = os.path.relpath(path, ROOT).replace(os.sep, "/")
+    base = os.path.join(OUTPUT_DIR, lay.name.lower())
+    return {base + ".h": render_header(lay, spec), base + ".cpp": render_source(lay, spec)}
+
+
+def write_if_changed(path, content):
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == content:
+                return False
+    except FileNotFoundError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+    return True
+
+
+def run(paths=None, check=False, log=print):
+    """Compiles the given (or all) layouts. Returns the number of errors."""
+    paths = paths or sorted(glob.glob(os.path.join(LAYOUT_DIR, "*.layout")))
+    num_leds = read_define(CONFIG_H, "NUM_LEDS")
+    grid_w = read_define(GRID_LAYOUT_H, "GRID_WIDTH")
+    grid_h = read_define(GRID_LAYOUT_H, "GRID_HEIGHT")
+    errors = 0
+    for path in paths:
+        try:
+            outputs = compile_layout(path, num_leds, grid_w, grid_h)
+        except LayoutError as e:
+            log("[grid_compiler] ERROR %s" % e)
+            errors += 1
+            continue
+        for out_path, content in outputs.items():
+            rel = os.path.relpath(out_path, ROOT)
+            if check:
+                try:
+                    with open(out_path, encoding="utf-8") as f:
+                        stale = f.read() != content
+                except FileNotFoundError:
+                    stale = True
+                if stale:
+                    log("[grid_compiler] ERROR %s is out of date; run tools/grid_compiler.py" % rel)
+                    errors += 1
+            elif write_if_changed(out_path, content):
+                log("[grid_compiler] Generated %s" % rel)
+    return errors
+
+
+def main(argv):
+    check = "--check" in argv
+    paths = [os.path.abspath(a) for a in argv if not a.startswith("--")]
+    return 1 if run(paths, check=check) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Decodes a binary log dump from the device.
+
+  curl -u user:pass -o device.log.bin "http://<device>/log?format=bin"
+  python tools/log_decode.py device.log.bin
+
+The dump is "CIWSLOG1" followed by records of
+  uint32 seq, uint32 seconds, uint16 meta, uint16 length, payload
+(little endian; meta = millis | level << 10 | synced << 12 | binary << 13).
+Binary payloads are a format ID plus packed arguments (src/log_binary.h) and
+are formatted with the table tools/log_formats.py generated for the build.
+Argument sizes follow the ESP32: int, long and pointers are 4 bytes.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+import time
+
+MAGIC = b"CIWSLOG1"
+LEVELS = ("DEBUG", "INFO", "WARN", "ERROR")
+DEFAULT_FORMATS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "log_formats.json")
+SPEC = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|j|z|t)?(.)?")
+
+
+class Payload:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def take(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.pos + size > len(self.data):
+            raise EOFError
+        value = struct.unpack_from(fmt, self.data, self.pos)[0]
+        self.pos += size
+        return value
+
+    def string(self):
+        end = self.data.find(b"\0", self.pos)
+        if end < 0:
+            raise EOFError
+        value = self.data[self.pos:end].decode("utf-8", "replace")
+        self.pos = end + 1
+        return value
+
+
+def format_record(fmt, payload):
+    out = []
+    pos = 0
+    try:
+        for m in SPEC.finditer(fmt):
+            out.append(fmt[pos:m.start()])
+            pos = m.end()
+            flags, width, precision, length, conv = m.groups()
+            if conv == "%":
+                out.append("%")
+                continue
+            if width == "*":
+                width = str(payload.take("<i"))
+            if precision == "*":
+                precision = str(payload.take("<i"))
+            spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+            if conv in "diouxXc":
+                wide = length in ("ll", "j")
+                signed = conv in "di"
+                value = payload.take(("<q" if signed else "<Q") if wide else ("<i" if signed else "<I"))
+                if length == "hh":
+                    value &= 0xFF
+                elif length == "h":
+                    value &= 0xFFFF
+                if conv == "c":
+                    out.append((spec + "s") % chr(value & 0xFF))
+                else:
+                    out.append((spec + ("d" if conv == "u" else conv)) % value)
+            elif conv in "fFeEgG":
+                out.append((spec + conv) % payload.take("<f"))
+            elif conv in "aA":
+                out.append(float.hex(payload.take("<f")))
+            elif conv == "s":
+                out.append((spec + "s") % payload.string())
+            elif conv == "p":
+                out.append("0x%x" % payload.take("<I"))
+        out.append(fmt[pos:])
+    except EOFError:
+        pass  # record was truncated on the device
+    return "".join(out)
+
+
+def prefix(seconds, millis, level, synced, utc):
+    tag = LEVELS[level] if level < len(LEVELS) else "INFO"
+    if not synced:
+        return "[uptime %d.%03ds][%s] " % (seconds, millis, tag)
+    t = time.gmtime(seconds) if utc else time.localtime(seconds)
+    return "[%s.%03d %s][%s] " % (time.strftime("%Y-%m-%d %H:%M:%S", t), millis, "UTC" if utc else time.strftime("%Z", t), tag)
+
+
+def decode(data, formats, utc=False):
+    if not data.startswith(MAGIC):
+        raise ValueError("not a binary log dump (missing %s header)" % MAGIC.decode())
+    pos = len(MAGIC)
+    while pos + 12 <= len(data):
+        seq, seconds, meta, length = struct.unpack_from("<IIHH", data, pos)
+        payload = data[pos + 12:pos + 12 + length]
+        pos += 12 + length
+        millis, level = meta & 0x3FF, (meta >> 10) & 0x3
+        synced, binary = bool(meta & (1 << 12)), bool(meta & (1 << 13))
+        if binary:
+            p = Payload(payload)
+            fid = p.take("<I")
+            fmt = formats.get("%08x" % fid)
+            text = format_record(fmt, p) if fmt is not None else "<log format %08x, %d bytes>" % (fid, length - 4)
+        else:
+            text = payload.decode("utf-8", "replace")
+        yield seq, prefix(seconds, millis, level, synced, utc) + text
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump", help="file saved from /log?format=bin ('-' for stdin)")
+    parser.add_argument("--formats", default=DEFAULT_FORMATS, help="format table (default: %(default)s)")
+    parser.add_argument("--utc", action="store_true", help="print times in UTC instead of local time")
+    parser.add_argument("--seq", action="store_true", help="prefix lines with their sequence number")
+    args = parser.parse_args(argv)
+
+    with open(args.formats, encoding="utf-8") as f:
+        formats = json.load(f)
+    data = sys.stdin.buffer.read() if args.dump == "-" else open(args.dump, "rb").read()
+    try:
+        for seq, line in decode(data, formats, args.utc):
+            print(("%d " % seq if args.seq else "") + line)
+    except ValueError as e:
+        print("log_decode: %s" % e, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
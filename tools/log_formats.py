@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Log format table generator.
+
+Binary log records (src/log_binary.h) store the FNV-1a hash of their printf
+format instead of the formatted text. This script collects the format
+literal of every log*f() / logfAt() call under src/ and writes
+
+  src/log_formats.cpp      the ID -> format table used by /log on the device
+  tools/log_formats.json   the same table for tools/log_decode.py
+
+Two different formats with the same hash abort the build; reword one of them.
+
+Usage:
+  python tools/log_formats.py            regenerate the table
+  python tools/log_formats.py --check    fail when the table is stale
+"""
+
+import glob
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+SRC_DIR = os.path.join(ROOT, "src")
+TABLE_CPP = os.path.join(SRC_DIR, "log_formats.cpp")
+TABLE_JSON = os.path.join(ROOT, "tools", "log_formats.json")
+
+STRING = r'"(?:[^"\\\n]|\\.)*"'
+CALL = re.compile(r"\b(?:log(?:Debug|Info|Warn|Error)f\s*\(|logfAt\s*\([^,()]+,)\s*((?:%s\s*)+)" % STRING)
+LITERAL = re.compile(STRING)
+ESCAPES = {"n": 10, "t": 9, "r": 13, "a": 7, "b": 8, "f": 12, "v": 11, "\\": 92, '"': 34, "'": 39, "?": 63}
+
+
+def unescape(literal):
+    """Bytes of a C string literal body (without quotes)."""
+    raw = literal.encode("utf-8")
+    out = bytearray()
+    i = 0
+    while i < len(raw):
+        c = raw[i]
+        if c != 0x5C:
+            out.append(c)
+            i += 1
+            continue
+        e = chr(raw[i + 1])
+        if e == "x":
+            j = i + 2
+            while j < len(raw) and chr(raw[j]) in "0123456789abcdefABCDEF":
+                j += 1
+            out.append(int(raw[i + 2:j], 16) & 0xFF)
+            i = j
+        elif e in "01234567":
+            j = i + 1
+            while j < len(raw) and j < i + 4 and chr(raw[j]) in "01234567":
+                j += 1
+            out.append(int(raw[i + 1:j], 8) & 0xFF)
+            i = j
+        else:
+            out.append(ESCAPES.get(e, raw[i + 1]))
+            i += 2
+    return bytes(out)
+
+
+def fnv1a(data):
+    h = 0x811C9DC5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def collect(log=print):
+    """Returns ({id: format bytes}, errors)."""
+    formats = {}
+    errors = 0
+    paths = sorted(glob.glob(os.path.join(SRC_DIR, "**", "*.cpp"), recursive=True) +
+                   glob.glob(os.path.join(SRC_DIR, "**", "*.h"), recursive=True))
+    for path in paths:
+        if os.path.abspath(path) == TABLE_CPP:
+            continue
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        for m in CALL.finditer(text):
+            fmt = b"".join(unescape(lit[1:-1]) for lit in LITERAL.findall(m.group(1)))
+            fid = fnv1a(fmt)
+            if fid in formats and formats[fid] != fmt:
+                line = text.count("\n", 0, m.start()) + 1
+                log("[log_formats] ERROR %s:%d: format hash collides with %r" %
+                    (os.path.relpath(path, ROOT), line, formats[fid].decode("utf-8", "replace")))
+                errors += 1
+            formats[fid] = fmt
+    return formats, errors
+
+
+def c_literal(fmt):
+    text = fmt.decode("utf-8", "backslashreplace")
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n").replace("\t", "\\t") + '"'
+
+
+def render_source(formats):
+    lines = [
+        "// Generated by tools/log_formats.py from the log*f() calls in src/. Do not edit by hand.",
+        '#include "log_binary.h"',
+        "",
+        "const LogFormat LOG_FORMATS[] = {",
+    ]
+    for fid in sorted(formats):
+        lines.append("  {0x%08xu, %s}," % (fid, c_literal(formats[fid])))
+    if not formats:
+        lines.append("  {0u, nullptr},")
+    lines += [
+        "};",
+        "const size_t LOG_FORMAT_COUNT = %d;" % len(formats),
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def render_json(formats):
+    table = {"%08x" % fid: formats[fid].decode("utf-8", "backslashreplace") for fid in sorted(formats)}
+    return json.dumps(table, indent=2, ensure_ascii=False) + "\n"
+
+
+def write_if_changed(path, content):
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == content:
+                return False
+    except FileNotFoundError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+    return True
+
+
+def run(check=False, log=print):
+    """Regenerates (or checks) the format table. Returns the number of errors."""
+    formats, errors = collect(log)
+    if errors:
+        return errors
+    for path, content in ((TABLE_CPP, render_source(formats)), (TABLE_JSON, render_json(formats))):
+        rel = os.path.relpath(path, ROOT)
+        if check:
+            try:
+                with open(path, encoding="utf-8") as f:
+                    stale = f.read() != content
+            except FileNotFoundError:
+                stale = True
+            if stale:
+                log("[log_formats] ERROR %s is out of date; run tools/log_formats.py" % rel)
+                errors += 1
+        elif write_if_changed(path, content):
+            log("[log_formats] Generated %s (%d formats)" % (rel, len(formats)))
+    return errors
+
+
+def main(argv):
+    return 1 if run(check="--check" in argv) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
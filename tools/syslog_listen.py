@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Minimal syslog collector for checking the device's remote logging.
+
+Listens on UDP, splits datagrams into their LF-separated RFC 5424 messages,
+checks the header and reports gaps in the meta sequenceId per host.
+
+  python tools/syslog_listen.py                 listen on 0.0.0.0:5514
+  python tools/syslog_listen.py --port 514      (needs root for ports < 1024)
+  python tools/syslog_listen.py --count 100     exit after 100 messages
+
+Then point the device at this machine in the MQTT page's Syslog section.
+"""
+
+import argparse
+import re
+import socket
+import sys
+
+SEVERITIES = ("EMERG", "ALERT", "CRIT", "ERROR", "WARN", "NOTICE", "INFO", "DEBUG")
+RFC5424 = re.compile(
+    r"^<(?P<pri>\d{1,3})>1 (?P<ts>\S+) (?P<host>\S+) (?P<app>\S+) (?P<proc>\S+) (?P<msgid>\S+) "
+    r"(?P<sd>-|(?:\[[^\]]*\])+) ?(?P<msg>.*)$", re.S)
+SEQUENCE = re.compile(r'\[meta [^\]]*sequenceId="(\d+)"')
+BOM = "\ufeff"
+
+
+class Collector:
+    def __init__(self, out=sys.stdout):
+        self.out = out
+        self.last_seq = {}
+        self.messages = 0
+        self.datagrams = 0
+        self.gaps = 0
+        self.invalid = 0
+
+    def datagram(self, data, sender):
+        self.datagrams += 1
+        for raw in data.split(b"\n"):
+            if raw:
+                self.message(raw.decode("utf-8", "replace"), sender)
+
+    def message(self, text, sender):
+        m = RFC5424.match(text)
+        if not m or int(m.group("pri")) > 191:
+            self.invalid += 1
+            print("!! invalid from %s: %r" % (sender, text[:120]), file=self.out)
+            return
+        self.messages += 1
+        host = m.group("host")
+        seq = SEQUENCE.search(m.group("sd"))
+        if seq:
+            seq = int(seq.group(1))
+            last = self.last_seq.get(host)
+            if last is not None and seq > last + 1:
+                self.gaps += 1
+                print("-- %s: %d record(s) not received before sequenceId %d (dropped, or below the minimum level)" %
+                      (host, seq - last - 1, seq), file=self.out)
+            self.last_seq[host] = seq
+        msg = m.group("msg")
+        if msg.startswith(BOM):
+            msg = msg[1:]
+        severity = SEVERITIES[int(m.group("pri")) % 8]
+        print("%s %s %-5s %s" % (m.group("ts"), host, severity, msg), file=self.out)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--bind", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=5514)
+    parser.add_argument("--count", type=int, default=0, help="exit after this many messages")
+    args = parser.parse_args(argv)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind((args.bind, args.port))
+    collector = Collector()
+    print("listening on udp %s:%d" % (args.bind, args.port), file=sys.stderr)
+    try:
+        while not args.count or collector.messages < args.count:
+            data, sender = sock.recvfrom(65535)
+            collector.datagram(data, sender[0])
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    print("%d messages in %d datagrams, %d gaps, %d invalid" %
+          (collector.messages, collector.datagrams, collector.gaps, collector.invalid), file=sys.stderr)
+    return 1 if collector.invalid else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""Embeds the web UI pages in the firmware.
+
+Every data/*.html page is minified (indentation, blank lines, HTML comments
+and whole-line // comments in scripts are dropped; <pre> and <textarea>
+content is left alone), gzipped and written as a byte array to
+
+  src/web_assets_embedded.cpp   WEB_ASSETS[]: path, MIME type, gzip bytes, ETag
+
+The ETag is derived from the SHA-256 of the page source, so it changes
+exactly when the page does. The file is only rewritten when a page changed;
+zlib output may differ between Python builds, and this keeps it from
+churning.
+
+Usage:
+  python tools/web_embed.py            regenerate the assets
+  python tools/web_embed.py --check    fail when the assets are stale
+"""
+
+import glob
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+DATA_DIR = os.path.join(ROOT, "data")
+ASSETS_CPP = os.path.join(ROOT, "src", "web_assets_embedded.cpp")
+
+MIME = {".html": "text/html"}
+HTML_COMMENT = re.compile(r"<!--(?!\[).*?-->", re.S)
+SOURCE_HASH = re.compile(r"^// Source hash: ([0-9a-f]{64})$", re.M)
+
+
+def minify(text):
+    """Line-based minification that leaves JavaScript statements intact."""
+    text = HTML_COMMENT.sub("", text)
+    out = []
+    verbatim = False  # inside <pre> or <textarea>
+    script = False
+    for line in text.splitlines():
+        if verbatim:
+            out.append(line)
+            if re.search(r"</(pre|textarea)>", line, re.I):
+                verbatim = False
+            continue
+        stripped = line.strip()
+        if re.search(r"<(pre|textarea)\b", stripped, re.I) and not re.search(r"</(pre|textarea)>", stripped, re.I):
+            verbatim = True
+        if re.search(r"<script\b", stripped, re.I):
+            script = True
+        if re.search(r"</script>", stripped, re.I):
+            script = False
+        if not stripped or (script and stripped.startswith("//")):
+            continue
+        out.append(stripped)
+    return "\n".join(out) + "\n"
+
+
+def collect():
+    """Returns [(url path, mime, source bytes)] sorted by path."""
+    assets = []
+    for path in sorted(glob.glob(os.path.join(DATA_DIR, "*"))):
+        mime = MIME.get(os.path.splitext(path)[1].lower())
+        if not mime or not os.path.isfile(path):
+            continue
+        with open(path, "rb") as f:
+            assets.append(("/" + os.path.basename(path), mime, f.read()))
+    return assets
+
+
+def source_hash(assets):
+    h = hashlib.sha256()
+    with open(os.path.abspath(__file__), "rb") as f:
+        h.update(f.read())  # a changed minifier regenerates too
+    for url, mime, data in assets:
+        h.update(url.encode() + b"\0" + mime.encode() + b"\0" + data + b"\0")
+    return h.hexdigest()
+
+
+def render_source(assets, digest):
+    lines = [
+        "// Generated by tools/web_embed.py from data/*.html. Do not edit by hand.",
+        "// Source hash: %s" % digest,
+        '#include "web_assets.h"',
+        "",
+    ]
+    table = []
+    for i, (url, mime, data) in enumerate(assets):
+        packed = gzip.compress(minify(data.decode("utf-8")).encode("utf-8"), compresslevel=9, mtime=0)
+        etag = '"%s"' % hashlib.sha256(data).hexdigest()[:16]
+        lines.append("// %s: %d bytes, %d gzipped" % (url, len(data), len(packed)))
+        lines.append("static const uint8_t ASSET_%d[] PROGMEM = {" % i)
+        for off in range(0, len(packed), 16):
+            lines.append("  " + " ".join("0x%02x," % b for b in packed[off:off + 16]))
+        lines += ["};", ""]
+        table.append('  {"%s", "%s", ASSET_%d, %d, "%s"},' % (url, mime, i, len(packed), etag.replace('"', '\\"')))
+    lines.append("const WebAsset WEB_ASSETS[] = {")
+    lines += table or ["  {nullptr, nullptr, nullptr, 0, nullptr},"]
+    lines += [
+        "};",
+        "const size_t WEB_ASSET_COUNT = %d;" % len(assets),
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def current_hash():
+    try:
+        with open(ASSETS_CPP, encoding="utf-8") as f:
+            m = SOURCE_HASH.search(f.read(4096))
+    except FileNotFoundError:
+        return None
+    return m.group(1) if m else None
+
+
+def run(check=False, log=print):
+    """Regenerates (or checks) the embedded assets. Returns the number of errors."""
+    assets = collect()
+    digest = source_hash(assets)
+    rel = os.path.relpath(ASSETS_CPP, ROOT)
+    if current_hash() == digest:
+        return 0
+    if check:
+        log("[web_embed] ERROR %s is out of date; run tools/web_embed.py" % rel)
+        return 1
+    with open(ASSETS_CPP, "w", encoding="utf-8", newline="\n") as f:
+        f.write(render_source(assets, digest))
+    log("[web_embed] Generated %s (%d pages)" % (rel, len(assets)))
+    return 0
+
+
+def main(argv):
+    return 1 if run(check="--check" in argv) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))